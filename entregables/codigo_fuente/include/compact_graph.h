@@ -0,0 +1,221 @@
+#ifndef COMPACT_GRAPH_H
+#define COMPACT_GRAPH_H
+
+#include "graph.h"
+#include "dynamic_array.h"
+#include "hash_index.h"
+#include "mapped_file.h"
+#include <string>
+#include <cstddef>
+
+// Instantánea inmutable de un Graph en formato CSR (compressed sparse row).
+// Los vecinos del nodo con índice interno i ocupan las posiciones
+// [offsets[i], offsets[i + 1]) de los arrays 'targets' y 'weights', que
+// guardan índices internos (no IDs) para recorrer aristas sin búsquedas.
+// Cada arista ocupa 12 bytes (int destino + double peso).
+//
+// Los datos pueden vivir en arrays propios (build) o directamente en un
+// archivo proyectado en memoria (mapFromBinary). En ambos casos se leen a
+// través de los mismos punteros, así que búsquedas, landmarks y CH funcionan
+// igual sobre un grafo recién construido o sobre uno abierto desde disco.
+//
+// Formato binario (versión 1, orden de bytes nativo):
+//   cabecera: magic "CSRG", versión, marca de orden de bytes, conteos
+//             (nodos, aristas, capacidad del índice hash, bytes de nombres),
+//             desplazamiento de cada sección y tamaño total del archivo
+//   secciones, alineadas a 8 bytes:
+//     offsets (n + 1 int), targets (m int), weights (m double),
+//     node_ids (n int), coord_x (n double), coord_y (n double),
+//     name_offsets (n + 1 int), name_chars (tabla de nombres empaquetada),
+//     hash_keys / hash_values (tablas de HashIndex, ID -> índice)
+// Abrirlo solo valida la cabecera: el costo es proporcional a las páginas
+// que se tocan después, no al tamaño del grafo.
+class CompactGraph {
+public:
+    // Arista saliente: destino (índice interno) y peso
+    struct Arc {
+        int target;
+        double weight;
+    };
+
+    // Vecinos de un nodo como rango iterable sobre su tramo de targets/weights
+    class NeighborRange {
+    public:
+        class Iterator {
+        private:
+            const int* target;
+            const double* weight;
+
+        public:
+            Iterator(const int* target, const double* weight) : target(target), weight(weight) {}
+
+            Arc operator*() const {
+                Arc arc = {*target, *weight};
+                return arc;
+            }
+
+            Iterator& operator++() {
+                ++target;
+                ++weight;
+                return *this;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return target != other.target;
+            }
+        };
+
+        NeighborRange(const int* targets, const double* weights, int begin, int end)
+            : targets(targets), weights(weights), first(begin), last(end) {}
+
+        Iterator begin() const { return Iterator(targets + first, weights + first); }
+        Iterator end() const { return Iterator(targets + last, weights + last); }
+
+    private:
+        const int* targets;
+        const double* weights;
+        int first;
+        int last;
+    };
+
+private:
+    // Almacenamiento propio (vacío cuando el grafo está proyectado)
+    DynamicArray<int> offsets;     // node_count + 1 entradas
+    DynamicArray<int> targets;     // Índice interno del destino de cada arista
+    DynamicArray<double> weights;  // Peso de cada arista
+    DynamicArray<int> node_ids;    // Índice interno -> ID externo
+    DynamicArray<double> coord_x;
+    DynamicArray<double> coord_y;
+    DynamicArray<int> name_offsets; // Nombre i = name_chars[name_offsets[i], name_offsets[i + 1])
+    DynamicArray<char> name_chars;
+    HashIndex id_index;            // ID externo -> índice interno
+    MappedFile mapping;            // Archivo proyectado (si se abrió con mapFromBinary)
+
+    // Vista de lectura: apunta al almacenamiento propio o al archivo
+    const int* offsets_data;
+    const int* targets_data;
+    const double* weights_data;
+    const int* ids_data;
+    const double* x_data;
+    const double* y_data;
+    const int* name_offsets_data;
+    const char* name_data;
+    const int* hash_keys;
+    const int* hash_values;
+    int hash_capacity;
+
+    int node_count;
+    int edge_count;
+
+    // Apuntar la vista al almacenamiento propio
+    void bindOwned();
+
+public:
+    // Constructores
+    CompactGraph();
+    explicit CompactGraph(const Graph& graph);
+    CompactGraph(const CompactGraph& other);
+    CompactGraph& operator=(const CompactGraph& other);
+
+    // Construir la instantánea a partir de las listas de adyacencia actuales
+    void build(const Graph& graph);
+
+    // Construir directamente desde listas de nodos y aristas, sin pasar por
+    // Graph (p. ej. al cargar un CSV). Los IDs deben ser únicos; sources y
+    // destinations son índices internos (posiciones en ids) y los nombres
+    // vienen empaquetados (nombre i = name_chars[name_offsets[i], name_offsets[i + 1])).
+    // Las aristas de cada nodo conservan el orden de entrada. Con varios
+    // hilos, cada uno cuenta los grados de un tramo contiguo de aristas en
+    // un histograma propio (n enteros por hilo), la suma prefija recorre
+    // (nodo, hilo) por rangos de nodos y cada hilo reparte su tramo desde
+    // sus propias posiciones: O(m / hilos + n) por hilo. El resultado no
+    // depende del número de hilos
+    void buildFromEdgeList(const DynamicArray<int>& ids, const DynamicArray<double>& xs,
+                           const DynamicArray<double>& ys, const DynamicArray<int>& node_name_offsets,
+                           const DynamicArray<char>& node_name_chars, const DynamicArray<int>& sources,
+                           const DynamicArray<int>& destinations, const DynamicArray<double>& edge_weights,
+                           int num_threads = 1);
+
+    // Persistencia en el formato binario descrito arriba. mapFromBinary
+    // proyecta el archivo y consulta los datos en su lugar, sin copiarlos
+    bool saveToBinary(const std::string& filename) const;
+    bool mapFromBinary(const std::string& filename);
+    bool isMapped() const;
+
+    // Información general
+    int getNodeCount() const;
+    int getEdgeCount() const;
+    bool hasNode(int node_id) const;
+
+    // Traducción entre IDs externos e índices internos
+    int getNodeIndex(int node_id) const;   // -1 si no existe
+    int getNodeId(int index) const;
+
+    // Coordenadas y nombre por índice interno
+    double getX(int index) const;
+    double getY(int index) const;
+    std::string getName(int index) const;
+
+    // Rango de aristas salientes del nodo 'index': [edgesBegin, edgesEnd)
+    int edgesBegin(int index) const;
+    int edgesEnd(int index) const;
+    int getTarget(int edge) const;
+    double getWeight(int edge) const;
+
+    // Las mismas aristas como rango (for (auto arc : graph.neighbors(i)) ...)
+    NeighborRange neighbors(int index) const;
+
+    // Peso de la primera arista index -> target_index (-1.0 si no existe)
+    double getEdgeWeight(int index, int target_index) const;
+
+    // Memoria ocupada por los arrays CSR (bytes)
+    size_t getMemoryUsage() const;
+};
+
+// Accesores usados en los bucles de relajación: se definen inline para que el
+// compilador pueda eliminar la llamada en cada arista
+inline int CompactGraph::getNodeCount() const {
+    return node_count;
+}
+
+inline int CompactGraph::getEdgeCount() const {
+    return edge_count;
+}
+
+inline int CompactGraph::getNodeIndex(int node_id) const {
+    return HashIndex::findIn(hash_keys, hash_values, hash_capacity, node_id);
+}
+
+inline int CompactGraph::getNodeId(int index) const {
+    return ids_data[index];
+}
+
+inline double CompactGraph::getX(int index) const {
+    return x_data[index];
+}
+
+inline double CompactGraph::getY(int index) const {
+    return y_data[index];
+}
+
+inline int CompactGraph::edgesBegin(int index) const {
+    return offsets_data[index];
+}
+
+inline int CompactGraph::edgesEnd(int index) const {
+    return offsets_data[index + 1];
+}
+
+inline int CompactGraph::getTarget(int edge) const {
+    return targets_data[edge];
+}
+
+inline double CompactGraph::getWeight(int edge) const {
+    return weights_data[edge];
+}
+
+inline CompactGraph::NeighborRange CompactGraph::neighbors(int index) const {
+    return NeighborRange(targets_data, weights_data, offsets_data[index], offsets_data[index + 1]);
+}
+
+#endif // COMPACT_GRAPH_H
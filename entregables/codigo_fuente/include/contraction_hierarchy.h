@@ -0,0 +1,94 @@
+#ifndef CONTRACTION_HIERARCHY_H
+#define CONTRACTION_HIERARCHY_H
+
+#include "graph.h"
+#include "compact_graph.h"
+#include "search_algorithms.h"
+#include "search_workspace.h"
+#include "dynamic_array.h"
+#include "hash_index.h"
+#include <string>
+#include <cstddef>
+
+// Contraction Hierarchies (CH).
+//
+// Preprocesamiento: los nodos se contraen uno a uno en orden de importancia
+// creciente (diferencia de aristas + vecinos ya contraídos, con
+// actualización perezosa). Al contraer v, para cada par u -> v -> x se busca
+// un camino testigo u -> x que no pase por v y no sea más largo; si no
+// existe se agrega el atajo u -> x con 'v' como nodo intermedio.
+//
+// Consulta: Dijkstra bidireccional que solo sube en el orden de contracción
+// (hacia adelante por el grafo "up", hacia atrás por el "down"), con
+// stall-on-demand para no expandir nodos alcanzados por un camino subóptimo.
+// Los atajos del camino encontrado se desempaquetan a aristas originales.
+//
+// Los nodos se identifican internamente por el índice de CompactGraph; las
+// consultas reciben y retornan IDs externos, como SearchAlgorithms.
+class ContractionHierarchy {
+private:
+    // Límite de nodos asentados por búsqueda de testigos: si se alcanza, se
+    // agrega el atajo por precaución (nunca produce caminos incorrectos).
+    // Al solo estimar prioridades se usa un límite menor.
+    enum { WITNESS_SETTLE_LIMIT = 500, SIMULATION_SETTLE_LIMIT = 50 };
+
+    int node_count;
+    DynamicArray<int> node_ids;       // Índice interno -> ID externo
+    HashIndex id_index;               // ID externo -> índice interno
+    DynamicArray<int> rank;           // Posición de cada nodo en el orden de contracción
+
+    // Grafo "up": aristas u -> x con rank(x) > rank(u), agrupadas por u
+    DynamicArray<int> up_offsets;
+    DynamicArray<int> up_targets;
+    DynamicArray<double> up_weights;
+    DynamicArray<int> up_middle;      // Nodo intermedio del atajo (-1 si es original)
+
+    // Grafo "down": aristas u -> x con rank(u) > rank(x), agrupadas por x.
+    // La búsqueda hacia atrás las recorre de x a u.
+    DynamicArray<int> down_offsets;
+    DynamicArray<int> down_sources;
+    DynamicArray<double> down_weights;
+    DynamicArray<int> down_middle;
+
+    int shortcut_count;
+    double preprocessing_ms;
+
+    // Workspaces de la consulta sin workspaces explícitos
+    SearchWorkspace forward_workspace;
+    SearchWorkspace backward_workspace;
+
+    // Nodo intermedio de la arista u -> x de la jerarquía (-2 si no existe)
+    int findMiddle(int u, int x) const;
+    // Agregar a 'path' los nodos de la arista u -> x desempaquetada (sin u)
+    void unpackEdge(int u, int x, DynamicArray<int>& path) const;
+
+public:
+    // Constructor
+    ContractionHierarchy();
+
+    // Preprocesamiento
+    void build(const CompactGraph& graph);
+    void build(const Graph& graph);
+
+    // Consulta punto a punto (IDs externos). La versión const permite
+    // consultas concurrentes con un par de workspaces por hilo.
+    SearchResult query(int start, int goal);
+    SearchResult query(int start, int goal, SearchWorkspace& forward_ws,
+                       SearchWorkspace& backward_ws) const;
+
+    // Persistencia junto al archivo binario del grafo
+    bool saveToBinary(const std::string& filename) const;
+    bool loadFromBinary(const std::string& filename);
+    static std::string hierarchyFileFor(const std::string& graph_filename);
+
+    // Información
+    bool isEmpty() const;
+    int getNodeCount() const;
+    int getEdgeCount() const;        // Aristas up + down (incluye atajos)
+    int getShortcutCount() const;
+    int getRank(int index) const;
+    double getPreprocessingTime() const;  // ms
+    size_t getMemoryUsage() const;        // bytes
+};
+
+#endif // CONTRACTION_HIERARCHY_H
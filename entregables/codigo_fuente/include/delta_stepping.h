@@ -0,0 +1,65 @@
+#ifndef DELTA_STEPPING_H
+#define DELTA_STEPPING_H
+
+#include "compact_graph.h"
+#include "dynamic_array.h"
+
+// Caminos mínimos desde un origen a todos los nodos (SSSP) con
+// delta-stepping (Meyer y Sanders), en paralelo sobre un CompactGraph.
+//
+// Los nodos se agrupan en cubetas por distancia tentativa: la cubeta i
+// contiene las distancias en [i * delta, (i + 1) * delta). Se procesa la
+// menor cubeta no vacía en fases: en cada fase se relajan las aristas
+// livianas (peso <= delta) de todos sus nodos, lo que puede volver a
+// llenarla, y cuando queda vacía se relajan una sola vez las aristas
+// pesadas de los nodos que pasaron por ella. Los nodos de una cubeta se
+// procesan en paralelo. Como las distancias pendientes nunca superan la
+// cubeta actual en más del peso máximo, las cubetas se guardan en un
+// arreglo cíclico de unas peso_máximo / delta posiciones.
+//
+// Cada nodo tiene un hilo dueño (bloques de 64 índices repartidos en
+// forma cíclica). Una fase tiene dos pasos separados por una barrera: cada
+// hilo relaja las aristas de sus nodos y deja las solicitudes (destino,
+// distancia, padre) en un buffer por hilo dueño del destino; luego cada
+// dueño aplica las solicitudes de sus nodos. Así ningún nodo se escribe
+// desde dos hilos y no hacen falta operaciones atómicas. Entre distancias
+// iguales se elige el padre de menor índice, por lo que distancias y padres
+// no dependen del número de hilos.
+class DeltaStepping {
+private:
+    const CompactGraph* graph;
+    double delta;          // <= 0: se elige con autoDelta en cada ejecución
+    double last_delta;
+    int bucket_count;      // Cubetas procesadas en la última ejecución
+    int phase_count;       // Fases (livianas y pesadas) de la última ejecución
+
+public:
+    // Constructor
+    explicit DeltaStepping(const CompactGraph* graph);
+
+    // Ancho de las cubetas (0 = automático). Un delta menor que el peso
+    // máximo / 2^16 se ensancha hasta ese valor para acotar las cubetas
+    // (getLastDelta informa el usado)
+    void setDelta(double delta);
+
+    // Delta según la distribución de pesos: el mayor entre el peso promedio
+    // y el peso máximo dividido por el grado promedio. Con cubetas más
+    // angostas hay pocas relajaciones repetidas pero también poco trabajo
+    // por fase; con cubetas más anchas ocurre lo contrario
+    static double autoDelta(const CompactGraph& graph);
+
+    // Distancias y padres desde 'source' (ID externo) a todos los nodos,
+    // indexados por índice interno del CSR. distances[i] es infinito si el
+    // nodo no es alcanzable; parents[i] es el índice interno del padre en el
+    // árbol de caminos mínimos (-1 para el origen y los inalcanzables).
+    // Con pesos positivos los padres forman un árbol. Retorna false si el
+    // origen no existe
+    bool run(int source, DynamicArray<double>& distances, DynamicArray<int>& parents, int num_threads = 1);
+
+    // Estadísticas de la última ejecución
+    double getLastDelta() const;
+    int getBucketCount() const;
+    int getPhaseCount() const;
+};
+
+#endif // DELTA_STEPPING_H
@@ -1,42 +1,69 @@
 #ifndef DYNAMIC_ARRAY_H
 #define DYNAMIC_ARRAY_H
 
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Array dinámico sobre almacenamiento sin inicializar: solo las posiciones
+// 0..size-1 contienen objetos construidos (con placement new), así que
+// reservar capacidad no construye elementos. Al crecer, la capacidad se
+// duplica y los elementos se mueven (no se copian) al nuevo bloque; para
+// tipos triviales (int, double, bool, punteros...) las copias y los
+// traslados son un memcpy. Se usa std::is_trivial y no
+// std::is_trivially_copyable porque este último no existe antes de GCC 5.
 template<typename T>
 class DynamicArray {
 private:
     T* data;
     int capacity;
     int size;
-    
-    void resize();
-    
+
+    static T* allocate(int count);
+    void reallocate(int new_capacity);
+    void grow();
+    void destroyFrom(int first);
+    void copyFrom(const DynamicArray& other);
+
 public:
-    // Constructor
+    // Constructor (reserva initial_capacity posiciones, sin construirlas)
     DynamicArray(int initial_capacity = 10);
-    
+
     // Destructor
     ~DynamicArray();
-    
+
     // Constructor de copia
     DynamicArray(const DynamicArray& other);
-    
-    // Operador de asignación
+
+    // Constructor de movimiento: toma el bloque de 'other', que queda vacío
+    DynamicArray(DynamicArray&& other);
+
+    // Operadores de asignación
     DynamicArray& operator=(const DynamicArray& other);
-    
+    DynamicArray& operator=(DynamicArray&& other);
+
     // Métodos principales
     void push_back(const T& element);
+    void push_back(T&& element);
+    template<typename... Args>
+    void emplace_back(Args&&... args); // Construye el elemento en su posición
     void pop_back();
     T& at(int index);
     const T& at(int index) const;
     T& operator[](int index);
     const T& operator[](int index) const;
-    
+
+    // Capacidad y tamaño
+    void reserve(int new_capacity);                 // No reduce la capacidad
+    void resize(int new_size, const T& value = T()); // Las posiciones nuevas valen 'value'
+
     // Información del array
     int getSize() const;
     int getCapacity() const;
     bool isEmpty() const;
-    void clear();
-    
+    void clear(); // Destruye los elementos y conserva la capacidad
+
     // Iteradores básicos
     T* begin();
     T* end();
@@ -46,62 +73,155 @@ public:
 
 // Implementación de métodos template
 template<typename T>
-DynamicArray<T>::DynamicArray(int initial_capacity) 
-    : capacity(initial_capacity), size(0) {
-    data = new T[capacity];
+T* DynamicArray<T>::allocate(int count) {
+    return count > 0 ? static_cast<T*>(::operator new(sizeof(T) * static_cast<size_t>(count))) : nullptr;
 }
 
+// Mover los elementos a un bloque de new_capacity posiciones (>= size)
 template<typename T>
-DynamicArray<T>::~DynamicArray() {
-    delete[] data;
+void DynamicArray<T>::reallocate(int new_capacity) {
+    T* new_data = allocate(new_capacity);
+    if (std::is_trivial<T>::value) {
+        if (size > 0) {
+            std::memcpy(static_cast<void*>(new_data), static_cast<const void*>(data), sizeof(T) * size);
+        }
+    } else {
+        for (int i = 0; i < size; i++) {
+            new (new_data + i) T(std::move(data[i]));
+            data[i].~T();
+        }
+    }
+    ::operator delete(data);
+    data = new_data;
+    capacity = new_capacity;
 }
 
 template<typename T>
-DynamicArray<T>::DynamicArray(const DynamicArray& other) 
-    : capacity(other.capacity), size(other.size) {
-    data = new T[capacity];
-    for (int i = 0; i < size; i++) {
-        data[i] = other.data[i];
+void DynamicArray<T>::grow() {
+    reallocate(capacity > 0 ? capacity * 2 : 4);
+}
+
+template<typename T>
+void DynamicArray<T>::destroyFrom(int first) {
+    if (!std::is_trivially_destructible<T>::value) {
+        for (int i = first; i < size; i++) {
+            data[i].~T();
+        }
+    }
+    size = first;
+}
+
+// Copiar los elementos de 'other' en este array vacío con capacidad suficiente
+template<typename T>
+void DynamicArray<T>::copyFrom(const DynamicArray& other) {
+    if (std::is_trivial<T>::value) {
+        if (other.size > 0) {
+            std::memcpy(static_cast<void*>(data), static_cast<const void*>(other.data), sizeof(T) * other.size);
+        }
+    } else {
+        for (int i = 0; i < other.size; i++) {
+            new (data + i) T(other.data[i]);
+        }
     }
+    size = other.size;
 }
 
+template<typename T>
+DynamicArray<T>::DynamicArray(int initial_capacity)
+    : data(allocate(initial_capacity)), capacity(initial_capacity > 0 ? initial_capacity : 0), size(0) {}
+
+template<typename T>
+DynamicArray<T>::~DynamicArray() {
+    destroyFrom(0);
+    ::operator delete(data);
+}
+
+template<typename T>
+DynamicArray<T>::DynamicArray(const DynamicArray& other)
+    : data(allocate(other.capacity)), capacity(other.capacity), size(0) {
+    copyFrom(other);
+}
+
+template<typename T>
+DynamicArray<T>::DynamicArray(DynamicArray&& other)
+    : data(other.data), capacity(other.capacity), size(other.size) {
+    other.data = nullptr;
+    other.capacity = 0;
+    other.size = 0;
+}
+
+// Reutiliza el bloque propio si alcanza
 template<typename T>
 DynamicArray<T>& DynamicArray<T>::operator=(const DynamicArray& other) {
     if (this != &other) {
-        delete[] data;
-        capacity = other.capacity;
-        size = other.size;
-        data = new T[capacity];
-        for (int i = 0; i < size; i++) {
-            data[i] = other.data[i];
+        destroyFrom(0);
+        if (capacity < other.size) {
+            ::operator delete(data);
+            data = allocate(other.capacity);
+            capacity = other.capacity;
         }
+        copyFrom(other);
     }
     return *this;
 }
 
 template<typename T>
-void DynamicArray<T>::resize() {
-    capacity *= 2;
-    T* new_data = new T[capacity];
-    for (int i = 0; i < size; i++) {
-        new_data[i] = data[i];
+DynamicArray<T>& DynamicArray<T>::operator=(DynamicArray&& other) {
+    if (this != &other) {
+        destroyFrom(0);
+        ::operator delete(data);
+        data = other.data;
+        capacity = other.capacity;
+        size = other.size;
+        other.data = nullptr;
+        other.capacity = 0;
+        other.size = 0;
     }
-    delete[] data;
-    data = new_data;
+    return *this;
 }
 
+// Si hay que crecer, el elemento se copia antes: puede pertenecer a este array
 template<typename T>
 void DynamicArray<T>::push_back(const T& element) {
     if (size >= capacity) {
-        resize();
+        T copy(element);
+        grow();
+        new (data + size) T(std::move(copy));
+    } else {
+        new (data + size) T(element);
+    }
+    size++;
+}
+
+template<typename T>
+void DynamicArray<T>::push_back(T&& element) {
+    if (size >= capacity) {
+        T moved(std::move(element));
+        grow();
+        new (data + size) T(std::move(moved));
+    } else {
+        new (data + size) T(std::move(element));
     }
-    data[size++] = element;
+    size++;
+}
+
+template<typename T>
+template<typename... Args>
+void DynamicArray<T>::emplace_back(Args&&... args) {
+    if (size >= capacity) {
+        T element(std::forward<Args>(args)...);
+        grow();
+        new (data + size) T(std::move(element));
+    } else {
+        new (data + size) T(std::forward<Args>(args)...);
+    }
+    size++;
 }
 
 template<typename T>
 void DynamicArray<T>::pop_back() {
     if (size > 0) {
-        size--;
+        destroyFrom(size - 1);
     }
 }
 
@@ -131,6 +251,34 @@ const T& DynamicArray<T>::operator[](int index) const {
     return data[index];
 }
 
+template<typename T>
+void DynamicArray<T>::reserve(int new_capacity) {
+    if (new_capacity > capacity) {
+        reallocate(new_capacity);
+    }
+}
+
+// Una sola reserva y un relleno, en lugar de new_size - size push_back
+template<typename T>
+void DynamicArray<T>::resize(int new_size, const T& value) {
+    if (new_size <= size) {
+        destroyFrom(new_size > 0 ? new_size : 0);
+        return;
+    }
+    if (new_size > capacity) {
+        T copy(value);
+        reallocate(new_size);
+        for (int i = size; i < new_size; i++) {
+            new (data + i) T(copy);
+        }
+    } else {
+        for (int i = size; i < new_size; i++) {
+            new (data + i) T(value);
+        }
+    }
+    size = new_size;
+}
+
 template<typename T>
 int DynamicArray<T>::getSize() const {
     return size;
@@ -148,7 +296,7 @@ bool DynamicArray<T>::isEmpty() const {
 
 template<typename T>
 void DynamicArray<T>::clear() {
-    size = 0;
+    destroyFrom(0);
 }
 
 template<typename T>
@@ -172,4 +320,3 @@ const T* DynamicArray<T>::end() const {
 }
 
 #endif // DYNAMIC_ARRAY_H
-
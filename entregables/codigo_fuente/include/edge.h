@@ -6,6 +6,8 @@ private:
     int source;      // ID del nodo origen
     int destination; // ID del nodo destino
     double weight;   // Peso de la arista (distancia, tiempo, etc.)
+    int source_index;      // Índices internos de los extremos en el Graph
+    int destination_index; // que la contiene (-1 hasta que se agrega)
     
 public:
     // Constructor por defecto
@@ -18,9 +20,12 @@ public:
     int getSource() const;
     int getDestination() const;
     double getWeight() const;
+    int getSourceIndex() const;
+    int getDestinationIndex() const;
     
     // Setters
     void setWeight(double weight);
+    void setIndices(int source_index, int destination_index); // Lo usa Graph al insertar
     
     // Operadores de comparación
     bool operator==(const Edge& other) const;
@@ -5,42 +5,113 @@
 #include "edge.h"
 #include "dynamic_array.h"
 #include "linked_list.h"
+#include "hash_index.h"
+#include "kd_tree.h"
+#include "node_pool.h"
 #include <string>
 
+// Lista de aristas de un nodo. Los nodos de todas las listas de un Graph
+// salen de un mismo NodePool
+typedef LinkedList<Edge, PoolNodeAllocator> EdgeList;
+
+// Cada nodo recibe al agregarse un índice interno denso (0..n-1, en orden
+// de inserción: su posición en getAllNodes()), independiente de su ID
+// externo, que puede ser cualquier entero. Las aristas guardan los IDs y
+// también los índices de sus extremos, de modo que los algoritmos pueden
+// indexar arrays de tamaño n y recorrer vecinos con getAdjacenciesAt sin
+// buscar en el índice hash. getNodeIndex/getNodeId traducen entre ambos.
+//
+// Las operaciones const no modifican estado compartido y pueden llamarse
+// desde varios hilos a la vez (p. ej. QueryExecutor), siempre que nadie
+// modifique el grafo mientras tanto. La única excepción es el índice
+// espacial, que se construye bajo demanda (ver buildSpatialIndex).
+//
+// Las aristas (salientes y entrantes) viven en edge_pool: agregar una
+// arista no llama a malloc salvo cada slots_per_chunk aristas, y clear() y
+// el destructor liberan todas de una vez en lugar de nodo por nodo.
 class Graph {
 private:
+    // Declarado antes que las listas: debe destruirse después que ellas
+    NodePool edge_pool;
+    
     DynamicArray<Node> nodes;
-    DynamicArray<LinkedList<Edge>> adjacency_list;
+    DynamicArray<EdgeList> adjacency_list;
+    DynamicArray<EdgeList> reverse_adjacency_list; // Aristas entrantes, por destino
     int node_count;
     int edge_count;
     
+    // Lista retornada por getAdjacencies/getIncomingEdges para IDs
+    // inexistentes (miembro de solo lectura en lugar de un static local)
+    EdgeList empty_edges;
+    
+    // Índice hash ID -> posición en 'nodes' (búsqueda O(1) esperada)
+    HashIndex node_index;
+    
+    // Índice espacial sobre las coordenadas (posiciones en 'nodes'). Se
+    // construye en la primera consulta por coordenadas y se descarta al
+    // agregar nodos
+    mutable KdTree spatial_index;
+    mutable bool spatial_index_valid;
+    
     // Función auxiliar para encontrar el índice de un nodo por ID
     int findNodeIndex(int node_id) const;
     
+    // No copiable: las listas apuntan al edge_pool de este grafo (para
+    // copiar con otro orden de nodos, ver NodeReordering::apply)
+    Graph(const Graph&) = delete;
+    Graph& operator=(const Graph&) = delete;
+    
 public:
     // Constructor
     Graph();
     
-    // Destructor
-    ~Graph() = default;
+    // Destructor: libera las aristas en bloque
+    ~Graph();
     
-    // Métodos para agregar nodos y aristas
-    void addNode(const Node& node);
-    void addEdge(const Edge& edge);
-    void addEdge(int source, int destination, double weight = 1.0);
+    // Métodos para agregar nodos y aristas. Retornan false si no se agregó
+    // (ID de nodo repetido o igual a INT_MIN, que HashIndex reserva, o
+    // extremo de la arista inexistente)
+    bool addNode(const Node& node);
+    bool addEdge(const Edge& edge);
+    bool addEdge(int source, int destination, double weight = 1.0);
+    bool addEdgeAt(int source_index, int destination_index, double weight = 1.0); // Por índices internos
+    
+    // Reservar espacio para 'node_capacity' nodos (carga masiva sin
+    // redimensionar los arrays ni el índice hash)
+    void reserve(int node_capacity);
     
     // Métodos para obtener información
     int getNodeCount() const;
+    
+    // Traducción entre IDs externos e índices internos
+    int getNodeIndex(int node_id) const; // Posición del nodo en getAllNodes(), -1 si no existe
+    int getNodeId(int index) const;      // -1 si el índice está fuera de rango
+    
     int getEdgeCount() const;
     Node* getNode(int node_id);
     const Node* getNode(int node_id) const;
     Node* getNodeByName(const std::string& name);
     const Node* getNodeByName(const std::string& name) const;
     
+    // Búsqueda de nodos por coordenadas (retornan IDs). El índice se
+    // construye bajo demanda; si se modifican coordenadas con setCoordinates
+    // o se consulta desde varios hilos, llamar antes a buildSpatialIndex()
+    void buildSpatialIndex() const;
+    const KdTree& getSpatialIndex() const;
+    int findNearestNode(double x, double y) const;       // -1 si el grafo está vacío
+    int findNearestNodes(double x, double y, int k, DynamicArray<int>& node_ids) const;
+    int findNodesInRadius(double x, double y, double radius, DynamicArray<int>& node_ids) const;
+    
     // Métodos para obtener vecinos
-    const LinkedList<Edge>& getAdjacencies(int node_id) const;
+    const EdgeList& getAdjacencies(int node_id) const;
+    const EdgeList& getIncomingEdges(int node_id) const; // Aristas u -> node_id
     DynamicArray<int> getNeighbors(int node_id) const;
     
+    // Lo mismo por índice interno (sin búsqueda hash; índice válido)
+    const Node& getNodeAt(int index) const;
+    const EdgeList& getAdjacenciesAt(int index) const;
+    const EdgeList& getIncomingEdgesAt(int index) const;
+    
     // Métodos para verificar existencia
     bool hasNode(int node_id) const;
     bool hasEdge(int source, int destination) const;
@@ -48,9 +119,12 @@ public:
     // Métodos para obtener peso de arista
     double getEdgeWeight(int source, int destination) const;
     
-    // Método para limpiar el grafo
+    // Método para limpiar el grafo (las aristas se liberan en bloque)
     void clear();
     
+    // Memoria reservada para aristas (bloques de edge_pool)
+    size_t getEdgeMemoryBytes() const;
+    
     // Método para obtener todos los nodos
     const DynamicArray<Node>& getAllNodes() const;
     
@@ -58,5 +132,18 @@ public:
     void printGraph() const;
 };
 
+// Accesores por índice usados en los bucles de relajación
+inline const Node& Graph::getNodeAt(int index) const {
+    return nodes[index];
+}
+
+inline const EdgeList& Graph::getAdjacenciesAt(int index) const {
+    return adjacency_list[index];
+}
+
+inline const EdgeList& Graph::getIncomingEdgesAt(int index) const {
+    return reverse_adjacency_list[index];
+}
+
 #endif // GRAPH_H
 
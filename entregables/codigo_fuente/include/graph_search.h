@@ -0,0 +1,455 @@
+#ifndef GRAPH_SEARCH_H
+#define GRAPH_SEARCH_H
+
+#include "graph.h"
+#include "search_algorithms.h"
+#include "search_workspace.h"
+#include "indexed_priority_queue.h"
+#include "ring_queue.h"
+#include "priority_queue.h"
+#include <chrono>
+#include <cmath>
+
+// Los cinco algoritmos de búsqueda básicos (DFS, BFS, Dijkstra, Best First y
+// A*) escritos una sola vez para cualquier representación de grafo que
+// ofrezca esta interfaz (la de CompactGraph, ImplicitGridGraph y
+// GraphAdjacencyView):
+//
+//   int getNodeCount() const;                  índices internos 0..n-1
+//   int getNodeIndex(int node_id) const;       -1 si el ID no existe
+//   int getNodeId(int index) const;
+//   double getX(int index) const;  double getY(int index) const;
+//   double getEdgeWeight(int index, int target_index) const;
+//   Rango neighbors(int index) const;          elementos con .target (índice) y .weight
+//
+// La heurística (Best First y A*) y la cola de prioridad (Dijkstra y A*)
+// también son parámetros de plantilla (políticas, ver abajo). Todo se
+// resuelve en compilación, así que la iteración de vecinos y la heurística
+// pueden expandirse inline en el bucle de relajación.
+// El workspace se indexa por índice interno; 'start', 'goal' y el camino
+// retornado son IDs externos.
+
+// ===== Vista de Graph =====
+// Adapta las listas de adyacencia de Graph a la interfaz anterior usando
+// sus índices internos: las aristas ya guardan el índice del destino, así
+// que recorrer vecinos no consulta el índice hash.
+class GraphAdjacencyView {
+public:
+    struct Arc {
+        int target;
+        double weight;
+    };
+
+    class NeighborRange {
+    public:
+        class Iterator {
+        private:
+            EdgeList::Iterator current;
+
+        public:
+            explicit Iterator(EdgeList::Iterator current) : current(current) {}
+
+            Arc operator*() const {
+                const Edge& edge = *current;
+                Arc arc = {edge.getDestinationIndex(), edge.getWeight()};
+                return arc;
+            }
+
+            Iterator& operator++() {
+                ++current;
+                return *this;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return current != other.current;
+            }
+        };
+
+        explicit NeighborRange(const EdgeList& edges) : edges(&edges) {}
+
+        Iterator begin() const { return Iterator(edges->begin()); }
+        Iterator end() const { return Iterator(edges->end()); }
+
+    private:
+        const EdgeList* edges;
+    };
+
+    explicit GraphAdjacencyView(const Graph* graph) : graph(graph) {}
+
+    int getNodeCount() const { return graph->getNodeCount(); }
+    int getNodeIndex(int node_id) const { return graph->getNodeIndex(node_id); }
+    int getNodeId(int index) const { return graph->getNodeId(index); }
+    double getX(int index) const { return graph->getNodeAt(index).getX(); }
+    double getY(int index) const { return graph->getNodeAt(index).getY(); }
+    NeighborRange neighbors(int index) const { return NeighborRange(graph->getAdjacenciesAt(index)); }
+
+    double getEdgeWeight(int index, int target_index) const {
+        for (auto arc : neighbors(index)) {
+            if (arc.target == target_index) {
+                return arc.weight;
+            }
+        }
+        return -1.0;
+    }
+
+private:
+    const Graph* graph;
+};
+
+// ===== Políticas de heurística =====
+// Se construyen una vez por búsqueda con el destino (así guardan sus
+// coordenadas) y estiman el costo restante desde un índice.
+
+// Distancia euclidiana: admisible si ninguna arista es más corta que la
+// recta entre sus extremos (la usada por SearchAlgorithms)
+struct EuclideanHeuristic {
+    double goal_x;
+    double goal_y;
+
+    template <typename GraphType>
+    EuclideanHeuristic(const GraphType& graph, int goal_index)
+        : goal_x(graph.getX(goal_index)), goal_y(graph.getY(goal_index)) {}
+
+    template <typename GraphType>
+    double estimate(const GraphType& graph, int index) const {
+        double dx = graph.getX(index) - goal_x;
+        double dy = graph.getY(index) - goal_y;
+        return std::sqrt(dx * dx + dy * dy);
+    }
+};
+
+// Distancia Manhattan: más ajustada (y admisible) en cuadrículas
+// 4-conectadas cuyo peso es el espaciado entre celdas
+struct ManhattanHeuristic {
+    double goal_x;
+    double goal_y;
+
+    template <typename GraphType>
+    ManhattanHeuristic(const GraphType& graph, int goal_index)
+        : goal_x(graph.getX(goal_index)), goal_y(graph.getY(goal_index)) {}
+
+    template <typename GraphType>
+    double estimate(const GraphType& graph, int index) const {
+        return std::abs(graph.getX(index) - goal_x) + std::abs(graph.getY(index) - goal_y);
+    }
+};
+
+// Sin heurística: A* se comporta como Dijkstra
+struct ZeroHeuristic {
+    template <typename GraphType>
+    ZeroHeuristic(const GraphType&, int) {}
+
+    template <typename GraphType>
+    double estimate(const GraphType&, int) const {
+        return 0.0;
+    }
+};
+
+// ===== Políticas de cola =====
+// Indican qué heap indexado usan Dijkstra y A*.
+
+// El SearchHeap del workspace (aridad SEARCH_HEAP_ARITY), sin memoria extra
+struct WorkspaceHeapQueue {
+    typedef SearchHeap Heap;
+    struct Storage {};
+
+    static Heap& acquire(SearchWorkspace& ws, Storage&, int) {
+        return ws.getHeap();
+    }
+};
+
+// Un heap propio de GraphSearch con otra aridad (se conserva entre búsquedas)
+template <int Arity>
+struct IndexedHeapQueue {
+    typedef IndexedPriorityQueue<double, Arity> Heap;
+    typedef Heap Storage;
+
+    static Heap& acquire(SearchWorkspace&, Storage& heap, int node_count) {
+        if (heap.getCapacity() < node_count) {
+            heap.reset(node_count);
+        } else {
+            heap.clear();
+        }
+        return heap;
+    }
+};
+
+template <typename GraphType, typename Heuristic = EuclideanHeuristic, typename QueuePolicy = WorkspaceHeapQueue>
+class GraphSearch {
+private:
+    const GraphType* graph;
+    typename QueuePolicy::Storage queue_storage;
+
+    void finishResult(SearchResult& result, const SearchWorkspace& ws,
+                      int start_index, int goal_index, bool sum_edge_weights) const;
+    static void finishTiming(SearchResult& result,
+                             std::chrono::high_resolution_clock::time_point start_time);
+
+public:
+    explicit GraphSearch(const GraphType* graph);
+
+    SearchResult depthFirstSearch(int start, int goal, SearchWorkspace& ws) const;
+    SearchResult breadthFirstSearch(int start, int goal, SearchWorkspace& ws) const;
+    SearchResult dijkstra(int start, int goal, SearchWorkspace& ws);
+    SearchResult bestFirstSearch(int start, int goal, SearchWorkspace& ws) const;
+    SearchResult aStar(int start, int goal, SearchWorkspace& ws);
+};
+
+template <typename GraphType, typename Heuristic, typename QueuePolicy>
+GraphSearch<GraphType, Heuristic, QueuePolicy>::GraphSearch(const GraphType* graph) : graph(graph) {}
+
+// Camino en IDs a partir de los padres del workspace y, si se pide, su costo
+template <typename GraphType, typename Heuristic, typename QueuePolicy>
+void GraphSearch<GraphType, Heuristic, QueuePolicy>::finishResult(SearchResult& result, const SearchWorkspace& ws,
+                                                                  int start_index, int goal_index,
+                                                                  bool sum_edge_weights) const {
+    DynamicArray<int> reversed;
+    for (int current = goal_index; current != -1; current = ws.getParent(current)) {
+        reversed.push_back(current);
+        if (current == start_index) break;
+    }
+
+    result.path_found = true;
+    result.path = DynamicArray<int>(reversed.getSize());
+    for (int i = reversed.getSize() - 1; i >= 0; i--) {
+        result.path.push_back(graph->getNodeId(reversed[i]));
+    }
+
+    if (sum_edge_weights) {
+        result.total_distance = 0.0;
+        for (int i = reversed.getSize() - 1; i > 0; i--) {
+            result.total_distance += graph->getEdgeWeight(reversed[i], reversed[i - 1]);
+        }
+    }
+}
+
+template <typename GraphType, typename Heuristic, typename QueuePolicy>
+void GraphSearch<GraphType, Heuristic, QueuePolicy>::finishTiming(SearchResult& result,
+                                                                  std::chrono::high_resolution_clock::time_point start_time) {
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+}
+
+template <typename GraphType, typename Heuristic, typename QueuePolicy>
+SearchResult GraphSearch<GraphType, Heuristic, QueuePolicy>::depthFirstSearch(int start, int goal, SearchWorkspace& ws) const {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    SearchResult result;
+
+    int start_index = graph->getNodeIndex(start);
+    int goal_index = graph->getNodeIndex(goal);
+    if (start_index == -1 || goal_index == -1) {
+        return result;
+    }
+
+    ws.prepare(graph->getNodeCount());
+    DynamicArray<int>& stack = ws.getFrontier();
+    stack.push_back(start_index);
+    int nodes_explored = 0;
+
+    while (!stack.isEmpty()) {
+        int current = stack[stack.getSize() - 1];
+        stack.pop_back();
+
+        if (ws.isVisited(current)) continue;
+
+        ws.setVisited(current);
+        nodes_explored++;
+
+        if (current == goal_index) {
+            finishResult(result, ws, start_index, goal_index, true);
+            break;
+        }
+
+        for (auto arc : graph->neighbors(current)) {
+            if (!ws.isVisited(arc.target)) {
+                ws.setParent(arc.target, current);
+                stack.push_back(arc.target);
+            }
+        }
+    }
+
+    result.nodes_explored = nodes_explored;
+    finishTiming(result, start_time);
+    return result;
+}
+
+template <typename GraphType, typename Heuristic, typename QueuePolicy>
+SearchResult GraphSearch<GraphType, Heuristic, QueuePolicy>::breadthFirstSearch(int start, int goal, SearchWorkspace& ws) const {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    SearchResult result;
+
+    int start_index = graph->getNodeIndex(start);
+    int goal_index = graph->getNodeIndex(goal);
+    if (start_index == -1 || goal_index == -1) {
+        return result;
+    }
+
+    ws.prepare(graph->getNodeCount());
+    // Buffer circular: crece por duplicación según la frontera. No se
+    // reserva graph->getNodeCount() de entrada porque las consultas cortas
+    // sobre grafos grandes pagarían un buffer de n enteros
+    RingQueue<int> queue;
+    queue.enqueue(start_index);
+    ws.setVisited(start_index);
+    int nodes_explored = 0;
+
+    while (!queue.isEmpty()) {
+        int current = queue.front();
+        queue.dequeue();
+        nodes_explored++;
+
+        if (current == goal_index) {
+            finishResult(result, ws, start_index, goal_index, true);
+            break;
+        }
+
+        for (auto arc : graph->neighbors(current)) {
+            if (!ws.isVisited(arc.target)) {
+                ws.setVisited(arc.target);
+                ws.setParent(arc.target, current);
+                queue.enqueue(arc.target);
+            }
+        }
+    }
+
+    result.nodes_explored = nodes_explored;
+    finishTiming(result, start_time);
+    return result;
+}
+
+template <typename GraphType, typename Heuristic, typename QueuePolicy>
+SearchResult GraphSearch<GraphType, Heuristic, QueuePolicy>::dijkstra(int start, int goal, SearchWorkspace& ws) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    SearchResult result;
+
+    int start_index = graph->getNodeIndex(start);
+    int goal_index = graph->getNodeIndex(goal);
+    if (start_index == -1 || goal_index == -1) {
+        return result;
+    }
+
+    ws.prepare(graph->getNodeCount());
+    typename QueuePolicy::Heap& pq = QueuePolicy::acquire(ws, queue_storage, graph->getNodeCount());
+    ws.setDistance(start_index, 0.0);
+    pq.push(start_index, 0.0);
+    int nodes_explored = 0;
+
+    while (!pq.isEmpty()) {
+        int u = pq.top();
+        pq.pop();
+
+        ws.setVisited(u);
+        nodes_explored++;
+
+        if (u == goal_index) {
+            finishResult(result, ws, start_index, goal_index, false);
+            result.total_distance = ws.getDistance(goal_index);
+            break;
+        }
+
+        double du = ws.getDistance(u);
+        for (auto arc : graph->neighbors(u)) {
+            double new_distance = du + arc.weight;
+            if (!ws.isVisited(arc.target) && new_distance < ws.getDistance(arc.target)) {
+                ws.setDistance(arc.target, new_distance);
+                ws.setParent(arc.target, u);
+                pq.pushOrDecrease(arc.target, new_distance);
+            }
+        }
+    }
+
+    result.nodes_explored = nodes_explored;
+    finishTiming(result, start_time);
+    return result;
+}
+
+template <typename GraphType, typename Heuristic, typename QueuePolicy>
+SearchResult GraphSearch<GraphType, Heuristic, QueuePolicy>::bestFirstSearch(int start, int goal, SearchWorkspace& ws) const {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    SearchResult result;
+
+    int start_index = graph->getNodeIndex(start);
+    int goal_index = graph->getNodeIndex(goal);
+    if (start_index == -1 || goal_index == -1) {
+        return result;
+    }
+
+    ws.prepare(graph->getNodeCount());
+    PriorityQueue<AStarNode> pq;
+    Heuristic heuristic(*graph, goal_index);
+    pq.push(AStarNode(start_index, 0.0, heuristic.estimate(*graph, start_index), -1));
+    int nodes_explored = 0;
+
+    while (!pq.isEmpty()) {
+        AStarNode current = pq.top();
+        pq.pop();
+
+        if (ws.isVisited(current.node_id)) continue;
+
+        ws.setVisited(current.node_id);
+        ws.setParent(current.node_id, current.parent);
+        nodes_explored++;
+
+        if (current.node_id == goal_index) {
+            finishResult(result, ws, start_index, goal_index, true);
+            break;
+        }
+
+        for (auto arc : graph->neighbors(current.node_id)) {
+            if (!ws.isVisited(arc.target)) {
+                pq.push(AStarNode(arc.target, 0.0, heuristic.estimate(*graph, arc.target), current.node_id));
+            }
+        }
+    }
+
+    result.nodes_explored = nodes_explored;
+    finishTiming(result, start_time);
+    return result;
+}
+
+template <typename GraphType, typename Heuristic, typename QueuePolicy>
+SearchResult GraphSearch<GraphType, Heuristic, QueuePolicy>::aStar(int start, int goal, SearchWorkspace& ws) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    SearchResult result;
+
+    int start_index = graph->getNodeIndex(start);
+    int goal_index = graph->getNodeIndex(goal);
+    if (start_index == -1 || goal_index == -1) {
+        return result;
+    }
+
+    ws.prepare(graph->getNodeCount());
+    typename QueuePolicy::Heap& open_set = QueuePolicy::acquire(ws, queue_storage, graph->getNodeCount());
+    Heuristic heuristic(*graph, goal_index);
+    ws.setDistance(start_index, 0.0);
+    open_set.push(start_index, heuristic.estimate(*graph, start_index));
+    int nodes_explored = 0;
+
+    while (!open_set.isEmpty()) {
+        int current = open_set.top();
+        open_set.pop();
+        nodes_explored++;
+
+        if (current == goal_index) {
+            finishResult(result, ws, start_index, goal_index, false);
+            result.total_distance = ws.getDistance(goal_index);
+            break;
+        }
+
+        double g_current = ws.getDistance(current);
+        for (auto arc : graph->neighbors(current)) {
+            double tentative_g = g_current + arc.weight;
+            if (tentative_g < ws.getDistance(arc.target)) {
+                ws.setParent(arc.target, current);
+                ws.setDistance(arc.target, tentative_g);
+                open_set.pushOrDecrease(arc.target, tentative_g + heuristic.estimate(*graph, arc.target));
+            }
+        }
+    }
+
+    result.nodes_explored = nodes_explored;
+    finishTiming(result, start_time);
+    return result;
+}
+
+#endif // GRAPH_SEARCH_H
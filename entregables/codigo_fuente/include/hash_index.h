@@ -0,0 +1,172 @@
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#include "dynamic_array.h"
+#include <climits>
+
+// Tabla hash de direccionamiento abierto (sondeo lineal) que asocia claves
+// enteras (cualquier valor excepto INT_MIN) con índices enteros. Se usa para
+// traducir IDs de nodo a su posición dentro de los arrays del grafo en O(1)
+// esperado.
+class HashIndex {
+public:
+    // Clave reservada para marcar casillas vacías; insert la rechaza
+    enum { EMPTY_KEY = INT_MIN };
+
+private:
+    enum { MIN_CAPACITY = 16 };
+
+    DynamicArray<int> keys;
+    DynamicArray<int> values;
+    int capacity;   // Siempre potencia de 2
+    int size;
+
+    // Funciones auxiliares
+    static int slotFor(int key, int capacity);
+    void allocate(int new_capacity);
+    void rehash(int new_capacity);
+
+public:
+    // Constructor
+    HashIndex(int initial_capacity = MIN_CAPACITY);
+
+    // Métodos principales
+    void insert(int key, int value);
+    int find(int key) const;   // Retorna -1 si la clave no existe
+    bool contains(int key) const;
+
+    // Reservar espacio para al menos 'count' claves sin rehash
+    void reserve(int count);
+
+    // Tablas crudas (capacidad = getCapacity()), para persistirlas tal cual
+    // y consultarlas después sin reconstruir la tabla (ver CompactGraph)
+    const int* getKeyTable() const;
+    const int* getValueTable() const;
+    static int findIn(const int* keys, const int* values, int capacity, int key);
+
+    // Información de la tabla
+    int getSize() const;
+    int getCapacity() const;
+    bool isEmpty() const;
+    void clear();
+};
+
+// Implementación de métodos
+inline HashIndex::HashIndex(int initial_capacity) : capacity(0), size(0) {
+    int cap = MIN_CAPACITY;
+    while (cap < initial_capacity) {
+        cap *= 2;
+    }
+    allocate(cap);
+}
+
+// Hash multiplicativo de Fibonacci: dispersa bien IDs consecutivos
+inline int HashIndex::slotFor(int key, int capacity) {
+    unsigned int hash = static_cast<unsigned int>(key) * 2654435769u;
+    return static_cast<int>(hash & static_cast<unsigned int>(capacity - 1));
+}
+
+inline void HashIndex::allocate(int new_capacity) {
+    keys = DynamicArray<int>(new_capacity);
+    values = DynamicArray<int>(new_capacity);
+    for (int i = 0; i < new_capacity; i++) {
+        keys.push_back(EMPTY_KEY);
+        values.push_back(-1);
+    }
+    capacity = new_capacity;
+    size = 0;
+}
+
+inline void HashIndex::rehash(int new_capacity) {
+    DynamicArray<int> old_keys = keys;
+    DynamicArray<int> old_values = values;
+    int old_capacity = capacity;
+
+    allocate(new_capacity);
+    for (int i = 0; i < old_capacity; i++) {
+        if (old_keys[i] != EMPTY_KEY) {
+            insert(old_keys[i], old_values[i]);
+        }
+    }
+}
+
+inline void HashIndex::insert(int key, int value) {
+    if (key == EMPTY_KEY) {
+        throw "HashIndex key is reserved";
+    }
+
+    // Mantener factor de carga <= 0.5 para sondeos cortos
+    if ((size + 1) * 2 > capacity) {
+        rehash(capacity * 2);
+    }
+
+    int slot = slotFor(key, capacity);
+    while (keys[slot] != EMPTY_KEY) {
+        if (keys[slot] == key) {
+            values[slot] = value;
+            return;
+        }
+        slot = (slot + 1) & (capacity - 1);
+    }
+
+    keys[slot] = key;
+    values[slot] = value;
+    size++;
+}
+
+inline int HashIndex::findIn(const int* keys, const int* values, int capacity, int key) {
+    if (key == EMPTY_KEY) return -1;
+
+    int slot = slotFor(key, capacity);
+    while (keys[slot] != EMPTY_KEY) {
+        if (keys[slot] == key) {
+            return values[slot];
+        }
+        slot = (slot + 1) & (capacity - 1);
+    }
+    return -1;
+}
+
+inline int HashIndex::find(int key) const {
+    return findIn(keys.begin(), values.begin(), capacity, key);
+}
+
+inline bool HashIndex::contains(int key) const {
+    return find(key) != -1;
+}
+
+inline void HashIndex::reserve(int count) {
+    int needed = capacity;
+    while (count * 2 > needed) {
+        needed *= 2;
+    }
+    if (needed != capacity) {
+        rehash(needed);
+    }
+}
+
+inline int HashIndex::getSize() const {
+    return size;
+}
+
+inline int HashIndex::getCapacity() const {
+    return capacity;
+}
+
+inline const int* HashIndex::getKeyTable() const {
+    return keys.begin();
+}
+
+inline const int* HashIndex::getValueTable() const {
+    return values.begin();
+}
+
+inline bool HashIndex::isEmpty() const {
+    return size == 0;
+}
+
+inline void HashIndex::clear() {
+    allocate(MIN_CAPACITY);
+}
+
+#endif // HASH_INDEX_H
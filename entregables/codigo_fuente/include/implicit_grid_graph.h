@@ -0,0 +1,163 @@
+#ifndef IMPLICIT_GRID_GRAPH_H
+#define IMPLICIT_GRID_GRAPH_H
+
+#include "dynamic_array.h"
+#include <cstddef>
+
+// Cuadrícula 4-conectada de width x height celdas descrita solo por sus
+// dimensiones, el espaciado y un conjunto de bits de celdas bloqueadas. La
+// celda (x, y) es el nodo y * width + x, está en (x * spacing, y * spacing)
+// y sus aristas van a las vecinas libres con peso spacing, igual que en
+// LargeGraphGenerator::generateGridGraph. No guarda nodos, nombres ni
+// aristas: todo se calcula al consultarlo, así que una cuadrícula de 2M
+// celdas ocupa 2M bits.
+//
+// Expone la misma interfaz de nodos y vecinos que CompactGraph (índices
+// internos, coordenadas y neighbors(i)), por lo que GraphSearch puede
+// recorrerla con las mismas búsquedas. Índice interno e ID coinciden.
+class ImplicitGridGraph {
+public:
+    // Arista saliente: destino (índice) y peso
+    struct Arc {
+        int target;
+        double weight;
+    };
+
+    // Vecinos de una celda: las direcciones válidas (dentro de la
+    // cuadrícula y libres) se precalculan en una máscara de 4 bits y el
+    // iterador recorre sus bits encendidos
+    class NeighborRange {
+    public:
+        class Iterator {
+        private:
+            int index;
+            int width;
+            unsigned int mask;
+            double weight;
+
+        public:
+            Iterator(int index, int width, unsigned int mask, double weight)
+                : index(index), width(width), mask(mask), weight(weight) {}
+
+            Arc operator*() const {
+                // Bit 0: derecha, 1: izquierda, 2: abajo, 3: arriba
+                int target = (mask & 1u) ? index + 1
+                           : (mask & 2u) ? index - 1
+                           : (mask & 4u) ? index + width
+                                         : index - width;
+                Arc arc = {target, weight};
+                return arc;
+            }
+
+            Iterator& operator++() {
+                mask &= mask - 1;
+                return *this;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return mask != other.mask;
+            }
+        };
+
+        NeighborRange(int index, int width, unsigned int mask, double weight)
+            : index(index), width(width), mask(mask), weight(weight) {}
+
+        Iterator begin() const { return Iterator(index, width, mask, weight); }
+        Iterator end() const { return Iterator(index, width, 0u, weight); }
+
+    private:
+        int index;
+        int width;
+        unsigned int mask;
+        double weight;
+    };
+
+private:
+    int width;
+    int height;
+    double spacing;
+    DynamicArray<unsigned int> blocked_bits; // Vacío mientras no haya celdas bloqueadas
+
+    unsigned int directionMask(int index) const;
+
+public:
+    // Constructor
+    ImplicitGridGraph(int width, int height, double spacing = 1.0);
+
+    // Celdas bloqueadas: siguen siendo nodos, pero sin aristas
+    void setBlocked(int index, bool value = true);
+    bool isBlocked(int index) const;
+    int getBlockedCount() const;
+
+    // Información general
+    int getWidth() const;
+    int getHeight() const;
+    double getSpacing() const;
+    int getNodeCount() const;
+    int getEdgeCount() const;                  // Se cuenta recorriendo las celdas
+    bool hasNode(int node_id) const;
+
+    // Traducción entre IDs e índices (son iguales)
+    int getNodeIndex(int node_id) const;       // -1 si no existe
+    int getNodeId(int index) const;
+
+    // Coordenadas por índice
+    double getX(int index) const;
+    double getY(int index) const;
+
+    // Vecinos del nodo 'index' y peso de index -> target_index (-1.0 si no hay arista)
+    NeighborRange neighbors(int index) const;
+    double getEdgeWeight(int index, int target_index) const;
+
+    // Celda más cercana a un punto (bloqueada o no)
+    int findNearestNode(double x, double y) const;
+
+    // Memoria ocupada (bytes)
+    size_t getMemoryUsage() const;
+};
+
+// Accesores usados en los bucles de relajación, inline como en CompactGraph
+inline bool ImplicitGridGraph::isBlocked(int index) const {
+    return blocked_bits.getSize() > 0 && ((blocked_bits[index >> 5] >> (index & 31)) & 1u) != 0;
+}
+
+inline int ImplicitGridGraph::getNodeCount() const {
+    return width * height;
+}
+
+inline int ImplicitGridGraph::getNodeIndex(int node_id) const {
+    return node_id >= 0 && node_id < width * height ? node_id : -1;
+}
+
+inline int ImplicitGridGraph::getNodeId(int index) const {
+    return index;
+}
+
+inline double ImplicitGridGraph::getX(int index) const {
+    return (index % width) * spacing;
+}
+
+inline double ImplicitGridGraph::getY(int index) const {
+    return (index / width) * spacing;
+}
+
+inline unsigned int ImplicitGridGraph::directionMask(int index) const {
+    int x = index % width;
+    int y = index / width;
+    unsigned int mask = (x + 1 < width ? 1u : 0u) | (x > 0 ? 2u : 0u) |
+                        (y + 1 < height ? 4u : 0u) | (y > 0 ? 8u : 0u);
+    if (blocked_bits.getSize() > 0) {
+        if (isBlocked(index)) return 0u;
+        if ((mask & 1u) && isBlocked(index + 1)) mask &= ~1u;
+        if ((mask & 2u) && isBlocked(index - 1)) mask &= ~2u;
+        if ((mask & 4u) && isBlocked(index + width)) mask &= ~4u;
+        if ((mask & 8u) && isBlocked(index - width)) mask &= ~8u;
+    }
+    return mask;
+}
+
+inline ImplicitGridGraph::NeighborRange ImplicitGridGraph::neighbors(int index) const {
+    return NeighborRange(index, width, directionMask(index), spacing);
+}
+
+#endif // IMPLICIT_GRID_GRAPH_H
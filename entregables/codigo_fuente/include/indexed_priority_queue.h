@@ -0,0 +1,240 @@
+#ifndef INDEXED_PRIORITY_QUEUE_H
+#define INDEXED_PRIORITY_QUEUE_H
+
+#include "dynamic_array.h"
+
+// Heap d-ario indexado (min-heap) cuyos elementos son índices densos
+// 0..capacity-1 (por ejemplo, índices de nodo). Cada índice aparece a lo sumo
+// una vez, lo que permite decreaseKey en O(log_d n) en lugar de insertar
+// entradas duplicadas. La aridad (2, 4 u 8) se fija en tiempo de compilación:
+// aridades mayores acortan el árbol y agrupan a los hijos en la misma línea de
+// caché, a cambio de más comparaciones por nivel al bajar.
+template<typename Priority, int Arity = 4>
+class IndexedPriorityQueue {
+private:
+    DynamicArray<int> heap;             // Posición en el heap -> índice
+    DynamicArray<int> positions;        // Índice -> posición en el heap (-1 si no está)
+    DynamicArray<Priority> priorities;  // Índice -> prioridad actual
+    int capacity;
+
+    // Funciones auxiliares para el heap (iterativas, con "hueco": el elemento
+    // que se reubica se mueve una sola vez en lugar de intercambiarse por nivel)
+    void siftUp(int position);
+    void siftDown(int position);
+
+public:
+    // Constructor
+    IndexedPriorityQueue(int capacity = 0);
+
+    // Redimensionar el universo de índices (vacía la cola)
+    void reset(int capacity);
+
+    // Métodos principales
+    void push(int index, const Priority& priority);
+    void decreaseKey(int index, const Priority& priority);
+    bool pushOrDecrease(int index, const Priority& priority); // true si hubo cambio
+    void changePriority(int index, const Priority& priority);  // Sube o baja según el caso
+    void pop();
+    int top() const;
+    const Priority& topPriority() const;
+
+    // Consultas por índice
+    bool contains(int index) const;
+    const Priority& priorityOf(int index) const;
+
+    // Información de la cola
+    int getSize() const;
+    int getCapacity() const;
+    bool isEmpty() const;
+    void clear(); // O(tamaño actual), no O(capacidad)
+};
+
+// Implementación de métodos template
+template<typename Priority, int Arity>
+IndexedPriorityQueue<Priority, Arity>::IndexedPriorityQueue(int capacity) : capacity(0) {
+    reset(capacity);
+}
+
+template<typename Priority, int Arity>
+void IndexedPriorityQueue<Priority, Arity>::reset(int new_capacity) {
+    heap.clear();
+    heap.reserve(new_capacity);
+    positions.clear();
+    positions.resize(new_capacity, -1);
+    priorities.clear();
+    priorities.resize(new_capacity, Priority());
+    capacity = new_capacity;
+}
+
+template<typename Priority, int Arity>
+void IndexedPriorityQueue<Priority, Arity>::siftUp(int position) {
+    int index = heap[position];
+    const Priority& priority = priorities[index];
+
+    while (position > 0) {
+        int parent = (position - 1) / Arity;
+        int parent_index = heap[parent];
+        if (!(priority < priorities[parent_index])) {
+            break;
+        }
+        heap[position] = parent_index;
+        positions[parent_index] = position;
+        position = parent;
+    }
+
+    heap[position] = index;
+    positions[index] = position;
+}
+
+template<typename Priority, int Arity>
+void IndexedPriorityQueue<Priority, Arity>::siftDown(int position) {
+    int size = heap.getSize();
+    int index = heap[position];
+    const Priority& priority = priorities[index];
+
+    while (true) {
+        int first_child = position * Arity + 1;
+        if (first_child >= size) {
+            break;
+        }
+
+        // Elegir el menor de los (hasta) Arity hijos
+        int last_child = first_child + Arity;
+        if (last_child > size) {
+            last_child = size;
+        }
+        int best = first_child;
+        for (int child = first_child + 1; child < last_child; child++) {
+            if (priorities[heap[child]] < priorities[heap[best]]) {
+                best = child;
+            }
+        }
+
+        if (!(priorities[heap[best]] < priority)) {
+            break;
+        }
+        heap[position] = heap[best];
+        positions[heap[position]] = position;
+        position = best;
+    }
+
+    heap[position] = index;
+    positions[index] = position;
+}
+
+template<typename Priority, int Arity>
+void IndexedPriorityQueue<Priority, Arity>::push(int index, const Priority& priority) {
+    if (index < 0 || index >= capacity) {
+        throw "Index out of bounds";
+    }
+    if (positions[index] != -1) {
+        throw "Index already in priority queue";
+    }
+    priorities[index] = priority;
+    heap.push_back(index);
+    siftUp(heap.getSize() - 1);
+}
+
+template<typename Priority, int Arity>
+void IndexedPriorityQueue<Priority, Arity>::decreaseKey(int index, const Priority& priority) {
+    if (!contains(index)) {
+        throw "Index not in priority queue";
+    }
+    priorities[index] = priority;
+    siftUp(positions[index]);
+}
+
+template<typename Priority, int Arity>
+bool IndexedPriorityQueue<Priority, Arity>::pushOrDecrease(int index, const Priority& priority) {
+    if (!contains(index)) {
+        push(index, priority);
+        return true;
+    }
+    if (priority < priorities[index]) {
+        decreaseKey(index, priority);
+        return true;
+    }
+    return false;
+}
+
+template<typename Priority, int Arity>
+void IndexedPriorityQueue<Priority, Arity>::changePriority(int index, const Priority& priority) {
+    if (!contains(index)) {
+        throw "Index not in priority queue";
+    }
+    bool decreased = priority < priorities[index];
+    priorities[index] = priority;
+    if (decreased) {
+        siftUp(positions[index]);
+    } else {
+        siftDown(positions[index]);
+    }
+}
+
+template<typename Priority, int Arity>
+void IndexedPriorityQueue<Priority, Arity>::pop() {
+    if (isEmpty()) {
+        return;
+    }
+    positions[heap[0]] = -1;
+    int last = heap[heap.getSize() - 1];
+    heap.pop_back();
+    if (!heap.isEmpty()) {
+        heap[0] = last;
+        siftDown(0);
+    }
+}
+
+template<typename Priority, int Arity>
+int IndexedPriorityQueue<Priority, Arity>::top() const {
+    if (isEmpty()) {
+        throw "Priority queue is empty";
+    }
+    return heap[0];
+}
+
+template<typename Priority, int Arity>
+const Priority& IndexedPriorityQueue<Priority, Arity>::topPriority() const {
+    if (isEmpty()) {
+        throw "Priority queue is empty";
+    }
+    return priorities[heap[0]];
+}
+
+template<typename Priority, int Arity>
+bool IndexedPriorityQueue<Priority, Arity>::contains(int index) const {
+    return index >= 0 && index < capacity && positions[index] != -1;
+}
+
+template<typename Priority, int Arity>
+const Priority& IndexedPriorityQueue<Priority, Arity>::priorityOf(int index) const {
+    if (!contains(index)) {
+        throw "Index not in priority queue";
+    }
+    return priorities[index];
+}
+
+template<typename Priority, int Arity>
+int IndexedPriorityQueue<Priority, Arity>::getSize() const {
+    return heap.getSize();
+}
+
+template<typename Priority, int Arity>
+int IndexedPriorityQueue<Priority, Arity>::getCapacity() const {
+    return capacity;
+}
+
+template<typename Priority, int Arity>
+bool IndexedPriorityQueue<Priority, Arity>::isEmpty() const {
+    return heap.isEmpty();
+}
+
+template<typename Priority, int Arity>
+void IndexedPriorityQueue<Priority, Arity>::clear() {
+    for (int i = 0; i < heap.getSize(); i++) {
+        positions[heap[i]] = -1;
+    }
+    heap.clear();
+}
+
+#endif // INDEXED_PRIORITY_QUEUE_H
@@ -0,0 +1,65 @@
+#ifndef JUMP_POINT_SEARCH_H
+#define JUMP_POINT_SEARCH_H
+
+#include "graph.h"
+#include "dynamic_array.h"
+#include "search_workspace.h"
+#include "search_algorithms.h"
+
+// Jump Point Search (JPS) para cuadrículas 4-conectadas de costo uniforme,
+// con celdas bloqueadas. La celda (x, y) tiene ID y * width + x, igual que
+// en LargeGraphGenerator::generateGridGraph, y moverse a una celda vecina
+// libre cuesta cell_cost. Los vecinos se calculan a partir de las
+// coordenadas, sin listas de adyacencia.
+//
+// Entre los muchos caminos mínimos simétricos de una cuadrícula, JPS solo
+// considera los canónicos (primero horizontal y luego vertical, salvo donde
+// un obstáculo obliga a girar): desde cada nodo expandido "salta" en línea
+// recta hasta el próximo punto de salto (el objetivo, un vecino forzado
+// por un obstáculo o, en saltos verticales, una fila desde la que se ve un
+// punto de salto horizontal). Solo esos puntos entran a la cola de
+// prioridad, así que se expanden órdenes de magnitud menos nodos que con A*
+// y las distancias son las mismas.
+class JumpPointSearch {
+private:
+    int width;
+    int height;
+    double cell_cost;
+    DynamicArray<char> blocked;     // 1 si la celda está bloqueada
+    SearchWorkspace workspace;      // Reutilizado por findPath sin workspace
+
+    bool isFree(int x, int y) const;
+    int jump(int x, int y, int dx, int dy, int goal_x, int goal_y) const;
+    double heuristic(int cell, int goal) const;
+    DynamicArray<int> expandPath(const SearchWorkspace& ws, int start, int goal) const;
+
+public:
+    // Constructores: cuadrícula vacía o de width x height sin bloqueos
+    JumpPointSearch();
+    JumpPointSearch(int width, int height, double cell_cost = 1.0);
+
+    // Configurar la cuadrícula a partir de un Graph si tiene esa forma:
+    // IDs 0..n-1 con coordenadas en una retícula regular (x crece con el ID
+    // dentro de cada fila) y aristas de peso uniforme exactamente hacia las
+    // celdas vecinas libres. Las celdas sin aristas se toman como
+    // bloqueadas. Retorna false (sin cambios) si el grafo no es una cuadrícula
+    bool detectFrom(const Graph& graph);
+
+    // Celdas bloqueadas
+    void setBlocked(int cell, bool value = true);
+    bool isBlocked(int cell) const;
+
+    // Buscar un camino mínimo entre dos celdas (IDs). El camino incluye
+    // todas las celdas intermedias; nodes_explored cuenta los puntos de
+    // salto expandidos
+    SearchResult findPath(int start, int goal);
+    SearchResult findPath(int start, int goal, SearchWorkspace& ws);
+
+    // Información
+    int getWidth() const;
+    int getHeight() const;
+    int getCellCount() const;
+    double getCellCost() const;
+};
+
+#endif // JUMP_POINT_SEARCH_H
@@ -0,0 +1,65 @@
+#ifndef KD_TREE_H
+#define KD_TREE_H
+
+#include "node.h"
+#include "dynamic_array.h"
+#include <utility>
+
+// k-d tree estático sobre puntos 2D, para ubicar nodos a partir de
+// coordenadas (p. ej. ajustar el origen y destino de una consulta al grafo).
+//
+// El árbol es implícito: el rango [begin, end) se divide en su posición
+// media 'mid', el punto en 'mid' es la mediana según el eje de mayor
+// extensión (guardado en split_axis[mid]) y los subárboles son
+// [begin, mid) y [mid + 1, end). No hay punteros entre nodos; los rangos
+// con a lo sumo LEAF_SIZE puntos son hojas que se recorren linealmente.
+// Las coordenadas se guardan en el orden del árbol, así que recorrer una
+// hoja lee memoria contigua. Construirlo es O(n log n) con selección de
+// mediana en O(n) por nivel; una consulta de vecino más cercano visita
+// O(log n) nodos en promedio.
+class KdTree {
+private:
+    enum { LEAF_SIZE = 8 };
+
+    DynamicArray<int> items;          // Índice original de cada punto, en orden del árbol
+    DynamicArray<double> xs;          // Coordenadas en el mismo orden que items
+    DynamicArray<double> ys;
+    DynamicArray<char> split_axis;    // 0 = x, 1 = y (solo en posiciones 'mid')
+
+    // Funciones auxiliares
+    void buildRange(int begin, int end);
+    void selectMedian(int begin, int end, int mid, int axis);
+    void swapPoints(int a, int b);
+    void searchNearest(int begin, int end, double x, double y, int k, double& limit,
+                       DynamicArray<std::pair<double, int>>& best) const;
+    void searchRadius(int begin, int end, double x, double y, double squared_radius,
+                      DynamicArray<std::pair<double, int>>& found) const;
+
+public:
+    // Constructor
+    KdTree();
+
+    // Construir sobre las posiciones de 'nodes' (los resultados son índices
+    // en ese array) o sobre dos arrays de coordenadas del mismo tamaño
+    void build(const DynamicArray<Node>& nodes);
+    void build(const DynamicArray<double>& x_coords, const DynamicArray<double>& y_coords);
+
+    // Índice del punto más cercano a (x, y) (empates por índice); -1 si está vacío
+    int nearest(double x, double y) const;
+
+    // Los k puntos más cercanos a (x, y) a distancia <= max_distance, en
+    // orden creciente de distancia (empates por índice). Retorna cuántos hay
+    int kNearest(double x, double y, int k, double max_distance,
+                 DynamicArray<std::pair<double, int>>& neighbors) const;
+
+    // Todos los puntos a distancia <= radius de (x, y), sin orden particular
+    int withinRadius(double x, double y, double radius,
+                     DynamicArray<std::pair<double, int>>& neighbors) const;
+
+    // Información
+    int getSize() const;
+    bool isEmpty() const;
+    void clear();
+};
+
+#endif // KD_TREE_H
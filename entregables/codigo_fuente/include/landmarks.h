@@ -0,0 +1,86 @@
+#ifndef LANDMARKS_H
+#define LANDMARKS_H
+
+#include "graph.h"
+#include "compact_graph.h"
+#include "dynamic_array.h"
+#include <string>
+#include <cstddef>
+#include <limits>
+
+// Estrategias de selección de landmarks
+enum LandmarkSelection {
+    LANDMARKS_FARTHEST,  // Cada landmark maximiza su distancia a los ya elegidos
+    LANDMARKS_AVOID      // "Avoid": busca regiones donde la cota actual es mala
+};
+
+// Preprocesamiento ALT (A*, Landmarks, desigualdad triangular).
+// Para cada landmark L se guardan d(L, v) y d(v, L) para todos los nodos v;
+// con ellos, para cualquier par (v, t):
+//     d(v, t) >= max_L max(d(L, t) - d(L, v), d(v, L) - d(t, L))
+// Esa cota es admisible y consistente, y sirve como heurística de A* aunque
+// los pesos no sigan la distancia euclidiana o no haya coordenadas.
+//
+// Los nodos se identifican por índice interno (posición en
+// Graph::getAllNodes(), igual al índice de CompactGraph). Las distancias se
+// guardan por nodo ([v * k + l]) para que una cota lea memoria contigua.
+class Landmarks {
+private:
+    int node_count;
+    int landmark_count;
+    DynamicArray<int> landmark_nodes;    // Índice interno de cada landmark
+    DynamicArray<double> from_landmark;  // d(L, v)
+    DynamicArray<double> to_landmark;    // d(v, L)
+    double preprocessing_ms;
+
+public:
+    // Constructor
+    Landmarks();
+
+    // Preprocesamiento: elegir 'count' landmarks y calcular sus distancias
+    // (2 Dijkstra uno-a-todos por landmark)
+    void build(const CompactGraph& graph, int count, LandmarkSelection selection = LANDMARKS_AVOID);
+    void build(const Graph& graph, int count, LandmarkSelection selection = LANDMARKS_AVOID);
+
+    // Cota inferior de d(index, target_index) por desigualdad triangular
+    double lowerBound(int index, int target_index) const;
+
+    // Persistencia junto al archivo binario del grafo
+    bool saveToBinary(const std::string& filename) const;
+    bool loadFromBinary(const std::string& filename, int expected_node_count);
+    static std::string landmarkFileFor(const std::string& graph_filename);
+
+    // Información
+    bool isEmpty() const;
+    int getNodeCount() const;
+    int getLandmarkCount() const;
+    int getLandmarkNode(int i) const;
+    double getDistanceFromLandmark(int landmark, int index) const;
+    double getDistanceToLandmark(int landmark, int index) const;
+    double getPreprocessingTime() const;  // ms
+    size_t getMemoryUsage() const;        // bytes
+};
+
+// La cota se evalúa en cada relajación de A*: se define inline
+inline double Landmarks::lowerBound(int index, int target_index) const {
+    const double INF = std::numeric_limits<double>::infinity();
+    const double* from_v = &from_landmark[index * landmark_count];
+    const double* from_t = &from_landmark[target_index * landmark_count];
+    const double* to_v = &to_landmark[index * landmark_count];
+    const double* to_t = &to_landmark[target_index * landmark_count];
+    
+    // Los términos con distancias infinitas (nodo inalcanzable desde o hacia
+    // el landmark) no aportan información y se omiten
+    double bound = 0.0;
+    for (int l = 0; l < landmark_count; l++) {
+        if (from_v[l] < INF && from_t[l] < INF && from_t[l] - from_v[l] > bound) {
+            bound = from_t[l] - from_v[l];
+        }
+        if (to_v[l] < INF && to_t[l] < INF && to_v[l] - to_t[l] > bound) {
+            bound = to_v[l] - to_t[l];
+        }
+    }
+    return bound;
+}
+
+#endif // LANDMARKS_H
@@ -2,12 +2,16 @@
 #define LARGE_GRAPH_GENERATOR_H
 
 #include "graph.h"
+#include "spatial_grid.h"
 #include <string>
 
 class LargeGraphGenerator {
 public:
-    // Generar grafo grande con patrón de cuadrícula
-    static void generateGridGraph(Graph& graph, int width, int height, double spacing = 1.0);
+    // Generar grafo grande con patrón de cuadrícula (ID = y * width + x).
+    // Si se pasa blocked (una entrada por celda, distinta de 0 = bloqueada),
+    // las celdas bloqueadas quedan como nodos sin aristas
+    static void generateGridGraph(Graph& graph, int width, int height, double spacing = 1.0,
+                                  const DynamicArray<char>* blocked = nullptr);
     
     // Generar grafo grande aleatorio
     static void generateRandomGraph(Graph& graph, int num_nodes, double connection_probability = 0.1);
@@ -18,11 +22,17 @@ public:
     // Generar obstáculos en el grafo (para simular calles bloqueadas)
     static void addObstacles(Graph& graph, double obstacle_percentage = 0.1);
     
-    // Guardar grafo en archivo binario para carga rápida
-    static bool saveGraphToBinary(const Graph& graph, const std::string& filename);
+    // Guardar grafo en archivo binario para carga rápida. Si se pasa
+    // original_order (p. ej. el 'order' de NodeReordering: posición que
+    // tenía antes de reordenar el nodo de cada índice), se agrega al final
+    // del archivo en una sección opcional que los lectores anteriores ignoran
+    static bool saveGraphToBinary(const Graph& graph, const std::string& filename,
+                                  const DynamicArray<int>* original_order = nullptr);
     
-    // Cargar grafo desde archivo binario
-    static bool loadGraphFromBinary(Graph& graph, const std::string& filename);
+    // Cargar grafo desde archivo binario. Con original_order se lee la
+    // permutación guardada (la identidad si el archivo no la tiene)
+    static bool loadGraphFromBinary(Graph& graph, const std::string& filename,
+                                    DynamicArray<int>* original_order = nullptr);
     
     // Generar datos de prueba específicos para 2M de nodos
     static void generate2MillionNodeGraph(Graph& graph);
@@ -30,8 +40,9 @@ public:
 private:
     // Funciones auxiliares
     static double calculateDistance(double x1, double y1, double x2, double y2);
-    static void connectNearbyNodes(Graph& graph, int node_id, const DynamicArray<Node>& nodes, 
-                                 double max_distance, int max_connections);
+    static void connectNearbyNodes(Graph& graph, int node_id, const DynamicArray<Node>& nodes,
+                                 const SpatialGrid& spatial_grid, double max_distance,
+                                 int max_connections);
     static int getGridIndex(int x, int y, int width);
 };
 
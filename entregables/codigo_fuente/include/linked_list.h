@@ -1,7 +1,11 @@
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
-template<typename T>
+#include "node_pool.h"
+
+// Los nodos se piden a 'Allocator' (por defecto, new/delete por nodo; con
+// PoolNodeAllocator, a un NodePool compartido)
+template<typename T, typename Allocator = HeapNodeAllocator>
 class LinkedList {
 private:
     struct Node {
@@ -14,10 +18,14 @@ private:
     Node* head;
     Node* tail;
     int size;
+    Allocator allocator;
+    
+    Node* createNode(const T& data);
+    void destroyNode(Node* node);
     
 public:
     // Constructor
-    LinkedList();
+    explicit LinkedList(const Allocator& allocator = Allocator());
     
     // Destructor
     ~LinkedList();
@@ -25,8 +33,13 @@ public:
     // Constructor de copia
     LinkedList(const LinkedList& other);
     
-    // Operador de asignación
+    // Constructor de movimiento: toma los nodos de 'other', que queda vacía
+    // (p. ej. al crecer un DynamicArray de listas)
+    LinkedList(LinkedList&& other);
+    
+    // Operadores de asignación (adoptan el asignador de 'other')
     LinkedList& operator=(const LinkedList& other);
+    LinkedList& operator=(LinkedList&& other);
     
     // Métodos principales
     void push_front(const T& element);
@@ -43,6 +56,13 @@ public:
     bool isEmpty() const;
     void clear();
     
+    // Vaciar la lista sin liberar sus nodos uno a uno, cuando el asignador
+    // los libera en bloque después (NodePool::release). Solo para tipos T
+    // que no necesitan destructor
+    void discard();
+    
+    const Allocator& getAllocator() const;
+    
     // Búsqueda
     bool contains(const T& element) const;
     int indexOf(const T& element) const;
@@ -79,16 +99,30 @@ public:
 };
 
 // Implementación de métodos template
-template<typename T>
-LinkedList<T>::LinkedList() : head(nullptr), tail(nullptr), size(0) {}
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Node* LinkedList<T, Allocator>::createNode(const T& data) {
+    void* memory = allocator.allocate(sizeof(Node));
+    return new (memory) Node(data);
+}
 
-template<typename T>
-LinkedList<T>::~LinkedList() {
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::destroyNode(Node* node) {
+    node->~Node();
+    allocator.deallocate(node, sizeof(Node));
+}
+
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(const Allocator& allocator)
+    : head(nullptr), tail(nullptr), size(0), allocator(allocator) {}
+
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::~LinkedList() {
     clear();
 }
 
-template<typename T>
-LinkedList<T>::LinkedList(const LinkedList& other) : head(nullptr), tail(nullptr), size(0) {
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(const LinkedList& other)
+    : head(nullptr), tail(nullptr), size(0), allocator(other.allocator) {
     Node* current = other.head;
     while (current) {
         push_back(current->data);
@@ -96,10 +130,11 @@ LinkedList<T>::LinkedList(const LinkedList& other) : head(nullptr), tail(nullptr
     }
 }
 
-template<typename T>
-LinkedList<T>& LinkedList<T>::operator=(const LinkedList& other) {
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(const LinkedList& other) {
     if (this != &other) {
         clear();
+        allocator = other.allocator;
         Node* current = other.head;
         while (current) {
             push_back(current->data);
@@ -109,9 +144,30 @@ LinkedList<T>& LinkedList<T>::operator=(const LinkedList& other) {
     return *this;
 }
 
-template<typename T>
-void LinkedList<T>::push_front(const T& element) {
-    Node* new_node = new Node(element);
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(LinkedList&& other)
+    : head(other.head), tail(other.tail), size(other.size), allocator(other.allocator) {
+    other.head = other.tail = nullptr;
+    other.size = 0;
+}
+
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(LinkedList&& other) {
+    if (this != &other) {
+        clear();
+        allocator = other.allocator;
+        head = other.head;
+        tail = other.tail;
+        size = other.size;
+        other.head = other.tail = nullptr;
+        other.size = 0;
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::push_front(const T& element) {
+    Node* new_node = createNode(element);
     if (isEmpty()) {
         head = tail = new_node;
     } else {
@@ -121,9 +177,9 @@ void LinkedList<T>::push_front(const T& element) {
     size++;
 }
 
-template<typename T>
-void LinkedList<T>::push_back(const T& element) {
-    Node* new_node = new Node(element);
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::push_back(const T& element) {
+    Node* new_node = createNode(element);
     if (isEmpty()) {
         head = tail = new_node;
     } else {
@@ -133,31 +189,31 @@ void LinkedList<T>::push_back(const T& element) {
     size++;
 }
 
-template<typename T>
-void LinkedList<T>::pop_front() {
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::pop_front() {
     if (!isEmpty()) {
         Node* to_delete = head;
         head = head->next;
         if (head == nullptr) {
             tail = nullptr;
         }
-        delete to_delete;
+        destroyNode(to_delete);
         size--;
     }
 }
 
-template<typename T>
-void LinkedList<T>::pop_back() {
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::pop_back() {
     if (!isEmpty()) {
         if (head == tail) {
-            delete head;
+            destroyNode(head);
             head = tail = nullptr;
         } else {
             Node* current = head;
             while (current->next != tail) {
                 current = current->next;
             }
-            delete tail;
+            destroyNode(tail);
             tail = current;
             tail->next = nullptr;
         }
@@ -165,57 +221,57 @@ void LinkedList<T>::pop_back() {
     }
 }
 
-template<typename T>
-T& LinkedList<T>::front() {
+template<typename T, typename Allocator>
+T& LinkedList<T, Allocator>::front() {
     if (isEmpty()) {
         throw "List is empty";
     }
     return head->data;
 }
 
-template<typename T>
-const T& LinkedList<T>::front() const {
+template<typename T, typename Allocator>
+const T& LinkedList<T, Allocator>::front() const {
     if (isEmpty()) {
         throw "List is empty";
     }
     return head->data;
 }
 
-template<typename T>
-T& LinkedList<T>::back() {
+template<typename T, typename Allocator>
+T& LinkedList<T, Allocator>::back() {
     if (isEmpty()) {
         throw "List is empty";
     }
     return tail->data;
 }
 
-template<typename T>
-const T& LinkedList<T>::back() const {
+template<typename T, typename Allocator>
+const T& LinkedList<T, Allocator>::back() const {
     if (isEmpty()) {
         throw "List is empty";
     }
     return tail->data;
 }
 
-template<typename T>
-int LinkedList<T>::getSize() const {
+template<typename T, typename Allocator>
+int LinkedList<T, Allocator>::getSize() const {
     return size;
 }
 
-template<typename T>
-bool LinkedList<T>::isEmpty() const {
+template<typename T, typename Allocator>
+bool LinkedList<T, Allocator>::isEmpty() const {
     return size == 0;
 }
 
-template<typename T>
-void LinkedList<T>::clear() {
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::clear() {
     while (!isEmpty()) {
         pop_front();
     }
 }
 
-template<typename T>
-bool LinkedList<T>::contains(const T& element) const {
+template<typename T, typename Allocator>
+bool LinkedList<T, Allocator>::contains(const T& element) const {
     Node* current = head;
     while (current) {
         if (current->data == element) {
@@ -226,8 +282,8 @@ bool LinkedList<T>::contains(const T& element) const {
     return false;
 }
 
-template<typename T>
-int LinkedList<T>::indexOf(const T& element) const {
+template<typename T, typename Allocator>
+int LinkedList<T, Allocator>::indexOf(const T& element) const {
     Node* current = head;
     int index = 0;
     while (current) {
@@ -240,5 +296,16 @@ int LinkedList<T>::indexOf(const T& element) const {
     return -1;
 }
 
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::discard() {
+    head = tail = nullptr;
+    size = 0;
+}
+
+template<typename T, typename Allocator>
+const Allocator& LinkedList<T, Allocator>::getAllocator() const {
+    return allocator;
+}
+
 #endif // LINKED_LIST_H
 
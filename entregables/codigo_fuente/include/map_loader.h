@@ -2,12 +2,57 @@
 #define MAP_LOADER_H
 
 #include "graph.h"
+#include "compact_graph.h"
+#include "hash_index.h"
+#include "dynamic_array.h"
 #include <string>
 
+class MappedFile;
+
+// Resultado de una carga CSV: conteos y filas rechazadas
+struct CSVLoadReport {
+    int nodes_loaded;
+    int edges_loaded;
+    int malformed_rows;               // Filas rechazadas (no se detiene la carga)
+    DynamicArray<std::string> errors; // "archivo:línea: motivo" de las primeras filas rechazadas
+    
+    CSVLoadReport() : nodes_loaded(0), edges_loaded(0), malformed_rows(0) {}
+};
+
 class MapLoader {
 public:
-    // Cargar mapa desde archivo CSV
-    static bool loadFromCSV(Graph& graph, const std::string& nodes_file, const std::string& edges_file);
+    // Cargar mapa desde archivos CSV (nodos: id,name,x,y; aristas:
+    // source,destination,weight; la primera línea de cada uno es la
+    // cabecera). Los archivos se proyectan en memoria y se recorren una vez
+    // con un tokenizador propio que no reserva memoria por campo; los nodos
+    // se insertan en un grafo ya dimensionado según el número de líneas.
+    // Las filas mal formadas (campos faltantes o no numéricos, ID repetido,
+    // arista hacia un nodo inexistente) se omiten y se informan con su
+    // número de línea. Retorna false solo si un archivo no se puede abrir
+    static bool loadFromCSV(Graph& graph, const std::string& nodes_file, const std::string& edges_file,
+                            CSVLoadReport* report = nullptr);
+    
+    // Carga en paralelo: cada archivo se divide en num_threads fragmentos
+    // que empiezan en un inicio de línea, cada hilo parsea el suyo a buffers
+    // propios y luego se combinan en orden de archivo, así que el grafo, los
+    // conteos y los errores informados son los mismos que con loadFromCSV
+    // para cualquier número de hilos. La inserción en el Graph es secuencial
+    static bool loadFromCSVParallel(Graph& graph, const std::string& nodes_file, const std::string& edges_file,
+                                    int num_threads, CSVLoadReport* report = nullptr);
+    
+    // Igual que loadFromCSVParallel pero construyendo directamente el CSR:
+    // los hilos traducen los IDs de las aristas a índices y el CSR se arma
+    // con conteo de grados y suma prefija en paralelo (buildFromEdgeList).
+    // El resultado coincide con CompactGraph(graph) tras loadFromCSV
+    static bool loadCompactFromCSV(CompactGraph& graph, const std::string& nodes_file, const std::string& edges_file,
+                                   int num_threads, CSVLoadReport* report = nullptr);
+    
+    // Cargador anterior (stringstream + std::stoi/std::stod por campo e
+    // ifstream línea a línea). Se conserva solo como referencia del benchmark
+    static bool loadFromCSVLegacy(Graph& graph, const std::string& nodes_file, const std::string& edges_file);
+    
+    // Guardar el grafo en el formato CSV que lee loadFromCSV
+    static bool saveToCSV(const Graph& graph, const std::string& nodes_file, const std::string& edges_file);
     
     // Crear mapa de prueba de Arequipa
     static void createArequipaMap(Graph& graph);
@@ -16,9 +61,42 @@ public:
     static void generateSyntheticMap(Graph& graph, int num_nodes, double width, double height);
     
 private:
+    // Errores de filas rechazadas que se guardan e imprimen (el resto solo se cuenta)
+    enum { MAX_REPORTED_ERRORS = 20 };
+    
     // Funciones auxiliares
     static double calculateDistance(double x1, double y1, double x2, double y2);
     static void addBidirectionalEdge(Graph& graph, int node1, int node2, double weight);
+    
+    // Tokenizador CSV sobre memoria: campo [field_begin, field_end) de la
+    // fila que termina en line_end; 'cursor' avanza tras la coma
+    static bool nextField(const char*& cursor, const char* line_end,
+                          const char*& field_begin, const char*& field_end);
+    static bool parseInt(const char* begin, const char* end, int& value);
+    static bool parseDouble(const char* begin, const char* end, double& value);
+    static void reportMalformedRow(CSVLoadReport& report, const std::string& filename,
+                                   int line_number, const char* reason);
+    static void printLoadSummary(const CSVLoadReport& report, int node_count, int edge_count);
+    
+    // Parseo de una fila; retornan el motivo del rechazo o nullptr
+    static const char* parseNodeRow(const char* line, const char* line_end, int& id,
+                                    const char*& name_begin, const char*& name_end,
+                                    double& x, double& y);
+    static const char* parseEdgeRow(const char* line, const char* line_end, int& source,
+                                    int& destination, double& weight);
+    
+    // Carga paralela: fragmentos de archivo y buffers por hilo
+    struct NodeChunk;
+    struct EdgeChunk;
+    static void splitAtNewlines(const char* data, const char* end, int chunk_count,
+                                DynamicArray<const char*>& bounds);
+    static void parseNodeChunk(NodeChunk& chunk);
+    static void parseEdgeChunk(EdgeChunk& chunk, const HashIndex* node_index);
+    static bool parseNodesInParallel(const std::string& nodes_file, const std::string& edges_file,
+                                     MappedFile& nodes_map, MappedFile& edges_map,
+                                     NodeChunk* chunks, int num_threads);
+    static void parseEdgesInParallel(const MappedFile& edges_map, EdgeChunk* chunks, int num_threads,
+                                     const HashIndex* node_index);
 };
 
 #endif // MAP_LOADER_H
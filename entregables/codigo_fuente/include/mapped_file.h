@@ -0,0 +1,49 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+// Archivo proyectado en memoria en modo solo lectura (mmap en POSIX,
+// MapViewOfFile en Windows). El sistema operativo carga las páginas bajo
+// demanda al leerlas, así que abrir un archivo grande es O(1) y solo se paga
+// por las páginas que realmente se tocan. Varias proyecciones del mismo
+// archivo comparten las páginas de la caché del sistema.
+//
+// Un archivo de 0 bytes se abre sin proyectarlo (mmap no admite longitud
+// 0): getSize() es 0 y getData() apunta a un buffer vacío, nunca a nullptr,
+// así que se lee como un archivo sin filas.
+class MappedFile {
+private:
+    const char* data;
+    size_t size;
+    std::string filename;
+#ifdef _WIN32
+    void* file_handle;
+    void* mapping_handle;
+#endif
+
+    // No copiable: la proyección tiene un único dueño
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+public:
+    // Constructor y destructor
+    MappedFile();
+    ~MappedFile();
+
+    // Proyectar el archivo completo (cierra la proyección anterior)
+    bool open(const std::string& filename);
+    void close();
+
+    // Intercambiar proyecciones (permite validar antes de reemplazar)
+    void swap(MappedFile& other);
+
+    // Información
+    bool isOpen() const;
+    const char* getData() const;
+    size_t getSize() const;
+    const std::string& getFilename() const;
+};
+
+#endif // MAPPED_FILE_H
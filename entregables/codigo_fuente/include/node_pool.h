@@ -0,0 +1,189 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <new>
+
+// Pool de nodos de tamaño fijo para LinkedList y Queue. En lugar de un new
+// por nodo, reserva bloques de slots_per_chunk nodos y los entrega en
+// orden (bump allocation); los nodos liberados van a una lista libre y se
+// reutilizan antes de tocar un bloque nuevo. release() devuelve todos los
+// bloques al sistema de una vez, sin recorrer los nodos.
+//
+// El tamaño del slot se fija con la primera asignación (las listas que
+// comparten un pool tienen todas el mismo tipo de nodo); un pedido mayor se
+// atiende con el heap. Los slots no tienen cabecera, así que además de
+// ahorrar llamadas a malloc se ahorran sus 16 bytes de contabilidad por nodo.
+//
+// Un pool no es seguro entre hilos ni copiable.
+class NodePool {
+private:
+    struct Chunk {
+        Chunk* next;
+    };
+
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    enum { ALIGNMENT = 16 };
+
+    Chunk* chunks;
+    FreeSlot* free_list;
+    char* bump;           // Próximo slot sin usar del bloque actual
+    char* bump_end;
+    size_t slot_size;     // 0 hasta la primera asignación
+    int slots_per_chunk;
+    int chunk_count;
+    long long allocation_count;
+
+    static size_t roundUp(size_t bytes);
+    void addChunk();
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+public:
+    // Constructor
+    explicit NodePool(int slots_per_chunk = 4096);
+
+    // Destructor: libera todos los bloques
+    ~NodePool();
+
+    // Asignación de un nodo de 'bytes' bytes
+    void* allocate(size_t bytes);
+    void deallocate(void* pointer, size_t bytes);
+
+    // Liberar todos los bloques de una vez. Los nodos entregados dejan de
+    // ser válidos: las listas que los usaban deben vaciarse antes con
+    // discard() (sin liberar nodo por nodo)
+    void release();
+
+    // Estadísticas
+    long long getAllocationCount() const; // Nodos entregados desde la creación
+    int getChunkCount() const;            // Bloques pedidos al heap (vigentes)
+    size_t getSlotSize() const;
+    size_t getReservedBytes() const;
+};
+
+// Asignador por defecto de LinkedList y Queue: un new/delete por nodo
+struct HeapNodeAllocator {
+    void* allocate(size_t bytes) {
+        return ::operator new(bytes);
+    }
+
+    void deallocate(void* pointer, size_t) {
+        ::operator delete(pointer);
+    }
+};
+
+// Asignador que toma los nodos de un NodePool compartido por varias
+// listas (p. ej. todas las listas de adyacencia de un Graph). Sin pool se
+// comporta como HeapNodeAllocator. Las copias de una lista comparten su pool
+class PoolNodeAllocator {
+private:
+    NodePool* pool;
+
+public:
+    explicit PoolNodeAllocator(NodePool* pool = nullptr) : pool(pool) {}
+
+    void* allocate(size_t bytes) {
+        return pool ? pool->allocate(bytes) : ::operator new(bytes);
+    }
+
+    void deallocate(void* pointer, size_t bytes) {
+        if (pool) {
+            pool->deallocate(pointer, bytes);
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+
+    NodePool* getPool() const {
+        return pool;
+    }
+};
+
+// Implementación de métodos
+inline NodePool::NodePool(int slots_per_chunk)
+    : chunks(nullptr), free_list(nullptr), bump(nullptr), bump_end(nullptr), slot_size(0),
+      slots_per_chunk(slots_per_chunk > 0 ? slots_per_chunk : 1), chunk_count(0), allocation_count(0) {}
+
+inline NodePool::~NodePool() {
+    release();
+}
+
+inline size_t NodePool::roundUp(size_t bytes) {
+    return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+inline void NodePool::addChunk() {
+    size_t header = roundUp(sizeof(Chunk));
+    char* memory = static_cast<char*>(::operator new(header + slot_size * slots_per_chunk));
+    Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+    chunk->next = chunks;
+    chunks = chunk;
+    bump = memory + header;
+    bump_end = bump + slot_size * slots_per_chunk;
+    chunk_count++;
+}
+
+inline void* NodePool::allocate(size_t bytes) {
+    if (slot_size == 0) {
+        slot_size = roundUp(bytes > sizeof(FreeSlot) ? bytes : sizeof(FreeSlot));
+    }
+    if (bytes > slot_size) {
+        return ::operator new(bytes);
+    }
+    allocation_count++;
+    if (free_list) {
+        FreeSlot* slot = free_list;
+        free_list = slot->next;
+        return slot;
+    }
+    if (bump == bump_end) {
+        addChunk();
+    }
+    void* slot = bump;
+    bump += slot_size;
+    return slot;
+}
+
+inline void NodePool::deallocate(void* pointer, size_t bytes) {
+    if (bytes > slot_size) {
+        ::operator delete(pointer);
+        return;
+    }
+    FreeSlot* slot = static_cast<FreeSlot*>(pointer);
+    slot->next = free_list;
+    free_list = slot;
+}
+
+inline void NodePool::release() {
+    while (chunks) {
+        Chunk* next = chunks->next;
+        ::operator delete(chunks);
+        chunks = next;
+    }
+    free_list = nullptr;
+    bump = bump_end = nullptr;
+    chunk_count = 0;
+}
+
+inline long long NodePool::getAllocationCount() const {
+    return allocation_count;
+}
+
+inline int NodePool::getChunkCount() const {
+    return chunk_count;
+}
+
+inline size_t NodePool::getSlotSize() const {
+    return slot_size;
+}
+
+inline size_t NodePool::getReservedBytes() const {
+    return static_cast<size_t>(chunk_count) * (roundUp(sizeof(Chunk)) + slot_size * slots_per_chunk);
+}
+
+#endif // NODE_POOL_H
@@ -0,0 +1,50 @@
+#ifndef NODE_REORDERING_H
+#define NODE_REORDERING_H
+
+#include "graph.h"
+#include "dynamic_array.h"
+
+// Estrategias de reordenamiento de nodos
+enum NodeOrdering {
+    ORDER_HILBERT,  // Posición sobre una curva de Hilbert trazada en las coordenadas
+    ORDER_BFS,      // Orden de visita de un BFS (sin dirección), componente por componente
+    ORDER_RCM       // Reverse Cuthill-McKee: BFS por grado creciente desde un nodo periférico, invertido
+};
+
+// Renumeración de los índices internos de un Graph para mejorar la
+// localidad de caché. Dijkstra y A* leen y escriben distancia, padre y
+// marcas (workspace) de los vecinos de cada nodo expandido; si nodos
+// cercanos en el grafo tienen índices cercanos, esos accesos caen en las
+// mismas líneas de caché. Los generadores y los CSV dejan los nodos en
+// cualquier orden (en generateCityLikeGraph, un cluster queda repartido por
+// todo el array).
+//
+// Un orden es una permutación 'order': order[k] es el índice interno (en el
+// grafo de entrada) del nodo que pasa a ocupar la posición k. IDs, nombres,
+// coordenadas y aristas se conservan, así que las consultas por ID dan los
+// mismos resultados. CompactGraph, Landmarks y demás estructuras construidas
+// después heredan el nuevo orden.
+class NodeReordering {
+public:
+    // Calcular el orden según la estrategia
+    static void computeOrder(const Graph& graph, NodeOrdering ordering, DynamicArray<int>& order);
+
+    // Copiar 'graph' en 'reordered' con los nodos en el orden dado. Retorna
+    // false (sin tocar 'reordered') si 'order' no es una permutación de 0..n-1
+    static bool apply(const Graph& graph, const DynamicArray<int>& order, Graph& reordered);
+
+    // Ambos pasos
+    static void reorder(const Graph& graph, NodeOrdering ordering, Graph& reordered, DynamicArray<int>& order);
+
+    // Métrica de localidad: promedio de |índice origen - índice destino| por arista
+    static double averageEdgeSpan(const Graph& graph);
+
+    static const char* getName(NodeOrdering ordering);
+
+private:
+    static void hilbertOrder(const Graph& graph, DynamicArray<int>& order);
+    static void bfsOrder(const Graph& graph, DynamicArray<int>& order);
+    static void reverseCuthillMcKeeOrder(const Graph& graph, DynamicArray<int>& order);
+};
+
+#endif // NODE_REORDERING_H
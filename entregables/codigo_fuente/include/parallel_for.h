@@ -0,0 +1,75 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Ejecutar body(task) para cada task en [0, num_tasks) con hasta
+// num_threads hilos; el hilo que llama también trabaja. El hilo w toma las
+// tareas w, w + hilos, w + 2 * hilos, ..., así que el reparto no depende de
+// la planificación. La granularidad la decide el llamador (normalmente una
+// tarea por hilo); body debe poder llamarse concurrentemente.
+template<typename Function>
+void parallelFor(int num_tasks, int num_threads, Function body) {
+    if (num_threads > num_tasks) {
+        num_threads = num_tasks;
+    }
+    if (num_threads <= 1) {
+        for (int task = 0; task < num_tasks; task++) {
+            body(task);
+        }
+        return;
+    }
+
+    std::thread* workers = new std::thread[num_threads - 1];
+    for (int w = 1; w < num_threads; w++) {
+        workers[w - 1] = std::thread([&body, w, num_tasks, num_threads]() {
+            for (int task = w; task < num_tasks; task += num_threads) {
+                body(task);
+            }
+        });
+    }
+    for (int task = 0; task < num_tasks; task += num_threads) {
+        body(task);
+    }
+    for (int w = 0; w < num_threads - 1; w++) {
+        workers[w].join();
+    }
+    delete[] workers;
+}
+
+// Barrera reutilizable para 'count' hilos: wait() retorna cuando los count
+// hilos la alcanzaron. Sirve para separar fases dentro de un mismo
+// parallelFor (p. ej. generar y aplicar relajaciones) sin crear hilos nuevos
+class ThreadBarrier {
+private:
+    std::mutex mutex;
+    std::condition_variable released;
+    int count;
+    int waiting;
+    unsigned int generation;
+
+public:
+    explicit ThreadBarrier(int count) : count(count), waiting(0), generation(0) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        unsigned int arrival_generation = generation;
+        if (++waiting == count) {
+            waiting = 0;
+            generation++;
+            released.notify_all();
+        } else {
+            released.wait(lock, [this, arrival_generation]() { return generation != arrival_generation; });
+        }
+    }
+};
+
+// Número de hilos por defecto: núcleos disponibles (1 si no se conoce)
+inline int defaultThreadCount() {
+    unsigned int cores = std::thread::hardware_concurrency();
+    return cores > 0 ? static_cast<int>(cores) : 1;
+}
+
+#endif // PARALLEL_FOR_H
@@ -3,6 +3,8 @@
 
 #include "graph.h"
 #include "search_algorithms.h"
+#include "landmarks.h"
+#include "contraction_hierarchy.h"
 #include <string>
 #include <chrono>
 
@@ -35,6 +37,8 @@ struct PerformanceMetrics {
 class PerformanceAnalyzer {
 private:
     DynamicArray<PerformanceMetrics> results;
+    const Landmarks* landmarks; // Usados por measureSearchAlgorithm("ALT")
+    ContractionHierarchy* hierarchy; // Usada por measureSearchAlgorithm("CH")
     
 public:
     // Constructor
@@ -47,6 +51,17 @@ public:
     PerformanceMetrics measureSearchAlgorithm(const Graph& graph, const std::string& algorithm,
                                              int start, int goal);
     
+    // Landmarks para el algoritmo "ALT" (deben corresponder al grafo medido)
+    void setLandmarks(const Landmarks* landmarks);
+    
+    // Medir preprocesamiento ALT: tiempo en construction_time y memoria de
+    // las tablas de distancias en memory_used_mb
+    PerformanceMetrics measureLandmarkPreprocessing(const Graph& graph, Landmarks& landmarks, int landmark_count,
+                                                    LandmarkSelection selection = LANDMARKS_AVOID);
+    
+    // Jerarquía para el algoritmo "CH" (debe corresponder al grafo medido)
+    void setContractionHierarchy(ContractionHierarchy* hierarchy);
+    
     // Ejecutar suite completa de pruebas
     void runComprehensiveTest(const Graph& graph, int num_test_pairs = 10);
     
@@ -59,6 +74,85 @@ public:
     // Medir uso de memoria (aproximado)
     size_t estimateMemoryUsage(const Graph& graph);
     
+    // Benchmark: costo de búsqueda de nodos por ID a distintos tamaños de grafo
+    void benchmarkNodeLookup(const DynamicArray<int>& graph_sizes, int num_lookups = 1000000);
+    
+    // Benchmark: memoria y tiempo de búsqueda de Graph vs CompactGraph (CSR)
+    void benchmarkCompactGraph(int grid_side);
+    
+    // Benchmark: Dijkstra uno-a-todos con heap indexado de aridad 2, 4 y 8
+    void benchmarkHeapArity(int grid_side, int city_nodes, int repetitions = 3);
+    
+    // Benchmark: muchas consultas cortas con workspace nuevo vs reutilizado
+    void benchmarkWorkspaceReuse(int grid_side, int num_queries = 100);
+    
+    // Benchmark: A* euclidiano vs ALT con distinto número de landmarks
+    void benchmarkLandmarks(int city_nodes, int num_queries = 50);
+    
+    // Benchmark: preprocesamiento CH y tiempo por consulta vs Dijkstra y A*
+    void benchmarkContractionHierarchy(int grid_side, int num_queries = 200);
+    
+    // Benchmark: arranque con el binario clásico vs CSR proyectado en memoria
+    void benchmarkMappedGraph(int grid_side, int num_queries = 20);
+    
+    // Benchmark: generación de grafos tipo ciudad y sintéticos con índice espacial
+    void benchmarkSpatialGeneration(const DynamicArray<int>& graph_sizes);
+    
+    // Benchmark: nodo más cercano a una coordenada, recorrido lineal vs k-d tree
+    void benchmarkNearestNode(int num_nodes, int num_queries = 100000);
+    
+    // Benchmark: carga CSV con el cargador anterior vs el tokenizador sobre memoria
+    void benchmarkCSVLoading(int grid_side);
+    
+    // Benchmark: escalado de la carga CSV paralela (Graph y CSR directo)
+    // con 1, 2, 4, 8 y 16 hilos
+    void benchmarkParallelCSVLoading(int grid_side);
+    
+    // Benchmark: matriz de distancias side x side, Dijkstra por par vs
+    // uno-a-muchos por origen (1 hilo y todos los núcleos), en celdas/segundo
+    void benchmarkDistanceMatrix(int city_nodes, int side);
+    
+    // Benchmark: throughput (consultas/segundo) de QueryExecutor con 1, 2,
+    // 4, 8 y 16 hilos sobre un lote mixto de Dijkstra y A*
+    void benchmarkQueryExecutor(int city_nodes, int num_queries = 500);
+    
+    // Benchmark: SSSP uno-a-todos, Dijkstra secuencial vs delta-stepping
+    // con 1, 2, 4 y 8 hilos en grafos de cuadrícula, aleatorio y de ciudad
+    void benchmarkDeltaStepping(int grid_side, int random_nodes, int city_nodes);
+    
+    // Benchmark: isócronas de radio pequeño repetidas, workspace nuevo vs
+    // reutilizado (el costo debe depender de la zona, no de V)
+    void benchmarkIsochrones(int grid_side, int num_queries = 200);
+    
+    // Benchmark: A* vs Jump Point Search (nodos expandidos y tiempo) en una
+    // cuadrícula de grid_side x grid_side abierta y con 20% de obstáculos
+    void benchmarkJumpPointSearch(int grid_side, int num_queries = 10);
+    
+    // Benchmark: cuadrícula de grid_side x grid_side materializada con
+    // generateGridGraph vs ImplicitGridGraph (memoria, construcción y
+    // tiempo de BFS, Dijkstra y A*)
+    void benchmarkImplicitGrid(int grid_side, int num_queries = 3);
+    
+    // Benchmark: Dijkstra y A* de GraphSearch sobre listas de adyacencia
+    // (Graph) vs CSR con vecinos y heurística inline, con la heurística
+    // llamada por puntero a función y con heaps de otra aridad
+    void benchmarkTemplatedSearch(int city_nodes, int num_queries = 200);
+    
+    // Benchmark: Dijkstra (Graph y CSR) antes y después de reordenar los
+    // nodos (Hilbert, BFS, RCM); reporta el tiempo por nodo asentado, que
+    // refleja los fallos de caché al tocar el workspace de los vecinos
+    void benchmarkNodeReordering(int city_nodes, int num_queries = 100);
+    
+    // Benchmark: listas de adyacencia y cola de BFS con un new por nodo vs
+    // NodePool (tiempo, llamadas a new, memoria y liberación) en una
+    // cuadrícula de grid_side x grid_side
+    void benchmarkNodePool(int grid_side);
+    
+    // Benchmark: BFS completo con la cola enlazada (heap y NodePool) vs
+    // RingQueue, creciendo y reservada a n, en una cuadrícula de
+    // grid_side x grid_side
+    void benchmarkRingQueue(int grid_side, int repetitions = 3);
+    
     // Limpiar resultados
     void clearResults();
     
@@ -2,6 +2,7 @@
 #define PRIORITY_QUEUE_H
 
 #include "dynamic_array.h"
+#include <utility>
 
 template<typename T>
 class PriorityQueue {
@@ -56,9 +57,9 @@ int PriorityQueue<T>::rightChild(int index) const {
 
 template<typename T>
 void PriorityQueue<T>::swap(int i, int j) {
-    T temp = heap[i];
-    heap[i] = heap[j];
-    heap[j] = temp;
+    T temp = std::move(heap[i]);
+    heap[i] = std::move(heap[j]);
+    heap[j] = std::move(temp);
 }
 
 template<typename T>
@@ -71,21 +72,24 @@ void PriorityQueue<T>::heapifyUp(int index) {
 
 template<typename T>
 void PriorityQueue<T>::heapifyDown(int index) {
-    int minIndex = index;
-    int left = leftChild(index);
-    int right = rightChild(index);
-    
-    if (left < heap.getSize() && heap[left] < heap[minIndex]) {
-        minIndex = left;
-    }
-    
-    if (right < heap.getSize() && heap[right] < heap[minIndex]) {
-        minIndex = right;
-    }
-    
-    if (index != minIndex) {
+    while (true) {
+        int minIndex = index;
+        int left = leftChild(index);
+        int right = rightChild(index);
+        
+        if (left < heap.getSize() && heap[left] < heap[minIndex]) {
+            minIndex = left;
+        }
+        
+        if (right < heap.getSize() && heap[right] < heap[minIndex]) {
+            minIndex = right;
+        }
+        
+        if (index == minIndex) {
+            break;
+        }
         swap(index, minIndex);
-        heapifyDown(minIndex);
+        index = minIndex;
     }
 }
 
@@ -98,7 +102,7 @@ void PriorityQueue<T>::push(const T& element) {
 template<typename T>
 void PriorityQueue<T>::pop() {
     if (!isEmpty()) {
-        heap[0] = heap[heap.getSize() - 1];
+        heap[0] = std::move(heap[heap.getSize() - 1]);
         heap.pop_back();
         if (!isEmpty()) {
             heapifyDown(0);
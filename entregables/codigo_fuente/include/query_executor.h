@@ -0,0 +1,104 @@
+#ifndef QUERY_EXECUTOR_H
+#define QUERY_EXECUTOR_H
+
+#include "graph.h"
+#include "compact_graph.h"
+#include "search_algorithms.h"
+#include "landmarks.h"
+#include "dynamic_array.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Algoritmo de una consulta del lote
+enum QueryAlgorithm {
+    QUERY_BFS,
+    QUERY_DFS,
+    QUERY_DIJKSTRA,
+    QUERY_BEST_FIRST,
+    QUERY_ASTAR,
+    QUERY_BIDIRECTIONAL_DIJKSTRA, // Solo sobre Graph
+    QUERY_BIDIRECTIONAL_ASTAR,    // Solo sobre Graph
+    QUERY_ALT                     // Requiere setLandmarks
+};
+
+// Consulta independiente (IDs externos)
+struct RouteQuery {
+    int start;
+    int goal;
+    QueryAlgorithm algorithm;
+
+    RouteQuery() : start(-1), goal(-1), algorithm(QUERY_DIJKSTRA) {}
+    RouteQuery(int s, int g, QueryAlgorithm a) : start(s), goal(g), algorithm(a) {}
+};
+
+// Ejecuta lotes de consultas de ruta independientes con un grupo fijo de
+// hilos. Los hilos se crean una vez en el constructor y esperan lotes; cada
+// uno tiene su propio SearchAlgorithms (y por lo tanto sus workspaces), así
+// que el grafo solo se lee.
+//
+// Reparto con robo de trabajo: cada hilo recibe un bloque contiguo del lote
+// y toma consultas de él con un contador atómico; al agotarlo, toma
+// consultas pendientes de los bloques de los demás. Las consultas tienen
+// costos muy distintos (origen y destino cercanos o lejanos) y así ningún
+// hilo queda ocioso mientras otro tiene trabajo acumulado. Los resultados se
+// escriben en la posición de cada consulta, en el mismo orden de entrada.
+//
+// El grafo no debe modificarse mientras se ejecuta un lote.
+class QueryExecutor {
+private:
+    // Estado de un hilo. El relleno evita que los contadores de hilos
+    // distintos compartan línea de caché
+    struct Worker {
+        std::atomic<int> next;        // Próxima consulta del bloque de este hilo
+        int end;                      // Fin del bloque (exclusivo)
+        SearchAlgorithms* search;
+        std::thread thread;
+        char padding[64];
+    };
+
+    const Graph* graph;
+    const CompactGraph* compact_graph;
+    Worker* workers;
+    int num_threads;
+
+    // Lote en curso
+    const DynamicArray<RouteQuery>* queries;
+    DynamicArray<SearchResult>* results;
+    std::mutex mutex;
+    std::condition_variable batch_ready;
+    std::condition_variable batch_finished;
+    unsigned int batch_id;           // Se incrementa con cada lote
+    int running_workers;             // Hilos que aún no terminan el lote
+    bool stopping;
+
+    // No copiable (posee hilos)
+    QueryExecutor(const QueryExecutor&) = delete;
+    QueryExecutor& operator=(const QueryExecutor&) = delete;
+
+    void start(int num_threads);
+    void workerLoop(int worker);
+    void processBatch(int worker);
+    static SearchResult execute(SearchAlgorithms& search, const RouteQuery& query);
+
+public:
+    // Constructores: num_threads hilos de trabajo (al menos 1)
+    QueryExecutor(const Graph* graph, int num_threads);
+    QueryExecutor(const CompactGraph* compact_graph, int num_threads);
+
+    // Destructor: detiene y espera a los hilos
+    ~QueryExecutor();
+
+    // Landmarks para QUERY_ALT (deben corresponder al grafo)
+    void setLandmarks(const Landmarks* landmarks);
+
+    // Ejecutar el lote y esperar a que termine. results[i] corresponde a
+    // queries[i]; una consulta con IDs inexistentes retorna sin camino
+    void run(const DynamicArray<RouteQuery>& queries, DynamicArray<SearchResult>& results);
+
+    // Información
+    int getThreadCount() const;
+};
+
+#endif // QUERY_EXECUTOR_H
@@ -1,7 +1,10 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
-template<typename T>
+#include "node_pool.h"
+
+// Cola enlazada; los nodos se piden a 'Allocator' como en LinkedList
+template<typename T, typename Allocator = HeapNodeAllocator>
 class Queue {
 private:
     struct Node {
@@ -14,10 +17,14 @@ private:
     Node* front_node;
     Node* rear_node;
     int size;
+    Allocator allocator;
+    
+    Node* createNode(const T& data);
+    void destroyNode(Node* node);
     
 public:
     // Constructor
-    Queue();
+    explicit Queue(const Allocator& allocator = Allocator());
     
     // Destructor
     ~Queue();
@@ -25,7 +32,7 @@ public:
     // Constructor de copia
     Queue(const Queue& other);
     
-    // Operador de asignación
+    // Operador de asignación (adopta el asignador de 'other')
     Queue& operator=(const Queue& other);
     
     // Métodos principales
@@ -43,16 +50,30 @@ public:
 };
 
 // Implementación de métodos template
-template<typename T>
-Queue<T>::Queue() : front_node(nullptr), rear_node(nullptr), size(0) {}
+template<typename T, typename Allocator>
+typename Queue<T, Allocator>::Node* Queue<T, Allocator>::createNode(const T& data) {
+    void* memory = allocator.allocate(sizeof(Node));
+    return new (memory) Node(data);
+}
+
+template<typename T, typename Allocator>
+void Queue<T, Allocator>::destroyNode(Node* node) {
+    node->~Node();
+    allocator.deallocate(node, sizeof(Node));
+}
+
+template<typename T, typename Allocator>
+Queue<T, Allocator>::Queue(const Allocator& allocator)
+    : front_node(nullptr), rear_node(nullptr), size(0), allocator(allocator) {}
 
-template<typename T>
-Queue<T>::~Queue() {
+template<typename T, typename Allocator>
+Queue<T, Allocator>::~Queue() {
     clear();
 }
 
-template<typename T>
-Queue<T>::Queue(const Queue& other) : front_node(nullptr), rear_node(nullptr), size(0) {
+template<typename T, typename Allocator>
+Queue<T, Allocator>::Queue(const Queue& other)
+    : front_node(nullptr), rear_node(nullptr), size(0), allocator(other.allocator) {
     Node* current = other.front_node;
     while (current) {
         enqueue(current->data);
@@ -60,10 +81,11 @@ Queue<T>::Queue(const Queue& other) : front_node(nullptr), rear_node(nullptr), s
     }
 }
 
-template<typename T>
-Queue<T>& Queue<T>::operator=(const Queue& other) {
+template<typename T, typename Allocator>
+Queue<T, Allocator>& Queue<T, Allocator>::operator=(const Queue& other) {
     if (this != &other) {
         clear();
+        allocator = other.allocator;
         Node* current = other.front_node;
         while (current) {
             enqueue(current->data);
@@ -73,9 +95,9 @@ Queue<T>& Queue<T>::operator=(const Queue& other) {
     return *this;
 }
 
-template<typename T>
-void Queue<T>::enqueue(const T& element) {
-    Node* new_node = new Node(element);
+template<typename T, typename Allocator>
+void Queue<T, Allocator>::enqueue(const T& element) {
+    Node* new_node = createNode(element);
     if (isEmpty()) {
         front_node = rear_node = new_node;
     } else {
@@ -85,63 +107,63 @@ void Queue<T>::enqueue(const T& element) {
     size++;
 }
 
-template<typename T>
-void Queue<T>::dequeue() {
+template<typename T, typename Allocator>
+void Queue<T, Allocator>::dequeue() {
     if (!isEmpty()) {
         Node* to_delete = front_node;
         front_node = front_node->next;
         if (front_node == nullptr) {
             rear_node = nullptr;
         }
-        delete to_delete;
+        destroyNode(to_delete);
         size--;
     }
 }
 
-template<typename T>
-T& Queue<T>::front() {
+template<typename T, typename Allocator>
+T& Queue<T, Allocator>::front() {
     if (isEmpty()) {
         throw "Queue is empty";
     }
     return front_node->data;
 }
 
-template<typename T>
-const T& Queue<T>::front() const {
+template<typename T, typename Allocator>
+const T& Queue<T, Allocator>::front() const {
     if (isEmpty()) {
         throw "Queue is empty";
     }
     return front_node->data;
 }
 
-template<typename T>
-T& Queue<T>::rear() {
+template<typename T, typename Allocator>
+T& Queue<T, Allocator>::rear() {
     if (isEmpty()) {
         throw "Queue is empty";
     }
     return rear_node->data;
 }
 
-template<typename T>
-const T& Queue<T>::rear() const {
+template<typename T, typename Allocator>
+const T& Queue<T, Allocator>::rear() const {
     if (isEmpty()) {
         throw "Queue is empty";
     }
     return rear_node->data;
 }
 
-template<typename T>
-int Queue<T>::getSize() const {
+template<typename T, typename Allocator>
+int Queue<T, Allocator>::getSize() const {
     return size;
 }
 
-template<typename T>
-bool Queue<T>::isEmpty() const {
+template<typename T, typename Allocator>
+bool Queue<T, Allocator>::isEmpty() const {
     return size == 0;
 }
 
-template<typename T>
-void Queue<T>::clear() {
+template<typename T, typename Allocator>
+void Queue<T, Allocator>::clear() {
     while (!isEmpty()) {
         dequeue();
     }
@@ -0,0 +1,182 @@
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+// Cola FIFO sobre un buffer circular contiguo. Misma interfaz que Queue,
+// pero sin un nodo por elemento: enqueue y dequeue solo mueven índices, y
+// los elementos consecutivos comparten líneas de caché. Cuando el buffer se
+// llena, duplica su capacidad (siempre potencia de 2, para envolver los
+// índices con una máscara) y copia los elementos en orden.
+template<typename T>
+class RingQueue {
+private:
+    T* data;
+    int capacity;
+    int head;   // Posición del frente
+    int size;
+
+    void grow(int min_capacity);
+
+public:
+    // Constructor
+    explicit RingQueue(int initial_capacity = 16);
+
+    // Destructor
+    ~RingQueue();
+
+    // Constructor de copia
+    RingQueue(const RingQueue& other);
+
+    // Operador de asignación
+    RingQueue& operator=(const RingQueue& other);
+
+    // Métodos principales
+    void enqueue(const T& element);
+    void dequeue();
+    T& front();
+    const T& front() const;
+    T& rear();
+    const T& rear() const;
+
+    // Reservar espacio para 'min_capacity' elementos (p. ej. la cantidad de
+    // nodos en un BFS completo) y no redimensionar durante la búsqueda
+    void reserve(int min_capacity);
+
+    // Información de la cola
+    int getSize() const;
+    int getCapacity() const;
+    bool isEmpty() const;
+    void clear();
+};
+
+// Implementación de métodos template
+template<typename T>
+RingQueue<T>::RingQueue(int initial_capacity) : data(nullptr), capacity(0), head(0), size(0) {
+    grow(initial_capacity > 0 ? initial_capacity : 1);
+}
+
+template<typename T>
+RingQueue<T>::~RingQueue() {
+    delete[] data;
+}
+
+template<typename T>
+RingQueue<T>::RingQueue(const RingQueue& other) : data(nullptr), capacity(0), head(0), size(0) {
+    grow(other.capacity);
+    for (int i = 0; i < other.size; i++) {
+        data[i] = other.data[(other.head + i) & (other.capacity - 1)];
+    }
+    size = other.size;
+}
+
+template<typename T>
+RingQueue<T>& RingQueue<T>::operator=(const RingQueue& other) {
+    if (this != &other) {
+        clear();
+        if (capacity < other.size) {
+            grow(other.size);
+        }
+        for (int i = 0; i < other.size; i++) {
+            data[i] = other.data[(other.head + i) & (other.capacity - 1)];
+        }
+        size = other.size;
+    }
+    return *this;
+}
+
+// La nueva capacidad es la menor potencia de 2 >= min_capacity (y al menos
+// el doble de la actual); los elementos quedan desde la posición 0
+template<typename T>
+void RingQueue<T>::grow(int min_capacity) {
+    int new_capacity = capacity > 0 ? capacity * 2 : 1;
+    while (new_capacity < min_capacity) {
+        new_capacity *= 2;
+    }
+    T* new_data = new T[new_capacity];
+    for (int i = 0; i < size; i++) {
+        new_data[i] = data[(head + i) & (capacity - 1)];
+    }
+    delete[] data;
+    data = new_data;
+    capacity = new_capacity;
+    head = 0;
+}
+
+template<typename T>
+void RingQueue<T>::reserve(int min_capacity) {
+    if (min_capacity > capacity) {
+        grow(min_capacity);
+    }
+}
+
+template<typename T>
+void RingQueue<T>::enqueue(const T& element) {
+    if (size == capacity) {
+        grow(capacity + 1);
+    }
+    data[(head + size) & (capacity - 1)] = element;
+    size++;
+}
+
+template<typename T>
+void RingQueue<T>::dequeue() {
+    if (!isEmpty()) {
+        head = (head + 1) & (capacity - 1);
+        size--;
+    }
+}
+
+template<typename T>
+T& RingQueue<T>::front() {
+    if (isEmpty()) {
+        throw "Queue is empty";
+    }
+    return data[head];
+}
+
+template<typename T>
+const T& RingQueue<T>::front() const {
+    if (isEmpty()) {
+        throw "Queue is empty";
+    }
+    return data[head];
+}
+
+template<typename T>
+T& RingQueue<T>::rear() {
+    if (isEmpty()) {
+        throw "Queue is empty";
+    }
+    return data[(head + size - 1) & (capacity - 1)];
+}
+
+template<typename T>
+const T& RingQueue<T>::rear() const {
+    if (isEmpty()) {
+        throw "Queue is empty";
+    }
+    return data[(head + size - 1) & (capacity - 1)];
+}
+
+template<typename T>
+int RingQueue<T>::getSize() const {
+    return size;
+}
+
+template<typename T>
+int RingQueue<T>::getCapacity() const {
+    return capacity;
+}
+
+template<typename T>
+bool RingQueue<T>::isEmpty() const {
+    return size == 0;
+}
+
+// Conserva la capacidad; los elementos se sobrescriben al encolar
+template<typename T>
+void RingQueue<T>::clear() {
+    head = 0;
+    size = 0;
+}
+
+#endif // RING_QUEUE_H
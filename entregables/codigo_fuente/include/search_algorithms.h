@@ -2,9 +2,14 @@
 #define SEARCH_ALGORITHMS_H
 
 #include "graph.h"
+#include "compact_graph.h"
+#include "implicit_grid_graph.h"
 #include "dynamic_array.h"
 #include "queue.h"
 #include "priority_queue.h"
+#include "search_workspace.h"
+#include "landmarks.h"
+#include "kd_tree.h"
 #include <chrono>
 
 // Estructura para representar el resultado de una búsqueda
@@ -18,6 +23,52 @@ struct SearchResult {
     SearchResult() : total_distance(0.0), nodes_explored(0), time_taken(0), path_found(false) {}
 };
 
+// Matriz densa de distancias origen x destino, en orden de filas: la
+// distancia de sources[i] a targets[j] está en distances[i * cols + j]
+// (infinito si no hay camino o alguno de los dos IDs no existe)
+struct DistanceMatrix {
+    int rows;
+    int cols;
+    DynamicArray<double> distances;
+    int nodes_explored;               // Nodos asentados sumando todas las filas
+    
+    DistanceMatrix() : rows(0), cols(0), nodes_explored(0) {}
+    
+    double at(int row, int col) const {
+        return distances[row * cols + col];
+    }
+};
+
+// Árbol de caminos mínimos acotado: los nodos a costo <= max_cost del
+// origen, en el orden en que Dijkstra los asentó (distancia creciente). Su
+// tamaño es proporcional a la zona alcanzada, no al grafo
+struct ShortestPathTree {
+    int source;                       // ID del origen (-1 si no existe)
+    double max_cost;
+    DynamicArray<int> nodes;          // IDs de los nodos alcanzados
+    DynamicArray<double> distances;   // Distancia de cada nodo desde el origen
+    DynamicArray<int> parents;        // Posición del padre en 'nodes' (-1 para el origen)
+    
+    ShortestPathTree() : source(-1), max_cost(0.0) {}
+    
+    int getSize() const {
+        return nodes.getSize();
+    }
+    
+    // Camino (IDs) desde el origen hasta nodes[position]
+    DynamicArray<int> pathTo(int position) const;
+};
+
+// Isócrona: zona alcanzable con costo <= max_cost y sus nodos de borde
+// (los de la zona con alguna arista hacia un nodo fuera de ella)
+struct Isochrone {
+    double max_cost;
+    int reachable_count;              // Nodos dentro de la zona
+    DynamicArray<int> boundary_nodes; // IDs, en orden de distancia
+    
+    Isochrone() : max_cost(0.0), reachable_count(0) {}
+};
+
 // Estructura para el algoritmo A*
 struct AStarNode {
     int node_id;
@@ -31,38 +82,131 @@ struct AStarNode {
     AStarNode(int id, double g, double h, int p) 
         : node_id(id), g_cost(g), h_cost(h), f_cost(g + h), parent(p) {}
     
-    // Operador para la cola de prioridad (menor f_cost tiene mayor prioridad)
+    // Operadores para la cola de prioridad. PriorityQueue es un min-heap,
+    // así que el orden natural deja en el tope el menor f_cost
     bool operator<(const AStarNode& other) const {
-        return f_cost > other.f_cost; // Invertido para min-heap
+        return f_cost < other.f_cost;
     }
     
     bool operator>(const AStarNode& other) const {
-        return f_cost < other.f_cost;
+        return f_cost > other.f_cost;
     }
 };
 
 class SearchAlgorithms {
 private:
     const Graph* graph;
+    const CompactGraph* compact_graph; // Si no es nulo, las búsquedas usan el CSR
+    const ImplicitGridGraph* grid_graph; // Si no es nulo, las búsquedas usan la cuadrícula implícita
+    SearchWorkspace workspace;         // Reutilizado por las llamadas sin workspace
+    SearchWorkspace reverse_workspace; // Lado inverso de las búsquedas bidireccionales
+    const Landmarks* landmarks;        // Preprocesamiento ALT (opcional)
+    KdTree compact_spatial_index;      // Coordenadas del CSR (se construye al primer ajuste)
+    DynamicArray<SearchWorkspace> matrix_workspaces; // Hilos adicionales de distanceMatrix
     
     // Funciones auxiliares
     double calculateDistance(const Node* node1, const Node* node2) const;
     DynamicArray<int> reconstructPath(const DynamicArray<int>& parent, int start, int goal) const;
+    DynamicArray<int> reconstructPath(const SearchWorkspace& ws, int start, int goal) const;
+    DynamicArray<int> toNodeIds(const DynamicArray<int>& indices) const; // Índices de Graph -> IDs
+    
+    // Búsqueda bidireccional común a Dijkstra (sin potencial) y A* (potencial promedio)
+    double averagePotential(const Node* node, const Node* start_node, const Node* goal_node) const;
+    SearchResult bidirectionalSearch(int start, int goal, SearchWorkspace& forward_ws,
+                                     SearchWorkspace& backward_ws, bool use_potential);
+    
+    // Una fila de distanceMatrix: Dijkstra uno-a-muchos desde 'source' que
+    // se detiene al asentar todos los destinos marcados en is_target.
+    // Retorna los nodos asentados
+    int matrixRow(int source, const DynamicArray<int>& targets, const DynamicArray<char>& is_target,
+                  int distinct_targets, SearchWorkspace& ws, double* row) const;
+    int compactMatrixRow(int source, const DynamicArray<int>& targets, const DynamicArray<char>& is_target,
+                         int distinct_targets, SearchWorkspace& ws, double* row) const;
+    
+    // Dijkstra acotado a max_cost; deja en ws las distancias y marcas de
+    // asentado (por índice interno) que usa isochrones
+    void growShortestPathTree(int source, double max_cost, SearchWorkspace& ws, ShortestPathTree& tree);
+    
+    // ALT sobre CompactGraph (trabaja con índices internos). Los cinco
+    // algoritmos básicos están en GraphSearch para todas las representaciones
+    void finishCompactResult(SearchResult& result, const SearchWorkspace& ws,
+                             int start_index, int goal_index, bool sum_edge_weights) const;
+    SearchResult compactAltSearch(int start, int goal, SearchWorkspace& ws);
     
 public:
-    // Constructor
+    // Constructores. Sobre ImplicitGridGraph están los cinco algoritmos
+    // básicos (vía GraphSearch) y las consultas por coordenadas; el resto
+    // (bidireccionales, ALT, árboles, isócronas y matriz) no encuentra caminos
     SearchAlgorithms(const Graph* graph);
+    SearchAlgorithms(const CompactGraph* compact_graph);
+    SearchAlgorithms(const ImplicitGridGraph* grid_graph);
     
-    // Algoritmos de búsqueda
+    // Algoritmos de búsqueda (reutilizan el workspace interno de esta instancia)
     SearchResult depthFirstSearch(int start, int goal);
     SearchResult breadthFirstSearch(int start, int goal);
     SearchResult dijkstra(int start, int goal);
     SearchResult bestFirstSearch(int start, int goal);
     SearchResult aStar(int start, int goal);
     
+    // Algoritmos de búsqueda con un workspace externo, para reutilizarlo entre
+    // muchas consultas cortas o tener uno por hilo
+    SearchResult depthFirstSearch(int start, int goal, SearchWorkspace& ws);
+    SearchResult breadthFirstSearch(int start, int goal, SearchWorkspace& ws);
+    SearchResult dijkstra(int start, int goal, SearchWorkspace& ws);
+    SearchResult bestFirstSearch(int start, int goal, SearchWorkspace& ws);
+    SearchResult aStar(int start, int goal, SearchWorkspace& ws);
+    
+    // Búsquedas bidireccionales: hacia adelante sobre las adyacencias y hacia
+    // atrás sobre las aristas entrantes de Graph (no disponibles sobre CSR)
+    SearchResult bidirectionalDijkstra(int start, int goal);
+    SearchResult bidirectionalAStar(int start, int goal);
+    SearchResult bidirectionalDijkstra(int start, int goal, SearchWorkspace& forward_ws,
+                                       SearchWorkspace& backward_ws);
+    SearchResult bidirectionalAStar(int start, int goal, SearchWorkspace& forward_ws,
+                                    SearchWorkspace& backward_ws);
+    
+    // ALT: A* con la cota de landmarks como heurística. Requiere haber
+    // asignado landmarks construidos sobre el mismo grafo; sin ellos no
+    // retorna camino
+    void setLandmarks(const Landmarks* landmarks);
+    SearchResult altSearch(int start, int goal);
+    SearchResult altSearch(int start, int goal, SearchWorkspace& ws);
+    
+    // Consultas por coordenadas: snapToNode retorna el ID del nodo más
+    // cercano (-1 si el grafo está vacío) y routeFromCoordinates ajusta
+    // origen y destino así y busca la ruta con A*
+    int snapToNode(double x, double y);
+    SearchResult routeFromCoordinates(double start_x, double start_y, double goal_x, double goal_y);
+    SearchResult routeFromCoordinates(double start_x, double start_y, double goal_x, double goal_y,
+                                      SearchWorkspace& ws);
+    
+    // Matriz de distancias de cada origen a cada destino (IDs externos). Se
+    // hace un Dijkstra por origen que termina al asentar todos los destinos,
+    // en lugar de uno por par. Los orígenes se reparten entre num_threads
+    // hilos, cada uno con su workspace (se conservan entre llamadas); el
+    // resultado no depende del número de hilos
+    DistanceMatrix distanceMatrix(const DynamicArray<int>& sources, const DynamicArray<int>& targets,
+                                  int num_threads = 1);
+    
+    // Árbol de caminos mínimos desde 'source' hasta costo max_cost. Con el
+    // workspace reutilizado, repetir consultas de radio pequeño cuesta lo
+    // que se explora y no O(V)
+    ShortestPathTree shortestPathTree(int source, double max_cost);
+    ShortestPathTree shortestPathTree(int source, double max_cost, SearchWorkspace& ws);
+    
+    // Isócronas para cada límite de costo de cost_limits con una sola
+    // búsqueda acotada al mayor de ellos. isochrones[b] tiene
+    // los nodos de borde de la zona con costo <= cost_limits[b]
+    DynamicArray<Isochrone> isochrones(int source, const DynamicArray<double>& cost_limits);
+    DynamicArray<Isochrone> isochrones(int source, const DynamicArray<double>& cost_limits,
+                                       SearchWorkspace& ws);
+    
+    // Dijkstra de referencia con selección lineal del mínimo, O(V^2).
+    // Se conserva solo para validar la versión con heap.
+    SearchResult dijkstraLinearScan(int start, int goal);
+    
     // Método para comparar algoritmos
     void compareAlgorithms(int start, int goal);
 };
 
 #endif // SEARCH_ALGORITHMS_H
-
@@ -0,0 +1,150 @@
+#ifndef SEARCH_WORKSPACE_H
+#define SEARCH_WORKSPACE_H
+
+#include "dynamic_array.h"
+#include "indexed_priority_queue.h"
+#include <limits>
+
+// Aridad del heap indexado usado por Dijkstra y A* (ver benchmark "heap")
+const int SEARCH_HEAP_ARITY = 4;
+typedef IndexedPriorityQueue<double, SEARCH_HEAP_ARITY> SearchHeap;
+
+// Estado reutilizable de una búsqueda (distancias, padres, visitados, heap y
+// pila/frontera). Se reserva una sola vez para el tamaño del grafo y cada
+// búsqueda nueva solo incrementa un contador de generación: un slot cuya
+// marca no coincide con la generación actual se considera "no tocado" y se
+// lee con sus valores iniciales (distancia infinita, sin padre, no visitado).
+// Así, reiniciar cuesta O(nodos tocados) en lugar de O(V).
+//
+// Un workspace no debe compartirse entre hilos; cada hilo usa el suyo.
+class SearchWorkspace {
+private:
+    struct Slot {
+        double distance;
+        int parent;
+        unsigned int stamp;   // Generación en que se inicializó el slot
+    };
+
+    DynamicArray<Slot> slots;
+    DynamicArray<unsigned int> visited_stamp; // Generación en que se visitó
+    SearchHeap heap;
+    DynamicArray<int> frontier;               // Pila de DFS / buffer auxiliar
+    unsigned int generation;
+    int capacity;
+
+    void touch(int index);
+
+public:
+    // Constructor
+    SearchWorkspace(int capacity = 0);
+
+    // Preparar una búsqueda nueva sobre un grafo de 'node_count' nodos.
+    // Solo es O(node_count) cuando el workspace debe crecer.
+    void prepare(int node_count);
+
+    // Distancia / g_score (infinito si el slot no se tocó en esta búsqueda)
+    double getDistance(int index) const;
+    void setDistance(int index, double distance);
+
+    // Padre en el árbol de búsqueda (-1 si no tiene)
+    int getParent(int index) const;
+    void setParent(int index, int parent);
+
+    // Marca de visitado / cerrado
+    bool isVisited(int index) const;
+    void setVisited(int index);
+
+    // Estructuras auxiliares reutilizables (vacías tras prepare)
+    SearchHeap& getHeap();
+    DynamicArray<int>& getFrontier();
+
+    // Información
+    int getCapacity() const;
+    unsigned int getGeneration() const;
+};
+
+// Implementación de métodos
+inline SearchWorkspace::SearchWorkspace(int capacity) : generation(1), capacity(0) {
+    if (capacity > 0) {
+        prepare(capacity);
+    }
+}
+
+inline void SearchWorkspace::prepare(int node_count) {
+    if (node_count > capacity) {
+        // Crecer: los slots nuevos nacen con marca 0 (nunca tocados)
+        Slot empty_slot = {0.0, -1, 0};
+        slots.resize(node_count, empty_slot);
+        visited_stamp.resize(node_count, 0);
+        heap.reset(node_count);
+        capacity = node_count;
+    } else {
+        heap.clear();
+    }
+    frontier.clear();
+
+    generation++;
+    if (generation == 0) {
+        // Desbordamiento del contador (cada 2^32 búsquedas): limpiar marcas
+        for (int i = 0; i < capacity; i++) {
+            slots[i].stamp = 0;
+            visited_stamp[i] = 0;
+        }
+        generation = 1;
+    }
+}
+
+inline void SearchWorkspace::touch(int index) {
+    Slot& slot = slots[index];
+    if (slot.stamp != generation) {
+        slot.distance = std::numeric_limits<double>::infinity();
+        slot.parent = -1;
+        slot.stamp = generation;
+    }
+}
+
+inline double SearchWorkspace::getDistance(int index) const {
+    const Slot& slot = slots[index];
+    return slot.stamp == generation ? slot.distance : std::numeric_limits<double>::infinity();
+}
+
+inline void SearchWorkspace::setDistance(int index, double distance) {
+    touch(index);
+    slots[index].distance = distance;
+}
+
+inline int SearchWorkspace::getParent(int index) const {
+    const Slot& slot = slots[index];
+    return slot.stamp == generation ? slot.parent : -1;
+}
+
+inline void SearchWorkspace::setParent(int index, int parent) {
+    touch(index);
+    slots[index].parent = parent;
+}
+
+inline bool SearchWorkspace::isVisited(int index) const {
+    return visited_stamp[index] == generation;
+}
+
+inline void SearchWorkspace::setVisited(int index) {
+    visited_stamp[index] = generation;
+}
+
+inline SearchHeap& SearchWorkspace::getHeap() {
+    return heap;
+}
+
+inline DynamicArray<int>& SearchWorkspace::getFrontier() {
+    return frontier;
+}
+
+inline int SearchWorkspace::getCapacity() const {
+    return capacity;
+}
+
+inline unsigned int SearchWorkspace::getGeneration() const {
+    return generation;
+}
+
+#endif // SEARCH_WORKSPACE_H
@@ -0,0 +1,62 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "node.h"
+#include "dynamic_array.h"
+#include <utility>
+
+// Índice espacial de cuadrícula uniforme (buckets). El rectángulo que
+// contiene los puntos se divide en celdas cuadradas y cada celda guarda los
+// índices de sus puntos en formato CSR (cell_offsets / cell_items), así que
+// construirlo es O(n) con dos pasadas de conteo.
+//
+// Una consulta de vecinos recorre anillos de celdas alrededor del punto y se
+// detiene cuando el anillo siguiente ya no puede contener nada más cercano
+// que el k-ésimo encontrado (o que la distancia máxima); las celdas más
+// lejanas que ese límite se omiten sin leer sus puntos. El tamaño de celda
+// automático parte de ~1 punto por celda y se reduce si los puntos están
+// agrupados, sin pasar de O(n) celdas.
+class SpatialGrid {
+private:
+    // Ocupación objetivo (puntos por celda vistos por un punto típico) al
+    // elegir el tamaño de celda automáticamente
+    enum { TARGET_OCCUPANCY = 4 };
+
+    double min_x;
+    double min_y;
+    double cell_size;
+    int columns;
+    int rows;
+    DynamicArray<int> cell_offsets;   // columns * rows + 1 entradas
+    DynamicArray<int> cell_items;     // Índices de puntos agrupados por celda
+    DynamicArray<double> xs;          // Coordenadas en el mismo orden que cell_items
+    DynamicArray<double> ys;
+
+    // Funciones auxiliares
+    int columnFor(double x) const;
+    int rowFor(double y) const;
+    bool fitCells(double width, double height, long long max_cells);
+    void countCells(DynamicArray<int>& cell_of);
+
+public:
+    // Constructor
+    SpatialGrid();
+
+    // Construir sobre las posiciones de 'nodes' (los resultados son índices
+    // en ese array). Con cell_size <= 0 se elige según la densidad.
+    void build(const DynamicArray<Node>& nodes, double cell_size = 0.0);
+
+    // Los k puntos más cercanos a (x, y) a distancia <= max_distance, en
+    // orden creciente de distancia (empates por índice). 'exclude' permite
+    // omitir el propio punto de la consulta (-1 para no omitir ninguno).
+    // Retorna el número de vecinos encontrados.
+    int kNearest(double x, double y, int k, double max_distance, int exclude,
+                 DynamicArray<std::pair<double, int>>& neighbors) const;
+
+    // Información
+    int getItemCount() const;
+    int getCellCount() const;
+    double getCellSize() const;
+};
+
+#endif // SPATIAL_GRID_H
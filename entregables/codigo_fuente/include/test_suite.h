@@ -18,6 +18,7 @@ private:
     void assert_equals(int expected, int actual, const std::string& test_name);
     void assert_equals(double expected, double actual, const std::string& test_name, double tolerance = 0.001);
     void print_test_result(const std::string& test_name, bool passed);
+    std::string findTestDataFile(const std::string& filename) const;
     
 public:
     // Constructor
@@ -30,21 +31,43 @@ public:
     void testDynamicArray();
     void testLinkedList();
     void testQueue();
+    void testRingQueue();
     void testPriorityQueue();
+    void testIndexedPriorityQueue();
+    void testHashIndex();
     
     // Tests de grafo
     void testGraphBasicOperations();
     void testGraphConnectivity();
     void testGraphEdgeWeights();
+    void testCompactGraph();
+    void testMappedCompactGraph();
     
     // Tests de algoritmos de búsqueda
     void testSearchAlgorithmsSmallGraph();
     void testSearchAlgorithmsDisconnectedGraph();
     void testSearchAlgorithmsOptimality();
+    void testDijkstraHeapMatchesLinearScan();
+    void testSearchWorkspaceReuse();
+    void testBidirectionalSearch();
+    void testLandmarksAlt();
+    void testContractionHierarchy();
+    void testDistanceMatrix();
+    void testQueryExecutor();
+    void testDeltaStepping();
+    void testShortestPathTree();
+    void testJumpPointSearch();
+    void testImplicitGridGraph();
+    void testGraphSearchPolicies();
+    void testSparseNodeIds();
+    void testNodeReordering();
+    void testNodePool();
     void testSearchAlgorithmsPerformance();
     
     // Tests de generación de grafos grandes
     void testLargeGraphGeneration();
+    void testSpatialGrid();
+    void testKdTree();
     void testGraphSaveLoad();
     
     // Tests de casos extremos
@@ -53,6 +76,8 @@ public:
     
     // Tests de validación de datos
     void testDataValidation();
+    void testCSVLoading();
+    void testParallelCSVLoading();
     
     // Mostrar resumen de resultados
     void printSummary();
@@ -17,6 +17,7 @@ private:
     static const int WINDOW_HEIGHT = 600;
     static const int NODE_RADIUS = 8;
     static const int SELECTED_NODE_RADIUS = 12;
+    static const int VIEW_MARGIN = 50;
     
     // Colores
     sf::Color NODE_COLOR = sf::Color::Blue;
@@ -35,7 +36,14 @@ private:
     sf::Font font;
     bool font_loaded = false;
     
+    // Transformación mundo -> pantalla, calculada una vez al recibir el
+    // grafo (nodeToScreen y getNodeAtPosition no recorren los nodos)
+    double view_min_x = 0.0;
+    double view_min_y = 0.0;
+    double view_scale = 1.0;
+    
     // Funciones auxiliares
+    void updateViewTransform();
     sf::Vector2f nodeToScreen(const Node* node) const;
     int getNodeAtPosition(sf::Vector2f position) const;
     void drawNodes();
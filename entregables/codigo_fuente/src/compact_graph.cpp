@@ -0,0 +1,468 @@
+#include "../include/compact_graph.h"
+#include "../include/parallel_for.h"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <climits>
+
+// Cabecera del formato binario de CompactGraph. Los enteros de tamaño fijo
+// hacen que el diseño no dependa del compilador; el orden de bytes se
+// verifica con 'byte_order' al abrir.
+enum CompactSection {
+    SECTION_OFFSETS,
+    SECTION_TARGETS,
+    SECTION_WEIGHTS,
+    SECTION_NODE_IDS,
+    SECTION_COORD_X,
+    SECTION_COORD_Y,
+    SECTION_NAME_OFFSETS,
+    SECTION_NAME_CHARS,
+    SECTION_HASH_KEYS,
+    SECTION_HASH_VALUES,
+    SECTION_COUNT
+};
+
+struct CompactGraphHeader {
+    char magic[4];                          // "CSRG"
+    uint32_t version;
+    uint32_t byte_order;                    // COMPACT_BYTE_ORDER en orden nativo
+    int32_t node_count;
+    int32_t edge_count;
+    int32_t hash_capacity;
+    int32_t name_bytes;
+    int32_t reserved;
+    uint64_t section_offset[SECTION_COUNT];
+    uint64_t file_size;
+};
+
+static const char COMPACT_MAGIC[4] = {'C', 'S', 'R', 'G'};
+static const uint32_t COMPACT_VERSION = 1;
+static const uint32_t COMPACT_BYTE_ORDER = 0x01020304u;
+static const uint64_t COMPACT_ALIGNMENT = 8;
+
+static uint64_t alignSection(uint64_t position) {
+    return (position + COMPACT_ALIGNMENT - 1) / COMPACT_ALIGNMENT * COMPACT_ALIGNMENT;
+}
+
+// Tamaño en bytes de cada sección según los conteos de la cabecera
+static uint64_t sectionBytes(const CompactGraphHeader& header, int section) {
+    uint64_t n = static_cast<uint64_t>(header.node_count);
+    uint64_t m = static_cast<uint64_t>(header.edge_count);
+    uint64_t capacity = static_cast<uint64_t>(header.hash_capacity);
+    switch (section) {
+        case SECTION_OFFSETS:      return (n + 1) * sizeof(int32_t);
+        case SECTION_TARGETS:      return m * sizeof(int32_t);
+        case SECTION_WEIGHTS:      return m * sizeof(double);
+        case SECTION_NODE_IDS:     return n * sizeof(int32_t);
+        case SECTION_COORD_X:      return n * sizeof(double);
+        case SECTION_COORD_Y:      return n * sizeof(double);
+        case SECTION_NAME_OFFSETS: return (n + 1) * sizeof(int32_t);
+        case SECTION_NAME_CHARS:   return static_cast<uint64_t>(header.name_bytes);
+        case SECTION_HASH_KEYS:    return capacity * sizeof(int32_t);
+        case SECTION_HASH_VALUES:  return capacity * sizeof(int32_t);
+    }
+    return 0;
+}
+
+// Constructores
+CompactGraph::CompactGraph() : node_count(0), edge_count(0) {
+    offsets.push_back(0);
+    name_offsets.push_back(0);
+    bindOwned();
+}
+
+CompactGraph::CompactGraph(const Graph& graph) : node_count(0), edge_count(0) {
+    build(graph);
+}
+
+CompactGraph::CompactGraph(const CompactGraph& other) : node_count(0), edge_count(0) {
+    offsets.push_back(0);
+    name_offsets.push_back(0);
+    bindOwned();
+    *this = other;
+}
+
+// Un grafo proyectado se copia proyectando de nuevo el mismo archivo (las
+// páginas se comparten); si ya no se puede abrir, se copian los datos
+CompactGraph& CompactGraph::operator=(const CompactGraph& other) {
+    if (this == &other) {
+        return *this;
+    }
+    if (other.isMapped() && mapFromBinary(other.mapping.getFilename())) {
+        return *this;
+    }
+
+    mapping.close();
+    node_count = other.node_count;
+    edge_count = other.edge_count;
+    int name_bytes = other.name_offsets_data[node_count];
+
+    offsets = DynamicArray<int>(node_count + 1);
+    targets = DynamicArray<int>(edge_count > 0 ? edge_count : 1);
+    weights = DynamicArray<double>(edge_count > 0 ? edge_count : 1);
+    node_ids = DynamicArray<int>(node_count > 0 ? node_count : 1);
+    coord_x = DynamicArray<double>(node_count > 0 ? node_count : 1);
+    coord_y = DynamicArray<double>(node_count > 0 ? node_count : 1);
+    name_offsets = DynamicArray<int>(node_count + 1);
+    name_chars = DynamicArray<char>(name_bytes > 0 ? name_bytes : 1);
+    id_index.clear();
+    id_index.reserve(node_count);
+
+    for (int i = 0; i <= node_count; i++) {
+        offsets.push_back(other.offsets_data[i]);
+        name_offsets.push_back(other.name_offsets_data[i]);
+    }
+    for (int e = 0; e < edge_count; e++) {
+        targets.push_back(other.targets_data[e]);
+        weights.push_back(other.weights_data[e]);
+    }
+    for (int i = 0; i < node_count; i++) {
+        node_ids.push_back(other.ids_data[i]);
+        coord_x.push_back(other.x_data[i]);
+        coord_y.push_back(other.y_data[i]);
+        id_index.insert(other.ids_data[i], i);
+    }
+    for (int c = 0; c < name_bytes; c++) {
+        name_chars.push_back(other.name_data[c]);
+    }
+
+    bindOwned();
+    return *this;
+}
+
+// Apuntar la vista al almacenamiento propio
+void CompactGraph::bindOwned() {
+    offsets_data = offsets.begin();
+    targets_data = targets.begin();
+    weights_data = weights.begin();
+    ids_data = node_ids.begin();
+    x_data = coord_x.begin();
+    y_data = coord_y.begin();
+    name_offsets_data = name_offsets.begin();
+    name_data = name_chars.begin();
+    hash_keys = id_index.getKeyTable();
+    hash_values = id_index.getValueTable();
+    hash_capacity = id_index.getCapacity();
+}
+
+// Construir la instantánea a partir de las listas de adyacencia actuales
+void CompactGraph::build(const Graph& graph) {
+    mapping.close();
+
+    const DynamicArray<Node>& nodes = graph.getAllNodes();
+    node_count = nodes.getSize();
+    edge_count = graph.getEdgeCount();
+
+    offsets = DynamicArray<int>(node_count + 1);
+    targets = DynamicArray<int>(edge_count > 0 ? edge_count : 1);
+    weights = DynamicArray<double>(edge_count > 0 ? edge_count : 1);
+    node_ids = DynamicArray<int>(node_count > 0 ? node_count : 1);
+    coord_x = DynamicArray<double>(node_count > 0 ? node_count : 1);
+    coord_y = DynamicArray<double>(node_count > 0 ? node_count : 1);
+    name_offsets = DynamicArray<int>(node_count + 1);
+    name_chars = DynamicArray<char>(node_count > 0 ? node_count * 8 : 1);
+    id_index.clear();
+    id_index.reserve(node_count);
+
+    // Los índices internos coinciden con el orden de getAllNodes()
+    name_offsets.push_back(0);
+    for (int i = 0; i < node_count; i++) {
+        node_ids.push_back(nodes[i].getId());
+        coord_x.push_back(nodes[i].getX());
+        coord_y.push_back(nodes[i].getY());
+        id_index.insert(nodes[i].getId(), i);
+
+        std::string name = nodes[i].getName();
+        for (size_t c = 0; c < name.size(); c++) {
+            name_chars.push_back(name[c]);
+        }
+        name_offsets.push_back(name_chars.getSize());
+    }
+
+    // Copiar las listas de adyacencia en orden (las aristas ya guardan el
+    // índice interno del destino)
+    offsets.push_back(0);
+    for (int i = 0; i < node_count; i++) {
+        const EdgeList& adjacencies = graph.getAdjacenciesAt(i);
+        for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
+            targets.push_back((*it).getDestinationIndex());
+            weights.push_back((*it).getWeight());
+        }
+        offsets.push_back(targets.getSize());
+    }
+
+    bindOwned();
+}
+
+// Construir directamente desde listas de nodos y aristas
+void CompactGraph::buildFromEdgeList(const DynamicArray<int>& ids, const DynamicArray<double>& xs,
+                                     const DynamicArray<double>& ys, const DynamicArray<int>& node_name_offsets,
+                                     const DynamicArray<char>& node_name_chars, const DynamicArray<int>& sources,
+                                     const DynamicArray<int>& destinations, const DynamicArray<double>& edge_weights,
+                                     int num_threads) {
+    mapping.close();
+
+    node_count = ids.getSize();
+    edge_count = sources.getSize();
+    node_ids = ids;
+    coord_x = xs;
+    coord_y = ys;
+    name_offsets = node_name_offsets;
+    name_chars = node_name_chars;
+    id_index.clear();
+    id_index.reserve(node_count);
+    for (int i = 0; i < node_count; i++) {
+        id_index.insert(ids[i], i);
+    }
+
+    // Arrays del CSR ya dimensionados: cada hilo escribe en posiciones propias
+    offsets = DynamicArray<int>(0);
+    offsets.resize(node_count + 1, 0);
+    targets = DynamicArray<int>(0);
+    targets.resize(edge_count, 0);
+    weights = DynamicArray<double>(0);
+    weights.resize(edge_count, 0.0);
+
+    // El hilo t procesa el tramo de aristas [edge_begin(t), edge_begin(t + 1))
+    // y el rango de nodos [range_begin(t), range_begin(t + 1)). Cada hilo
+    // tiene un histograma de grados de n enteros (fila t de 'slot')
+    if (num_threads < 1) num_threads = 1;
+    if (num_threads > edge_count) num_threads = edge_count > 0 ? edge_count : 1;
+    while (num_threads > 1 && static_cast<long long>(num_threads) * node_count > INT_MAX) {
+        num_threads--;
+    }
+    DynamicArray<int> edge_begin(num_threads + 1);
+    DynamicArray<int> range_begin(num_threads + 1);
+    for (int t = 0; t <= num_threads; t++) {
+        edge_begin.push_back(static_cast<int>(static_cast<long long>(edge_count) * t / num_threads));
+        range_begin.push_back(static_cast<int>(static_cast<long long>(node_count) * t / num_threads));
+    }
+    DynamicArray<int> slot(0);
+    slot.resize(num_threads * node_count, 0);
+    DynamicArray<int> range_total(0);
+    range_total.resize(num_threads, 0);
+
+    // 1. Grados por tramo: cada hilo cuenta solo sus aristas, O(m / hilos)
+    parallelFor(num_threads, num_threads, [&](int t) {
+        int* counts = slot.begin() + static_cast<size_t>(t) * node_count;
+        for (int e = edge_begin[t]; e < edge_begin[t + 1]; e++) {
+            counts[sources[e]]++;
+        }
+    });
+
+    // 2. Por rango de nodos: el conteo (t, v) pasa a ser la posición de la
+    //    primera arista del tramo t dentro de la lista de v (suma de los
+    //    tramos anteriores), el grado de v va a offsets[v + 1] y se hace la
+    //    suma prefija local del rango
+    parallelFor(num_threads, num_threads, [&](int t) {
+        int low = range_begin[t], high = range_begin[t + 1];
+        for (int v = low; v < high; v++) {
+            int degree = 0;
+            for (int k = 0; k < num_threads; k++) {
+                int& count = slot[k * node_count + v];
+                int slice_count = count;
+                count = degree;
+                degree += slice_count;
+            }
+            offsets[v + 1] = degree;
+        }
+        for (int v = low + 1; v < high; v++) {
+            offsets[v + 1] += offsets[v];
+        }
+        range_total[t] = high > low ? offsets[high] : 0;
+    });
+
+    // 3. Suma prefija de los totales por rango (secuencial, un valor por hilo)
+    //    y corrección de cada rango con el total de los anteriores
+    DynamicArray<int> range_base(num_threads);
+    int running = 0;
+    for (int t = 0; t < num_threads; t++) {
+        range_base.push_back(running);
+        running += range_total[t];
+    }
+    parallelFor(num_threads, num_threads, [&](int t) {
+        for (int v = range_begin[t] + 1; v <= range_begin[t + 1]; v++) {
+            offsets[v] += range_base[t];
+        }
+    });
+
+    // 4. Reparto: cada hilo coloca las aristas de su tramo, en orden, desde
+    //    sus propias posiciones; los tramos quedan en orden dentro de cada
+    //    lista, así que el orden por nodo es el de entrada
+    parallelFor(num_threads, num_threads, [&](int t) {
+        int* next = slot.begin() + static_cast<size_t>(t) * node_count;
+        for (int e = edge_begin[t]; e < edge_begin[t + 1]; e++) {
+            int source = sources[e];
+            int position = offsets[source] + next[source]++;
+            targets[position] = destinations[e];
+            weights[position] = edge_weights[e];
+        }
+    });
+
+    bindOwned();
+}
+
+// Guardar en el formato binario proyectable
+bool CompactGraph::saveToBinary(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: No se pudo crear el archivo " << filename << std::endl;
+        return false;
+    }
+
+    CompactGraphHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, COMPACT_MAGIC, sizeof(header.magic));
+    header.version = COMPACT_VERSION;
+    header.byte_order = COMPACT_BYTE_ORDER;
+    header.node_count = node_count;
+    header.edge_count = edge_count;
+    header.hash_capacity = hash_capacity;
+    header.name_bytes = name_offsets_data[node_count];
+
+    const char* sections[SECTION_COUNT] = {
+        reinterpret_cast<const char*>(offsets_data),
+        reinterpret_cast<const char*>(targets_data),
+        reinterpret_cast<const char*>(weights_data),
+        reinterpret_cast<const char*>(ids_data),
+        reinterpret_cast<const char*>(x_data),
+        reinterpret_cast<const char*>(y_data),
+        reinterpret_cast<const char*>(name_offsets_data),
+        name_data,
+        reinterpret_cast<const char*>(hash_keys),
+        reinterpret_cast<const char*>(hash_values)
+    };
+
+    uint64_t position = alignSection(sizeof(header));
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        header.section_offset[s] = position;
+        position = alignSection(position + sectionBytes(header, s));
+    }
+    header.file_size = position;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    uint64_t written = sizeof(header);
+    const char padding[COMPACT_ALIGNMENT] = {0};
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        file.write(padding, static_cast<std::streamsize>(header.section_offset[s] - written));
+        file.write(sections[s], static_cast<std::streamsize>(sectionBytes(header, s)));
+        written = header.section_offset[s] + sectionBytes(header, s);
+    }
+    file.write(padding, static_cast<std::streamsize>(header.file_size - written));
+
+    file.close();
+    return file.good();
+}
+
+// Proyectar un archivo guardado con saveToBinary. Solo se valida la
+// cabecera y los límites de cada sección; los datos se leen en su lugar
+bool CompactGraph::mapFromBinary(const std::string& filename) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+
+    CompactGraphHeader header;
+    if (file.getSize() < sizeof(header)) {
+        std::cerr << "Error: Archivo demasiado pequeño para un grafo CSR: " << filename << std::endl;
+        return false;
+    }
+    std::memcpy(&header, file.getData(), sizeof(header));
+
+    if (std::memcmp(header.magic, COMPACT_MAGIC, sizeof(header.magic)) != 0 ||
+        header.byte_order != COMPACT_BYTE_ORDER) {
+        std::cerr << "Error: " << filename << " no es un grafo CSR en este orden de bytes" << std::endl;
+        return false;
+    }
+    if (header.version != COMPACT_VERSION) {
+        std::cerr << "Error: Versión de formato no soportada (" << header.version
+                  << ") en " << filename << std::endl;
+        return false;
+    }
+    bool capacity_ok = header.hash_capacity > header.node_count &&
+                       (header.hash_capacity & (header.hash_capacity - 1)) == 0;
+    if (header.node_count < 0 || header.edge_count < 0 || header.name_bytes < 0 || !capacity_ok ||
+        header.file_size != file.getSize()) {
+        std::cerr << "Error: Cabecera inconsistente en " << filename << std::endl;
+        return false;
+    }
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        if (header.section_offset[s] % COMPACT_ALIGNMENT != 0 ||
+            header.section_offset[s] + sectionBytes(header, s) > header.file_size) {
+            std::cerr << "Error: Sección fuera de límites en " << filename << std::endl;
+            return false;
+        }
+    }
+
+    const char* base = file.getData();
+    const int* mapped_offsets = reinterpret_cast<const int*>(base + header.section_offset[SECTION_OFFSETS]);
+    const int* mapped_names = reinterpret_cast<const int*>(base + header.section_offset[SECTION_NAME_OFFSETS]);
+    if (mapped_offsets[0] != 0 || mapped_offsets[header.node_count] != header.edge_count ||
+        mapped_names[0] != 0 || mapped_names[header.node_count] != header.name_bytes) {
+        std::cerr << "Error: Offsets CSR inconsistentes en " << filename << std::endl;
+        return false;
+    }
+
+    // Liberar el almacenamiento propio y apuntar la vista al archivo
+    mapping.swap(file);
+    offsets = DynamicArray<int>(1);
+    targets = DynamicArray<int>(1);
+    weights = DynamicArray<double>(1);
+    node_ids = DynamicArray<int>(1);
+    coord_x = DynamicArray<double>(1);
+    coord_y = DynamicArray<double>(1);
+    name_offsets = DynamicArray<int>(1);
+    name_chars = DynamicArray<char>(1);
+    id_index.clear();
+
+    node_count = header.node_count;
+    edge_count = header.edge_count;
+    offsets_data = mapped_offsets;
+    targets_data = reinterpret_cast<const int*>(base + header.section_offset[SECTION_TARGETS]);
+    weights_data = reinterpret_cast<const double*>(base + header.section_offset[SECTION_WEIGHTS]);
+    ids_data = reinterpret_cast<const int*>(base + header.section_offset[SECTION_NODE_IDS]);
+    x_data = reinterpret_cast<const double*>(base + header.section_offset[SECTION_COORD_X]);
+    y_data = reinterpret_cast<const double*>(base + header.section_offset[SECTION_COORD_Y]);
+    name_offsets_data = mapped_names;
+    name_data = base + header.section_offset[SECTION_NAME_CHARS];
+    hash_keys = reinterpret_cast<const int*>(base + header.section_offset[SECTION_HASH_KEYS]);
+    hash_values = reinterpret_cast<const int*>(base + header.section_offset[SECTION_HASH_VALUES]);
+    hash_capacity = header.hash_capacity;
+    return true;
+}
+
+bool CompactGraph::isMapped() const {
+    return mapping.isOpen();
+}
+
+// Información general
+bool CompactGraph::hasNode(int node_id) const {
+    return getNodeIndex(node_id) != -1;
+}
+
+std::string CompactGraph::getName(int index) const {
+    int begin = name_offsets_data[index];
+    return std::string(name_data + begin, name_offsets_data[index + 1] - begin);
+}
+
+// Peso de la primera arista index -> target_index (-1.0 si no existe)
+double CompactGraph::getEdgeWeight(int index, int target_index) const {
+    for (int e = offsets_data[index]; e < offsets_data[index + 1]; e++) {
+        if (targets_data[e] == target_index) {
+            return weights_data[e];
+        }
+    }
+    return -1.0;
+}
+
+// Memoria ocupada por los arrays CSR (bytes)
+size_t CompactGraph::getMemoryUsage() const {
+    size_t memory = 0;
+    memory += static_cast<size_t>(node_count + 1) * sizeof(int);          // offsets
+    memory += static_cast<size_t>(edge_count) * (sizeof(int) + sizeof(double)); // targets + weights
+    memory += static_cast<size_t>(node_count) * (sizeof(int) + 2 * sizeof(double)); // IDs y coordenadas
+    memory += static_cast<size_t>(node_count + 1) * sizeof(int) + name_offsets_data[node_count]; // nombres
+    memory += static_cast<size_t>(hash_capacity) * 2 * sizeof(int);
+    return memory;
+}
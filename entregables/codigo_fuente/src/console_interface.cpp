@@ -10,7 +10,8 @@ void showMenu() {
     std::cout << "2. Buscar ruta entre dos ubicaciones" << std::endl;
     std::cout << "3. Comparar todos los algoritmos" << std::endl;
     std::cout << "4. Generar mapa sintético y probar" << std::endl;
-    std::cout << "5. Salir" << std::endl;
+    std::cout << "5. Buscar ruta por coordenadas" << std::endl;
+    std::cout << "6. Salir" << std::endl;
     std::cout << "Seleccione una opción: ";
 }
 
@@ -113,6 +114,53 @@ void searchRoute(const Graph& graph) {
     }
 }
 
+void searchRouteByCoordinates(const Graph& graph) {
+    SearchAlgorithms search(&graph);
+    
+    std::cout << "\n=== Búsqueda de Ruta por Coordenadas ===" << std::endl;
+    
+    double start_x, start_y, goal_x, goal_y;
+    std::cout << "Ingrese coordenadas de inicio (x y): ";
+    std::cin >> start_x >> start_y;
+    std::cout << "Ingrese coordenadas de destino (x y): ";
+    std::cin >> goal_x >> goal_y;
+    
+    // Cada punto se ajusta a la ubicación más cercana del mapa
+    const Node* start_node = graph.getNode(search.snapToNode(start_x, start_y));
+    const Node* goal_node = graph.getNode(search.snapToNode(goal_x, goal_y));
+    if (!start_node || !goal_node) {
+        std::cout << "Error: El mapa no tiene ubicaciones." << std::endl;
+        return;
+    }
+    
+    std::cout << "\nUbicación más cercana al inicio: " << start_node->getName()
+              << " (ID " << start_node->getId() << ")" << std::endl;
+    std::cout << "Ubicación más cercana al destino: " << goal_node->getName()
+              << " (ID " << goal_node->getId() << ")" << std::endl;
+    
+    SearchResult result = search.routeFromCoordinates(start_x, start_y, goal_x, goal_y);
+    
+    std::cout << "\n=== Resultado de A* ===" << std::endl;
+    
+    if (result.path_found) {
+        std::cout << "Ruta: ";
+        for (int i = 0; i < result.path.getSize(); i++) {
+            const Node* node = graph.getNode(result.path[i]);
+            if (node) {
+                std::cout << node->getName();
+                if (i < result.path.getSize() - 1) {
+                    std::cout << " -> ";
+                }
+            }
+        }
+        std::cout << std::endl;
+        std::cout << "Distancia total: " << result.total_distance << " unidades" << std::endl;
+        std::cout << "Nodos explorados: " << result.nodes_explored << std::endl;
+    } else {
+        std::cout << "No se encontró un camino entre las ubicaciones." << std::endl;
+    }
+}
+
 void testSyntheticMap() {
     std::cout << "\n=== Prueba con Mapa Sintético ===" << std::endl;
     
@@ -185,6 +233,9 @@ int main() {
                 testSyntheticMap();
                 break;
             case 5:
+                searchRouteByCoordinates(graph);
+                break;
+            case 6:
                 std::cout << "¡Gracias por usar el sistema!" << std::endl;
                 break;
             default:
@@ -192,13 +243,13 @@ int main() {
                 break;
         }
         
-        if (choice != 5) {
+        if (choice != 6) {
             std::cout << "\nPresione Enter para continuar...";
             std::cin.ignore();
             std::cin.get();
         }
         
-    } while (choice != 5);
+    } while (choice != 6);
     
     return 0;
 }
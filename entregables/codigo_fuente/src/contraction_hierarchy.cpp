@@ -0,0 +1,624 @@
+#include "../include/contraction_hierarchy.h"
+#include "../include/indexed_priority_queue.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <limits>
+
+// Arco del grafo dinámico usado durante la contracción. Las listas de
+// salida y de entrada de cada nodo se enlazan sobre un único pool de arcos,
+// en lugar de reservar un contenedor por nodo.
+struct ChArc {
+    int other;      // Destino (lista de salida) u origen (lista de entrada)
+    double weight;
+    int middle;     // Nodo intermedio si es un atajo, -1 si es original
+    int next;       // Siguiente arco de la misma lista (-1 al final)
+};
+
+// Arista ya asignada a la jerarquía, pendiente de agrupar en CSR
+struct ChEmitted {
+    int owner;      // Nodo por el que se agrupa
+    int other;
+    double weight;
+    int middle;
+};
+
+struct ChDynamicGraph {
+    DynamicArray<int> out_head;
+    DynamicArray<int> in_head;
+    DynamicArray<ChArc> arcs;
+    DynamicArray<bool> contracted;
+
+    void init(int n, int arc_capacity) {
+        out_head = DynamicArray<int>(n > 0 ? n : 1);
+        in_head = DynamicArray<int>(n > 0 ? n : 1);
+        contracted = DynamicArray<bool>(n > 0 ? n : 1);
+        arcs = DynamicArray<ChArc>(arc_capacity > 0 ? arc_capacity : 1);
+        for (int i = 0; i < n; i++) {
+            out_head.push_back(-1);
+            in_head.push_back(-1);
+            contracted.push_back(false);
+        }
+    }
+
+    int link(int head, int other, double weight, int middle) {
+        ChArc arc = {other, weight, middle, head};
+        arcs.push_back(arc);
+        return arcs.getSize() - 1;
+    }
+
+    // Agregar u -> x, o mejorar su peso si ya existe (sin aristas paralelas)
+    void addOrImprove(int u, int x, double weight, int middle) {
+        for (int a = out_head[u]; a != -1; a = arcs[a].next) {
+            if (arcs[a].other != x) continue;
+            if (weight < arcs[a].weight) {
+                arcs[a].weight = weight;
+                arcs[a].middle = middle;
+                for (int b = in_head[x]; b != -1; b = arcs[b].next) {
+                    if (arcs[b].other == u) {
+                        arcs[b].weight = weight;
+                        arcs[b].middle = middle;
+                        break;
+                    }
+                }
+            }
+            return;
+        }
+        out_head[u] = link(out_head[u], x, weight, middle);
+        in_head[x] = link(in_head[x], u, weight, middle);
+    }
+
+    // Quitar de las listas de v los arcos hacia nodos ya contraídos, para que
+    // los nodos de rango alto no acumulen arcos muertos
+    void prune(int v) {
+        for (int side = 0; side < 2; side++) {
+            int& head = side == 0 ? out_head[v] : in_head[v];
+            int kept = -1;
+            int a = head;
+            head = -1;
+            while (a != -1) {
+                int next = arcs[a].next;
+                if (!contracted[arcs[a].other]) {
+                    if (kept == -1) {
+                        head = a;
+                    } else {
+                        arcs[kept].next = a;
+                    }
+                    kept = a;
+                }
+                a = next;
+            }
+            if (kept != -1) {
+                arcs[kept].next = -1;
+            }
+        }
+    }
+
+    bool alive(int other, int v) const {
+        return other != v && !contracted[other];
+    }
+};
+
+// Dijkstra local desde 'source' que ignora 'excluded' y los nodos ya
+// contraídos. Se detiene al superar 'max_cost' o el límite de asentados.
+static void witnessSearch(const ChDynamicGraph& graph, SearchWorkspace& ws, int source,
+                          int excluded, double max_cost, int settle_limit) {
+    ws.prepare(graph.out_head.getSize());
+    SearchHeap& heap = ws.getHeap();
+    ws.setDistance(source, 0.0);
+    heap.push(source, 0.0);
+
+    int settled = 0;
+    while (!heap.isEmpty() && heap.topPriority() <= max_cost && settled < settle_limit) {
+        int u = heap.top();
+        heap.pop();
+        settled++;
+
+        double distance_u = ws.getDistance(u);
+        for (int a = graph.out_head[u]; a != -1; a = graph.arcs[a].next) {
+            int x = graph.arcs[a].other;
+            if (x == excluded || graph.contracted[x]) continue;
+            double new_distance = distance_u + graph.arcs[a].weight;
+            if (new_distance <= max_cost && new_distance < ws.getDistance(x)) {
+                ws.setDistance(x, new_distance);
+                heap.pushOrDecrease(x, new_distance);
+            }
+        }
+    }
+}
+
+// Simula (apply = false) o realiza la contracción de v. Retorna el número de
+// atajos necesarios y deja en 'removed' las aristas que desaparecen con v.
+static int contractNode(ChDynamicGraph& graph, SearchWorkspace& ws, int v, bool apply,
+                        int settle_limit, int& removed) {
+    removed = 0;
+    double max_out = 0.0;
+    for (int a = graph.out_head[v]; a != -1; a = graph.arcs[a].next) {
+        if (!graph.alive(graph.arcs[a].other, v)) continue;
+        removed++;
+        if (graph.arcs[a].weight > max_out) max_out = graph.arcs[a].weight;
+    }
+
+    int shortcuts = 0;
+    for (int a = graph.in_head[v]; a != -1; a = graph.arcs[a].next) {
+        int u = graph.arcs[a].other;
+        if (!graph.alive(u, v)) continue;
+        removed++;
+        double w1 = graph.arcs[a].weight;
+
+        witnessSearch(graph, ws, u, v, w1 + max_out, settle_limit);
+
+        for (int b = graph.out_head[v]; b != -1; b = graph.arcs[b].next) {
+            int x = graph.arcs[b].other;
+            if (!graph.alive(x, v) || x == u) continue;
+            double via = w1 + graph.arcs[b].weight;
+            if (ws.getDistance(x) <= via) continue; // Hay testigo
+            shortcuts++;
+            if (apply) {
+                graph.addOrImprove(u, x, via, v);
+            }
+        }
+    }
+    return shortcuts;
+}
+
+// Agrupar aristas emitidas por 'owner' en formato CSR
+static void groupEmitted(const DynamicArray<ChEmitted>& emitted, int n, DynamicArray<int>& offsets,
+                         DynamicArray<int>& others, DynamicArray<double>& weights,
+                         DynamicArray<int>& middles) {
+    int m = emitted.getSize();
+    offsets = DynamicArray<int>(n + 1);
+    others = DynamicArray<int>(m > 0 ? m : 1);
+    weights = DynamicArray<double>(m > 0 ? m : 1);
+    middles = DynamicArray<int>(m > 0 ? m : 1);
+
+    for (int i = 0; i <= n; i++) {
+        offsets.push_back(0);
+    }
+    for (int e = 0; e < m; e++) {
+        offsets[emitted[e].owner + 1]++;
+    }
+    for (int i = 0; i < n; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    for (int e = 0; e < m; e++) {
+        others.push_back(0);
+        weights.push_back(0.0);
+        middles.push_back(-1);
+    }
+
+    DynamicArray<int> next(n > 0 ? n : 1);
+    for (int i = 0; i < n; i++) {
+        next.push_back(offsets[i]);
+    }
+    for (int e = 0; e < m; e++) {
+        int slot = next[emitted[e].owner]++;
+        others[slot] = emitted[e].other;
+        weights[slot] = emitted[e].weight;
+        middles[slot] = emitted[e].middle;
+    }
+}
+
+// Constructor
+ContractionHierarchy::ContractionHierarchy()
+    : node_count(0), shortcut_count(0), preprocessing_ms(0.0) {
+    up_offsets.push_back(0);
+    down_offsets.push_back(0);
+}
+
+void ContractionHierarchy::build(const Graph& graph) {
+    CompactGraph compact(graph);
+    build(compact);
+}
+
+void ContractionHierarchy::build(const CompactGraph& graph) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    int n = graph.getNodeCount();
+    node_count = n;
+    node_ids = DynamicArray<int>(n > 0 ? n : 1);
+    rank = DynamicArray<int>(n > 0 ? n : 1);
+    id_index.clear();
+    id_index.reserve(n);
+    for (int i = 0; i < n; i++) {
+        node_ids.push_back(graph.getNodeId(i));
+        rank.push_back(-1);
+        id_index.insert(graph.getNodeId(i), i);
+    }
+
+    // Grafo dinámico inicial (sin lazos ni aristas paralelas)
+    ChDynamicGraph dynamic;
+    dynamic.init(n, 2 * graph.getEdgeCount());
+    for (int u = 0; u < n; u++) {
+        for (int e = graph.edgesBegin(u); e < graph.edgesEnd(u); e++) {
+            if (graph.getTarget(e) != u) {
+                dynamic.addOrImprove(u, graph.getTarget(e), graph.getWeight(e), -1);
+            }
+        }
+    }
+
+    // Prioridad inicial: diferencia de aristas
+    SearchWorkspace ws(n);
+    IndexedPriorityQueue<int, 4> queue(n);
+    DynamicArray<int> deleted_neighbors(n > 0 ? n : 1);
+    DynamicArray<int> last_update(n > 0 ? n : 1);
+    for (int v = 0; v < n; v++) {
+        int removed = 0;
+        int shortcuts = contractNode(dynamic, ws, v, false, SIMULATION_SETTLE_LIMIT, removed);
+        queue.push(v, shortcuts - removed);
+        deleted_neighbors.push_back(0);
+        last_update.push_back(-1);
+    }
+
+    DynamicArray<ChEmitted> up_edges(n > 0 ? n : 1);
+    DynamicArray<ChEmitted> down_edges(n > 0 ? n : 1);
+    int order = 0;
+
+    while (!queue.isEmpty()) {
+        int v = queue.top();
+
+        // Actualización perezosa: recalcular la prioridad del mínimo y
+        // contraerlo solo si sigue siendo el mínimo
+        int removed = 0;
+        int shortcuts = contractNode(dynamic, ws, v, false, SIMULATION_SETTLE_LIMIT, removed);
+        queue.changePriority(v, shortcuts - removed + deleted_neighbors[v]);
+        if (queue.top() != v) {
+            continue;
+        }
+        queue.pop();
+
+        // Las aristas de v hacia nodos aún no contraídos pasan a la jerarquía
+        for (int a = dynamic.out_head[v]; a != -1; a = dynamic.arcs[a].next) {
+            const ChArc& arc = dynamic.arcs[a];
+            if (!dynamic.alive(arc.other, v)) continue;
+            ChEmitted edge = {v, arc.other, arc.weight, arc.middle};
+            up_edges.push_back(edge);
+        }
+        for (int a = dynamic.in_head[v]; a != -1; a = dynamic.arcs[a].next) {
+            const ChArc& arc = dynamic.arcs[a];
+            if (!dynamic.alive(arc.other, v)) continue;
+            ChEmitted edge = {v, arc.other, arc.weight, arc.middle};
+            down_edges.push_back(edge);
+        }
+
+        contractNode(dynamic, ws, v, true, WITNESS_SETTLE_LIMIT, removed);
+        dynamic.contracted[v] = true;
+        rank[v] = order;
+
+        // Actualizar la prioridad de los vecinos (una vez por vecino)
+        for (int side = 0; side < 2; side++) {
+            int head = side == 0 ? dynamic.out_head[v] : dynamic.in_head[v];
+            for (int a = head; a != -1; a = dynamic.arcs[a].next) {
+                int w = dynamic.arcs[a].other;
+                if (dynamic.contracted[w] || last_update[w] == order) continue;
+                last_update[w] = order;
+                deleted_neighbors[w]++;
+                dynamic.prune(w);
+                int w_removed = 0;
+                int w_shortcuts = contractNode(dynamic, ws, w, false, SIMULATION_SETTLE_LIMIT, w_removed);
+                queue.changePriority(w, w_shortcuts - w_removed + deleted_neighbors[w]);
+            }
+        }
+        order++;
+    }
+
+    groupEmitted(up_edges, n, up_offsets, up_targets, up_weights, up_middle);
+    groupEmitted(down_edges, n, down_offsets, down_sources, down_weights, down_middle);
+
+    shortcut_count = 0;
+    for (int e = 0; e < up_middle.getSize(); e++) {
+        if (up_middle[e] != -1) shortcut_count++;
+    }
+    for (int e = 0; e < down_middle.getSize(); e++) {
+        if (down_middle[e] != -1) shortcut_count++;
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    preprocessing_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
+
+// Nodo intermedio de la arista u -> x de la jerarquía (-2 si no existe)
+int ContractionHierarchy::findMiddle(int u, int x) const {
+    if (rank[u] < rank[x]) {
+        for (int e = up_offsets[u]; e < up_offsets[u + 1]; e++) {
+            if (up_targets[e] == x) return up_middle[e];
+        }
+    } else {
+        for (int e = down_offsets[x]; e < down_offsets[x + 1]; e++) {
+            if (down_sources[e] == u) return down_middle[e];
+        }
+    }
+    return -2;
+}
+
+// Desempaquetar u -> x en aristas originales (iterativo: los atajos pueden
+// anidarse tanto como niveles tenga la jerarquía)
+void ContractionHierarchy::unpackEdge(int u, int x, DynamicArray<int>& path) const {
+    DynamicArray<int> stack;  // Pares (origen, destino) pendientes
+    stack.push_back(u);
+    stack.push_back(x);
+
+    while (!stack.isEmpty()) {
+        int to = stack[stack.getSize() - 1];
+        stack.pop_back();
+        int from = stack[stack.getSize() - 1];
+        stack.pop_back();
+
+        int middle = findMiddle(from, to);
+        if (middle < 0) {
+            path.push_back(to);
+            continue;
+        }
+        // La pila es LIFO: apilar primero la segunda mitad
+        stack.push_back(middle);
+        stack.push_back(to);
+        stack.push_back(from);
+        stack.push_back(middle);
+    }
+}
+
+SearchResult ContractionHierarchy::query(int start, int goal) {
+    return query(start, goal, forward_workspace, backward_workspace);
+}
+
+SearchResult ContractionHierarchy::query(int start, int goal, SearchWorkspace& forward_ws,
+                                         SearchWorkspace& backward_ws) const {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    SearchResult result;
+
+    int s = id_index.find(start);
+    int t = id_index.find(goal);
+    if (s == -1 || t == -1) {
+        return result;
+    }
+
+    const double INF = std::numeric_limits<double>::infinity();
+    forward_ws.prepare(node_count);
+    backward_ws.prepare(node_count);
+    forward_ws.setDistance(s, 0.0);
+    backward_ws.setDistance(t, 0.0);
+    forward_ws.getHeap().push(s, 0.0);
+    backward_ws.getHeap().push(t, 0.0);
+
+    double best = INF;
+    int meeting = -1;
+    int nodes_explored = 0;
+
+    while (true) {
+        SearchHeap& forward_heap = forward_ws.getHeap();
+        SearchHeap& backward_heap = backward_ws.getHeap();
+
+        // Cada lado termina cuando su mínimo ya no puede mejorar 'best'
+        bool forward_active = !forward_heap.isEmpty() && forward_heap.topPriority() < best;
+        bool backward_active = !backward_heap.isEmpty() && backward_heap.topPriority() < best;
+        if (!forward_active && !backward_active) {
+            break;
+        }
+
+        bool forward = forward_active &&
+                       (!backward_active || forward_heap.topPriority() <= backward_heap.topPriority());
+        SearchWorkspace& ws = forward ? forward_ws : backward_ws;
+        const SearchWorkspace& other_ws = forward ? backward_ws : forward_ws;
+        SearchHeap& heap = ws.getHeap();
+
+        int u = heap.top();
+        heap.pop();
+        nodes_explored++;
+
+        double distance_u = ws.getDistance(u);
+        double through_u = distance_u + other_ws.getDistance(u);
+        if (through_u < best) {
+            best = through_u;
+            meeting = u;
+        }
+
+        // Stall-on-demand: si un nodo de rango mayor ya alcanzado llega a u
+        // más barato (por una arista que baja hacia u), la distancia de u no
+        // es la mínima y no vale la pena expandirlo
+        const DynamicArray<int>& stall_offsets = forward ? down_offsets : up_offsets;
+        const DynamicArray<int>& stall_others = forward ? down_sources : up_targets;
+        const DynamicArray<double>& stall_weights = forward ? down_weights : up_weights;
+        bool stalled = false;
+        for (int e = stall_offsets[u]; e < stall_offsets[u + 1] && !stalled; e++) {
+            stalled = ws.getDistance(stall_others[e]) + stall_weights[e] < distance_u;
+        }
+        if (stalled) {
+            continue;
+        }
+
+        const DynamicArray<int>& offsets = forward ? up_offsets : down_offsets;
+        const DynamicArray<int>& others = forward ? up_targets : down_sources;
+        const DynamicArray<double>& weights = forward ? up_weights : down_weights;
+        for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+            int v = others[e];
+            double new_distance = distance_u + weights[e];
+            if (new_distance < ws.getDistance(v)) {
+                ws.setDistance(v, new_distance);
+                ws.setParent(v, u);
+                heap.pushOrDecrease(v, new_distance);
+            }
+        }
+    }
+
+    if (meeting != -1) {
+        // Camino en la jerarquía: s -> meeting (subiendo) y meeting -> t
+        DynamicArray<int> upward;
+        for (int current = meeting; current != -1; current = forward_ws.getParent(current)) {
+            upward.push_back(current);
+            if (current == s) break;
+        }
+
+        DynamicArray<int> index_path;
+        index_path.push_back(s);
+        for (int i = upward.getSize() - 1; i > 0; i--) {
+            unpackEdge(upward[i], upward[i - 1], index_path);
+        }
+        for (int current = meeting; current != t; ) {
+            int next = backward_ws.getParent(current);
+            unpackEdge(current, next, index_path);
+            current = next;
+        }
+
+        for (int i = 0; i < index_path.getSize(); i++) {
+            result.path.push_back(node_ids[index_path[i]]);
+        }
+        result.path_found = true;
+        result.total_distance = best;
+    }
+
+    result.nodes_explored = nodes_explored;
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+
+    return result;
+}
+
+// Escritura/lectura de arrays con su tamaño como prefijo
+template<typename T>
+static void writeArray(std::ofstream& file, const DynamicArray<T>& array) {
+    int size = array.getSize();
+    file.write(reinterpret_cast<const char*>(&size), sizeof(int));
+    if (size > 0) {
+        file.write(reinterpret_cast<const char*>(&array[0]), static_cast<size_t>(size) * sizeof(T));
+    }
+}
+
+template<typename T>
+static bool readArray(std::ifstream& file, DynamicArray<T>& array, int expected_size) {
+    int size = -1;
+    file.read(reinterpret_cast<char*>(&size), sizeof(int));
+    if (!file || size < 0 || (expected_size >= 0 && size != expected_size)) {
+        return false;
+    }
+    DynamicArray<T> loaded(size > 0 ? size : 1);
+    for (int i = 0; i < size; i++) {
+        loaded.push_back(T());
+    }
+    if (size > 0) {
+        file.read(reinterpret_cast<char*>(&loaded[0]), static_cast<size_t>(size) * sizeof(T));
+    }
+    if (!file) {
+        return false;
+    }
+    array = loaded;
+    return true;
+}
+
+// Guardar la jerarquía en archivo binario
+bool ContractionHierarchy::saveToBinary(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: No se pudo crear el archivo " << filename << std::endl;
+        return false;
+    }
+
+    const char magic[4] = {'C', 'H', '0', '1'};
+    file.write(magic, 4);
+    file.write(reinterpret_cast<const char*>(&node_count), sizeof(int));
+    file.write(reinterpret_cast<const char*>(&shortcut_count), sizeof(int));
+    writeArray(file, node_ids);
+    writeArray(file, rank);
+    writeArray(file, up_offsets);
+    writeArray(file, up_targets);
+    writeArray(file, up_weights);
+    writeArray(file, up_middle);
+    writeArray(file, down_offsets);
+    writeArray(file, down_sources);
+    writeArray(file, down_weights);
+    writeArray(file, down_middle);
+
+    file.close();
+    return true;
+}
+
+// Cargar una jerarquía guardada con saveToBinary
+bool ContractionHierarchy::loadFromBinary(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo " << filename << std::endl;
+        return false;
+    }
+
+    char magic[4];
+    int file_nodes = -1, file_shortcuts = 0;
+    file.read(magic, 4);
+    file.read(reinterpret_cast<char*>(&file_nodes), sizeof(int));
+    file.read(reinterpret_cast<char*>(&file_shortcuts), sizeof(int));
+    if (!file || magic[0] != 'C' || magic[1] != 'H' || magic[2] != '0' || magic[3] != '1' || file_nodes < 0) {
+        std::cerr << "Error: " << filename << " no es un archivo de Contraction Hierarchies" << std::endl;
+        return false;
+    }
+
+    DynamicArray<int> ids, ranks, uo, ut, um, dof, ds, dm;
+    DynamicArray<double> uw, dw;
+    bool ok = readArray(file, ids, file_nodes) && readArray(file, ranks, file_nodes) &&
+              readArray(file, uo, file_nodes + 1) && readArray(file, ut, -1) &&
+              readArray(file, uw, ut.getSize()) && readArray(file, um, ut.getSize()) &&
+              readArray(file, dof, file_nodes + 1) && readArray(file, ds, -1) &&
+              readArray(file, dw, ds.getSize()) && readArray(file, dm, ds.getSize());
+    if (!ok || uo[file_nodes] != ut.getSize() || dof[file_nodes] != ds.getSize()) {
+        std::cerr << "Error: archivo de Contraction Hierarchies corrupto: " << filename << std::endl;
+        return false;
+    }
+
+    node_count = file_nodes;
+    shortcut_count = file_shortcuts;
+    node_ids = ids;
+    rank = ranks;
+    up_offsets = uo;
+    up_targets = ut;
+    up_weights = uw;
+    up_middle = um;
+    down_offsets = dof;
+    down_sources = ds;
+    down_weights = dw;
+    down_middle = dm;
+    preprocessing_ms = 0.0;
+
+    id_index.clear();
+    id_index.reserve(node_count);
+    for (int i = 0; i < node_count; i++) {
+        id_index.insert(node_ids[i], i);
+    }
+    return true;
+}
+
+// Archivo de la jerarquía asociado a un grafo guardado con saveGraphToBinary
+std::string ContractionHierarchy::hierarchyFileFor(const std::string& graph_filename) {
+    return graph_filename + ".ch";
+}
+
+// Información
+bool ContractionHierarchy::isEmpty() const {
+    return node_count == 0;
+}
+
+int ContractionHierarchy::getNodeCount() const {
+    return node_count;
+}
+
+int ContractionHierarchy::getEdgeCount() const {
+    return up_targets.getSize() + down_sources.getSize();
+}
+
+int ContractionHierarchy::getShortcutCount() const {
+    return shortcut_count;
+}
+
+int ContractionHierarchy::getRank(int index) const {
+    return rank[index];
+}
+
+double ContractionHierarchy::getPreprocessingTime() const {
+    return preprocessing_ms;
+}
+
+size_t ContractionHierarchy::getMemoryUsage() const {
+    size_t edges = static_cast<size_t>(getEdgeCount());
+    size_t memory = 0;
+    memory += static_cast<size_t>(node_count) * 2 * sizeof(int);                // IDs y rangos
+    memory += static_cast<size_t>(node_count + 1) * 2 * sizeof(int);            // offsets
+    memory += edges * (2 * sizeof(int) + sizeof(double));                      // extremo, intermedio, peso
+    memory += static_cast<size_t>(id_index.getCapacity()) * 2 * sizeof(int);
+    return memory;
+}
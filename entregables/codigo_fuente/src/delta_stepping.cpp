@@ -0,0 +1,312 @@
+#include "../include/delta_stepping.h"
+#include "../include/parallel_for.h"
+#include <limits>
+
+// Solicitud de relajación: llegar a 'target' con 'distance' desde 'source'
+struct RelaxRequest {
+    int target;
+    int source;
+    double distance;
+};
+
+// Estado propio de cada hilo (solo lo escribe ese hilo, salvo que los
+// buffers de salida los leen los dueños de los destinos)
+struct DeltaThreadState {
+    DynamicArray<DynamicArray<int>> buckets; // Nodos propios por cubeta, en forma cíclica (puede haber entradas viejas)
+    DynamicArray<int> frontier[2];           // Nodos propios de la fase actual / siguiente
+    DynamicArray<int> removed;               // Nodos que salieron de la cubeta actual
+    long long next_bucket;                   // Menor cubeta propia no vacía tras la actual
+    bool frontier_active;                    // Hay nodos para otra fase liviana
+    char padding[64];
+};
+
+// Dueño de un nodo: bloques de 64 índices repartidos en forma cíclica
+static inline int ownerOf(int index, int num_threads) {
+    return (index >> 6) % num_threads;
+}
+
+// Máximo de cubetas vivas a la vez: un delta menor que el peso máximo
+// dividido por este valor se ensancha
+static const int MAX_LIVE_BUCKETS = 1 << 16;
+
+// Mayor peso finito del grafo (0 si no hay aristas)
+static double maxFiniteWeight(const CompactGraph& graph) {
+    const double INF = std::numeric_limits<double>::infinity();
+    double max_weight = 0.0;
+    for (int e = 0; e < graph.getEdgeCount(); e++) {
+        double weight = graph.getWeight(e);
+        if (weight > max_weight && weight != INF) max_weight = weight;
+    }
+    return max_weight;
+}
+
+// Cubeta de una distancia finita. Con width >= max_weight / MAX_LIVE_BUCKETS
+// y distancias <= (n - 1) * max_weight, el cociente cabe en un long long
+static inline long long bucketOf(double distance, double width) {
+    return static_cast<long long>(distance / width);
+}
+
+// Constructor
+DeltaStepping::DeltaStepping(const CompactGraph* graph)
+    : graph(graph), delta(0.0), last_delta(0.0), bucket_count(0), phase_count(0) {}
+
+void DeltaStepping::setDelta(double value) {
+    delta = value;
+}
+
+double DeltaStepping::autoDelta(const CompactGraph& graph) {
+    int n = graph.getNodeCount();
+    int m = graph.getEdgeCount();
+    if (n == 0 || m == 0) {
+        return 1.0;
+    }
+    double sum = 0.0;
+    double max_weight = 0.0;
+    for (int e = 0; e < m; e++) {
+        double weight = graph.getWeight(e);
+        sum += weight;
+        if (weight > max_weight) max_weight = weight;
+    }
+    double mean = sum / m;
+    double average_degree = static_cast<double>(m) / n;
+    double result = max_weight / average_degree > mean ? max_weight / average_degree : mean;
+    return result > 0.0 ? result : 1.0;
+}
+
+bool DeltaStepping::run(int source, DynamicArray<double>& distances, DynamicArray<int>& parents, int num_threads) {
+    const double INF = std::numeric_limits<double>::infinity();
+    int n = graph->getNodeCount();
+    distances = DynamicArray<double>(n > 0 ? n : 1);
+    parents = DynamicArray<int>(n > 0 ? n : 1);
+    for (int i = 0; i < n; i++) {
+        distances.push_back(INF);
+        parents.push_back(-1);
+    }
+    bucket_count = 0;
+    phase_count = 0;
+
+    int source_index = graph->getNodeIndex(source);
+    if (source_index == -1) {
+        return false;
+    }
+    if (num_threads < 1) num_threads = 1;
+    double width = delta > 0.0 ? delta : autoDelta(*graph);
+    double max_weight = maxFiniteWeight(*graph);
+    if (width < max_weight / MAX_LIVE_BUCKETS) {
+        width = max_weight / MAX_LIVE_BUCKETS;
+    }
+    last_delta = width;
+
+    // Las distancias tentativas pendientes están entre current * width y
+    // current * width + max_weight, así que basta un arreglo cíclico de
+    // cubetas (potencia de 2) con más de max_weight / width + 2 posiciones
+    int slot_count = 4;
+    while (slot_count < max_weight / width + 3) {
+        slot_count *= 2;
+    }
+    long long slot_mask = slot_count - 1;
+
+    // Marcas por nodo (las escribe solo el dueño): fase en que entró a la
+    // frontera y ronda (cubeta procesada) en que salió, para no repetirlo
+    // en 'removed'
+    DynamicArray<int> frontier_stamp(n);
+    DynamicArray<int> removed_stamp(n);
+    for (int i = 0; i < n; i++) {
+        frontier_stamp.push_back(0);
+        removed_stamp.push_back(0);
+    }
+    // Cubeta en la que está pendiente cada nodo; las entradas de otras
+    // cubetas son viejas. No siempre coincide con bucketOf(distancia): ver
+    // applyRequests
+    DynamicArray<long long> bucket_stamp(0);
+    bucket_stamp.resize(n, -1);
+
+    DeltaThreadState* states = new DeltaThreadState[num_threads];
+    for (int t = 0; t < num_threads; t++) {
+        states[t].buckets.resize(slot_count, DynamicArray<int>(0));
+    }
+    DynamicArray<RelaxRequest>* outboxes = new DynamicArray<RelaxRequest>[num_threads * num_threads];
+    ThreadBarrier barrier(num_threads);
+
+    double* dist = distances.begin();
+    int* parent = parents.begin();
+    int* frontier_mark = frontier_stamp.begin();
+    int* removed_mark = removed_stamp.begin();
+    long long* assigned_bucket = bucket_stamp.begin();
+    const CompactGraph& g = *graph;
+
+    dist[source_index] = 0.0;
+    assigned_bucket[source_index] = 0;
+    states[ownerOf(source_index, num_threads)].buckets[0].push_back(source_index);
+
+    int buckets_processed = 0;
+    int phases = 0;
+
+    // Todos los hilos ejecutan el mismo bucle y toman las mismas decisiones
+    // (siguiente cubeta, fin de fase) a partir de los valores publicados
+    // antes de cada barrera
+    parallelFor(num_threads, num_threads, [&](int t) {
+        DeltaThreadState& state = states[t];
+        DynamicArray<RelaxRequest>* my_outboxes = outboxes + t * num_threads;
+        long long current = 0;
+        int phase = 0;
+        int round = 0;
+
+        // Aplicar las solicitudes dirigidas a los nodos de este hilo. Las
+        // que mejoran la distancia y caen en la cubeta actual van a la
+        // próxima frontera; las demás, a su cubeta. Ninguna va a una cubeta
+        // menor que 'min_bucket': en la fase pesada es current + 1, porque
+        // el redondeo de du + w con w apenas mayor que delta puede dar la
+        // cubeta actual, y la frontera de esa fase ya no se procesa
+        auto applyRequests = [&](DynamicArray<int>& next_frontier, long long min_bucket) {
+            phase++;
+            next_frontier.clear();
+            for (int s = 0; s < num_threads; s++) {
+                const DynamicArray<RelaxRequest>& inbox = outboxes[s * num_threads + t];
+                for (int r = 0; r < inbox.getSize(); r++) {
+                    const RelaxRequest& request = inbox[r];
+                    int v = request.target;
+                    if (request.distance < dist[v]) {
+                        dist[v] = request.distance;
+                        parent[v] = request.source;
+                        long long bucket = bucketOf(request.distance, width);
+                        if (bucket < min_bucket) bucket = min_bucket;
+                        assigned_bucket[v] = bucket;
+                        if (bucket == current) {
+                            if (frontier_mark[v] != phase) {
+                                frontier_mark[v] = phase;
+                                next_frontier.push_back(v);
+                            }
+                        } else {
+                            state.buckets[bucket & slot_mask].push_back(v);
+                        }
+                    } else if (request.distance == dist[v] && request.source < parent[v]) {
+                        parent[v] = request.source;
+                    }
+                }
+            }
+        };
+
+        while (true) {
+            // Frontera inicial: entradas vigentes de la cubeta actual
+            int cur = 0;
+            DynamicArray<int>& frontier = state.frontier[cur];
+            frontier.clear();
+            phase++;
+            round++;
+            DynamicArray<int>& bucket = state.buckets[current & slot_mask];
+            for (int k = 0; k < bucket.getSize(); k++) {
+                int v = bucket[k];
+                if (assigned_bucket[v] == current && frontier_mark[v] != phase) {
+                    frontier_mark[v] = phase;
+                    frontier.push_back(v);
+                }
+            }
+            bucket.clear();
+            state.removed.clear();
+
+            // Fases livianas hasta que la cubeta quede vacía en todos los hilos
+            while (true) {
+                for (int s = 0; s < num_threads; s++) {
+                    my_outboxes[s].clear();
+                }
+                const DynamicArray<int>& active = state.frontier[cur];
+                for (int k = 0; k < active.getSize(); k++) {
+                    int u = active[k];
+                    if (removed_mark[u] != round) {
+                        removed_mark[u] = round;
+                        state.removed.push_back(u);
+                    }
+                    double du = dist[u];
+                    int end = g.edgesEnd(u);
+                    for (int e = g.edgesBegin(u); e < end; e++) {
+                        double weight = g.getWeight(e);
+                        if (weight > width) continue;
+                        int v = g.getTarget(e);
+                        double candidate = du + weight;
+                        if (candidate <= dist[v]) {
+                            RelaxRequest request = {v, u, candidate};
+                            my_outboxes[ownerOf(v, num_threads)].push_back(request);
+                        }
+                    }
+                }
+                barrier.wait();
+
+                applyRequests(state.frontier[1 - cur], current);
+                cur = 1 - cur;
+                state.frontier_active = state.frontier[cur].getSize() > 0;
+                barrier.wait();
+
+                bool any_active = false;
+                for (int s = 0; s < num_threads; s++) {
+                    any_active = any_active || states[s].frontier_active;
+                }
+                if (t == 0) phases++;
+                if (!any_active) break;
+            }
+
+            // Fase pesada: una vez por cada nodo que salió de la cubeta
+            for (int s = 0; s < num_threads; s++) {
+                my_outboxes[s].clear();
+            }
+            for (int k = 0; k < state.removed.getSize(); k++) {
+                int u = state.removed[k];
+                double du = dist[u];
+                int end = g.edgesEnd(u);
+                for (int e = g.edgesBegin(u); e < end; e++) {
+                    double weight = g.getWeight(e);
+                    if (weight <= width) continue;
+                    int v = g.getTarget(e);
+                    double candidate = du + weight;
+                    if (candidate <= dist[v]) {
+                        RelaxRequest request = {v, u, candidate};
+                        my_outboxes[ownerOf(v, num_threads)].push_back(request);
+                    }
+                }
+            }
+            barrier.wait();
+
+            applyRequests(state.frontier[1 - cur], current + 1);
+            state.next_bucket = -1;
+            for (long long b = current + 1; b < current + slot_count; b++) {
+                if (state.buckets[b & slot_mask].getSize() > 0) {
+                    state.next_bucket = b;
+                    break;
+                }
+            }
+            barrier.wait();
+
+            if (t == 0) {
+                phases++;
+                buckets_processed++;
+            }
+            long long next = -1;
+            for (int s = 0; s < num_threads; s++) {
+                if (states[s].next_bucket != -1 && (next == -1 || states[s].next_bucket < next)) {
+                    next = states[s].next_bucket;
+                }
+            }
+            if (next == -1) break;
+            current = next;
+        }
+    });
+
+    bucket_count = buckets_processed;
+    phase_count = phases;
+    delete[] outboxes;
+    delete[] states;
+    return true;
+}
+
+// Estadísticas
+double DeltaStepping::getLastDelta() const {
+    return last_delta;
+}
+
+int DeltaStepping::getBucketCount() const {
+    return bucket_count;
+}
+
+int DeltaStepping::getPhaseCount() const {
+    return phase_count;
+}
@@ -1,11 +1,11 @@
 #include "../include/edge.h"
 
 // Constructor por defecto
-Edge::Edge() : source(-1), destination(-1), weight(0.0) {}
+Edge::Edge() : source(-1), destination(-1), weight(0.0), source_index(-1), destination_index(-1) {}
 
 // Constructor
 Edge::Edge(int source, int destination, double weight) 
-    : source(source), destination(destination), weight(weight) {}
+    : source(source), destination(destination), weight(weight), source_index(-1), destination_index(-1) {}
 
 // Getters
 int Edge::getSource() const {
@@ -20,11 +20,24 @@ double Edge::getWeight() const {
     return weight;
 }
 
+int Edge::getSourceIndex() const {
+    return source_index;
+}
+
+int Edge::getDestinationIndex() const {
+    return destination_index;
+}
+
 // Setters
 void Edge::setWeight(double weight) {
     this->weight = weight;
 }
 
+void Edge::setIndices(int source_index, int destination_index) {
+    this->source_index = source_index;
+    this->destination_index = destination_index;
+}
+
 // Operadores de comparación
 bool Edge::operator==(const Edge& other) const {
     return source == other.source && destination == other.destination;
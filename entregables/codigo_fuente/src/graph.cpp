@@ -1,41 +1,74 @@
 #include "../include/graph.h"
 #include <iostream>
+#include <limits>
 
 // Constructor
-Graph::Graph() : node_count(0), edge_count(0) {}
+Graph::Graph() : node_count(0), edge_count(0), spatial_index_valid(false) {}
+
+// Destructor
+Graph::~Graph() {
+    clear();
+}
 
 // Función auxiliar para encontrar el índice de un nodo por ID
 int Graph::findNodeIndex(int node_id) const {
-    for (int i = 0; i < nodes.getSize(); i++) {
-        if (nodes[i].getId() == node_id) {
-            return i;
-        }
-    }
-    return -1;
+    return node_index.find(node_id);
 }
 
 // Métodos para agregar nodos y aristas
-void Graph::addNode(const Node& node) {
-    if (!hasNode(node.getId())) {
-        nodes.push_back(node);
-        adjacency_list.push_back(LinkedList<Edge>());
-        node_count++;
+bool Graph::addNode(const Node& node) {
+    if (node.getId() == HashIndex::EMPTY_KEY || hasNode(node.getId())) {
+        return false;
     }
+    node_index.insert(node.getId(), nodes.getSize());
+    nodes.push_back(node);
+    adjacency_list.emplace_back(PoolNodeAllocator(&edge_pool));
+    reverse_adjacency_list.emplace_back(PoolNodeAllocator(&edge_pool));
+    node_count++;
+    spatial_index_valid = false;
+    return true;
 }
 
-void Graph::addEdge(const Edge& edge) {
+bool Graph::addEdge(const Edge& edge) {
     int source_index = findNodeIndex(edge.getSource());
     int dest_index = findNodeIndex(edge.getDestination());
     
-    if (source_index != -1 && dest_index != -1) {
-        adjacency_list[source_index].push_back(edge);
-        edge_count++;
+    if (source_index == -1 || dest_index == -1) {
+        return false;
     }
+    Edge stored = edge;
+    stored.setIndices(source_index, dest_index);
+    adjacency_list[source_index].push_back(stored);
+    reverse_adjacency_list[dest_index].push_back(stored);
+    edge_count++;
+    return true;
 }
 
-void Graph::addEdge(int source, int destination, double weight) {
+bool Graph::addEdge(int source, int destination, double weight) {
     Edge edge(source, destination, weight);
-    addEdge(edge);
+    return addEdge(edge);
+}
+
+// Los extremos ya vienen como índices internos (p. ej. al cargar un archivo)
+bool Graph::addEdgeAt(int source_index, int destination_index, double weight) {
+    if (source_index < 0 || source_index >= node_count ||
+        destination_index < 0 || destination_index >= node_count) {
+        return false;
+    }
+    Edge edge(nodes[source_index].getId(), nodes[destination_index].getId(), weight);
+    edge.setIndices(source_index, destination_index);
+    adjacency_list[source_index].push_back(edge);
+    reverse_adjacency_list[destination_index].push_back(edge);
+    edge_count++;
+    return true;
+}
+
+// Reservar espacio para 'node_capacity' nodos
+void Graph::reserve(int node_capacity) {
+    nodes.reserve(node_capacity);
+    adjacency_list.reserve(node_capacity);
+    reverse_adjacency_list.reserve(node_capacity);
+    node_index.reserve(node_capacity);
 }
 
 // Métodos para obtener información
@@ -47,6 +80,14 @@ int Graph::getEdgeCount() const {
     return edge_count;
 }
 
+int Graph::getNodeIndex(int node_id) const {
+    return findNodeIndex(node_id);
+}
+
+int Graph::getNodeId(int index) const {
+    return index >= 0 && index < node_count ? nodes[index].getId() : -1;
+}
+
 Node* Graph::getNode(int node_id) {
     int index = findNodeIndex(node_id);
     if (index != -1) {
@@ -81,15 +122,62 @@ const Node* Graph::getNodeByName(const std::string& name) const {
     return nullptr;
 }
 
+// Búsqueda de nodos por coordenadas
+void Graph::buildSpatialIndex() const {
+    spatial_index.build(nodes);
+    spatial_index_valid = true;
+}
+
+const KdTree& Graph::getSpatialIndex() const {
+    if (!spatial_index_valid) {
+        buildSpatialIndex();
+    }
+    return spatial_index;
+}
+
+int Graph::findNearestNode(double x, double y) const {
+    int index = getSpatialIndex().nearest(x, y);
+    return index != -1 ? nodes[index].getId() : -1;
+}
+
+int Graph::findNearestNodes(double x, double y, int k, DynamicArray<int>& node_ids) const {
+    DynamicArray<std::pair<double, int>> neighbors;
+    getSpatialIndex().kNearest(x, y, k, std::numeric_limits<double>::infinity(), neighbors);
+    node_ids.clear();
+    for (int i = 0; i < neighbors.getSize(); i++) {
+        node_ids.push_back(nodes[neighbors[i].second].getId());
+    }
+    return node_ids.getSize();
+}
+
+int Graph::findNodesInRadius(double x, double y, double radius, DynamicArray<int>& node_ids) const {
+    DynamicArray<std::pair<double, int>> neighbors;
+    getSpatialIndex().withinRadius(x, y, radius, neighbors);
+    node_ids.clear();
+    for (int i = 0; i < neighbors.getSize(); i++) {
+        node_ids.push_back(nodes[neighbors[i].second].getId());
+    }
+    return node_ids.getSize();
+}
+
 // Métodos para obtener vecinos
-const LinkedList<Edge>& Graph::getAdjacencies(int node_id) const {
+const EdgeList& Graph::getAdjacencies(int node_id) const {
     int index = findNodeIndex(node_id);
     if (index != -1) {
         return adjacency_list[index];
     }
     // Retornar una lista vacía si no se encuentra el nodo
-    static LinkedList<Edge> empty_list;
-    return empty_list;
+    return empty_edges;
+}
+
+// Aristas que llegan al nodo (se guardan tal cual: origen u, destino node_id).
+// Permiten recorrer el grafo en sentido inverso, p. ej. en búsquedas bidireccionales
+const EdgeList& Graph::getIncomingEdges(int node_id) const {
+    int index = findNodeIndex(node_id);
+    if (index != -1) {
+        return reverse_adjacency_list[index];
+    }
+    return empty_edges;
 }
 
 DynamicArray<int> Graph::getNeighbors(int node_id) const {
@@ -97,7 +185,7 @@ DynamicArray<int> Graph::getNeighbors(int node_id) const {
     int index = findNodeIndex(node_id);
     
     if (index != -1) {
-        const LinkedList<Edge>& edges = adjacency_list[index];
+        const EdgeList& edges = adjacency_list[index];
         for (auto it = edges.begin(); it != edges.end(); ++it) {
             neighbors.push_back((*it).getDestination());
         }
@@ -114,7 +202,7 @@ bool Graph::hasNode(int node_id) const {
 bool Graph::hasEdge(int source, int destination) const {
     int source_index = findNodeIndex(source);
     if (source_index != -1) {
-        const LinkedList<Edge>& edges = adjacency_list[source_index];
+        const EdgeList& edges = adjacency_list[source_index];
         for (auto it = edges.begin(); it != edges.end(); ++it) {
             if ((*it).getDestination() == destination) {
                 return true;
@@ -128,7 +216,7 @@ bool Graph::hasEdge(int source, int destination) const {
 double Graph::getEdgeWeight(int source, int destination) const {
     int source_index = findNodeIndex(source);
     if (source_index != -1) {
-        const LinkedList<Edge>& edges = adjacency_list[source_index];
+        const EdgeList& edges = adjacency_list[source_index];
         for (auto it = edges.begin(); it != edges.end(); ++it) {
             if ((*it).getDestination() == destination) {
                 return (*it).getWeight();
@@ -138,14 +226,29 @@ double Graph::getEdgeWeight(int source, int destination) const {
     return -1.0; // Indica que no existe la arista
 }
 
-// Método para limpiar el grafo
+// Método para limpiar el grafo. Las listas se vacían sin liberar sus
+// nodos (Edge no tiene destructor) y luego se devuelven todos los bloques
+// del pool; ninguna lista queda apuntando a memoria liberada
 void Graph::clear() {
+    for (int i = 0; i < adjacency_list.getSize(); i++) {
+        adjacency_list[i].discard();
+        reverse_adjacency_list[i].discard();
+    }
+    edge_pool.release();
     nodes.clear();
     adjacency_list.clear();
+    reverse_adjacency_list.clear();
+    node_index.clear();
+    spatial_index.clear();
+    spatial_index_valid = false;
     node_count = 0;
     edge_count = 0;
 }
 
+size_t Graph::getEdgeMemoryBytes() const {
+    return edge_pool.getReservedBytes();
+}
+
 // Método para obtener todos los nodos
 const DynamicArray<Node>& Graph::getAllNodes() const {
     return nodes;
@@ -159,7 +262,7 @@ void Graph::printGraph() const {
         const Node& node = nodes[i];
         std::cout << "Nodo " << node.getId() << " (" << node.getName() << "): ";
         
-        const LinkedList<Edge>& edges = adjacency_list[i];
+        const EdgeList& edges = adjacency_list[i];
         for (auto it = edges.begin(); it != edges.end(); ++it) {
             std::cout << "-> " << (*it).getDestination() << " (peso: " << (*it).getWeight() << ") ";
         }
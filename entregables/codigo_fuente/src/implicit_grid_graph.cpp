@@ -0,0 +1,97 @@
+#include "../include/implicit_grid_graph.h"
+#include <cmath>
+
+// Constructor
+ImplicitGridGraph::ImplicitGridGraph(int width, int height, double spacing)
+    : width(width > 0 ? width : 0), height(height > 0 ? height : 0), spacing(spacing) {}
+
+// Celdas bloqueadas: el conjunto de bits se crea con la primera
+void ImplicitGridGraph::setBlocked(int index, bool value) {
+    if (getNodeIndex(index) == -1) {
+        return;
+    }
+    if (blocked_bits.getSize() == 0) {
+        if (!value) return;
+        int words = (getNodeCount() + 31) / 32;
+        blocked_bits = DynamicArray<unsigned int>(words);
+        for (int w = 0; w < words; w++) {
+            blocked_bits.push_back(0u);
+        }
+    }
+    if (value) {
+        blocked_bits[index >> 5] |= 1u << (index & 31);
+    } else {
+        blocked_bits[index >> 5] &= ~(1u << (index & 31));
+    }
+}
+
+int ImplicitGridGraph::getBlockedCount() const {
+    int count = 0;
+    for (int w = 0; w < blocked_bits.getSize(); w++) {
+        for (unsigned int bits = blocked_bits[w]; bits != 0u; bits &= bits - 1) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Información general
+int ImplicitGridGraph::getWidth() const {
+    return width;
+}
+
+int ImplicitGridGraph::getHeight() const {
+    return height;
+}
+
+double ImplicitGridGraph::getSpacing() const {
+    return spacing;
+}
+
+int ImplicitGridGraph::getEdgeCount() const {
+    int count = 0;
+    int n = getNodeCount();
+    for (int i = 0; i < n; i++) {
+        for (unsigned int mask = directionMask(i); mask != 0u; mask &= mask - 1) {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool ImplicitGridGraph::hasNode(int node_id) const {
+    return getNodeIndex(node_id) != -1;
+}
+
+double ImplicitGridGraph::getEdgeWeight(int index, int target_index) const {
+    if (getNodeIndex(index) == -1 || getNodeIndex(target_index) == -1) {
+        return -1.0;
+    }
+    for (auto arc : neighbors(index)) {
+        if (arc.target == target_index) {
+            return arc.weight;
+        }
+    }
+    return -1.0;
+}
+
+// Redondear a la celda más cercana y acotar al borde de la cuadrícula
+int ImplicitGridGraph::findNearestNode(double x, double y) const {
+    if (getNodeCount() == 0) {
+        return -1;
+    }
+    // Acotar antes de convertir: una coordenada muy lejos de la cuadrícula
+    // no cabe en un int (NaN queda en la celda 0)
+    double cell_x = std::floor(x / spacing + 0.5);
+    double cell_y = std::floor(y / spacing + 0.5);
+    if (!(cell_x > 0.0)) cell_x = 0.0;
+    if (cell_x > width - 1) cell_x = width - 1;
+    if (!(cell_y > 0.0)) cell_y = 0.0;
+    if (cell_y > height - 1) cell_y = height - 1;
+    return static_cast<int>(cell_y) * width + static_cast<int>(cell_x);
+}
+
+// Memoria ocupada (bytes)
+size_t ImplicitGridGraph::getMemoryUsage() const {
+    return sizeof(ImplicitGridGraph) + static_cast<size_t>(blocked_bits.getCapacity()) * sizeof(unsigned int);
+}
@@ -0,0 +1,277 @@
+#include "../include/jump_point_search.h"
+#include <cmath>
+#include <cstdlib>
+
+// Constructores
+JumpPointSearch::JumpPointSearch() : width(0), height(0), cell_cost(1.0) {}
+
+JumpPointSearch::JumpPointSearch(int width, int height, double cell_cost)
+    : width(width > 0 ? width : 0), height(height > 0 ? height : 0), cell_cost(cell_cost),
+      blocked(width > 0 && height > 0 ? width * height : 1) {
+    for (int i = 0; i < getCellCount(); i++) {
+        blocked.push_back(0);
+    }
+}
+
+// Detectar si el grafo es una cuadrícula 4-conectada de costo uniforme
+bool JumpPointSearch::detectFrom(const Graph& graph) {
+    int n = graph.getNodeCount();
+    if (n < 2 || !graph.hasNode(0) || !graph.hasNode(1)) {
+        return false;
+    }
+
+    // Espaciado y ancho a partir de la primera fila
+    const Node* origin = graph.getNode(0);
+    double spacing = graph.getNode(1)->getX() - origin->getX();
+    if (!(spacing > 0.0)) {
+        return false;
+    }
+    int grid_width = 1;
+    while (grid_width < n && graph.hasNode(grid_width) &&
+           graph.getNode(grid_width)->getY() == origin->getY()) {
+        grid_width++;
+    }
+    if (n % grid_width != 0) {
+        return false;
+    }
+    int grid_height = n / grid_width;
+
+    // Posiciones en la retícula y celdas sin aristas (bloqueadas)
+    double tolerance = 1e-9 * spacing * (grid_width + grid_height);
+    DynamicArray<char> grid_blocked(n);
+    for (int id = 0; id < n; id++) {
+        const Node* node = graph.getNode(id);
+        if (!node ||
+            std::abs(node->getX() - (origin->getX() + (id % grid_width) * spacing)) > tolerance ||
+            std::abs(node->getY() - (origin->getY() + (id / grid_width) * spacing)) > tolerance) {
+            return false;
+        }
+        grid_blocked.push_back(graph.getAdjacencies(id).isEmpty() ? 1 : 0);
+    }
+
+    // Cada celda libre debe tener exactamente una arista de peso uniforme
+    // hacia cada vecina libre dentro de la cuadrícula
+    double weight = -1.0;
+    for (int id = 0; id < n; id++) {
+        if (grid_blocked[id]) continue;
+        int x = id % grid_width;
+        int y = id / grid_width;
+        int free_neighbors = 0;
+        const int dx[4] = {1, -1, 0, 0};
+        const int dy[4] = {0, 0, 1, -1};
+        for (int d = 0; d < 4; d++) {
+            int nx = x + dx[d];
+            int ny = y + dy[d];
+            if (nx >= 0 && nx < grid_width && ny >= 0 && ny < grid_height && !grid_blocked[ny * grid_width + nx]) {
+                free_neighbors++;
+            }
+        }
+        int edges = 0;
+        const EdgeList& adjacencies = graph.getAdjacencies(id);
+        for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
+            int destination = (*it).getDestination();
+            int ex = destination % grid_width;
+            int ey = destination / grid_width;
+            if (destination < 0 || destination >= n || grid_blocked[destination] ||
+                std::abs(ex - x) + std::abs(ey - y) != 1) {
+                return false;
+            }
+            if (weight < 0.0) {
+                weight = (*it).getWeight();
+            } else if ((*it).getWeight() != weight) {
+                return false;
+            }
+            edges++;
+        }
+        if (edges != free_neighbors) {
+            return false;
+        }
+    }
+
+    width = grid_width;
+    height = grid_height;
+    cell_cost = weight > 0.0 ? weight : spacing;
+    blocked = grid_blocked;
+    return true;
+}
+
+// Celdas bloqueadas
+void JumpPointSearch::setBlocked(int cell, bool value) {
+    if (cell >= 0 && cell < getCellCount()) {
+        blocked[cell] = value ? 1 : 0;
+    }
+}
+
+bool JumpPointSearch::isBlocked(int cell) const {
+    return cell < 0 || cell >= getCellCount() || blocked[cell] != 0;
+}
+
+bool JumpPointSearch::isFree(int x, int y) const {
+    return x >= 0 && x < width && y >= 0 && y < height && !blocked[y * width + x];
+}
+
+// Avanzar desde (x, y) en la dirección (dx, dy) hasta el próximo punto de
+// salto. Retorna su celda o -1 si se llega a un obstáculo o al borde
+int JumpPointSearch::jump(int x, int y, int dx, int dy, int goal_x, int goal_y) const {
+    while (isFree(x, y)) {
+        if (x == goal_x && y == goal_y) {
+            return y * width + x;
+        }
+        if (dx != 0) {
+            // Vecino forzado: la celda de arriba/abajo está libre pero la
+            // anterior a ella no, así que el camino canónico debe girar aquí
+            if ((isFree(x, y - 1) && !isFree(x - dx, y - 1)) ||
+                (isFree(x, y + 1) && !isFree(x - dx, y + 1))) {
+                return y * width + x;
+            }
+        } else {
+            if ((isFree(x - 1, y) && !isFree(x - 1, y - dy)) ||
+                (isFree(x + 1, y) && !isFree(x + 1, y - dy))) {
+                return y * width + x;
+            }
+            // En un salto vertical, cada fila desde la que un salto
+            // horizontal encuentra un punto de salto es a su vez un punto
+            if (jump(x + 1, y, 1, 0, goal_x, goal_y) != -1 || jump(x - 1, y, -1, 0, goal_x, goal_y) != -1) {
+                return y * width + x;
+            }
+        }
+        x += dx;
+        y += dy;
+    }
+    return -1;
+}
+
+// Distancia Manhattan en celdas por el costo de cada paso
+double JumpPointSearch::heuristic(int cell, int goal) const {
+    return (std::abs(cell % width - goal % width) + std::abs(cell / width - goal / width)) * cell_cost;
+}
+
+SearchResult JumpPointSearch::findPath(int start, int goal) {
+    return findPath(start, goal, workspace);
+}
+
+SearchResult JumpPointSearch::findPath(int start, int goal, SearchWorkspace& ws) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    SearchResult result;
+
+    if (isBlocked(start) || isBlocked(goal)) {
+        return result;
+    }
+
+    ws.prepare(getCellCount());
+    SearchHeap& pq = ws.getHeap();
+    int goal_x = goal % width;
+    int goal_y = goal / width;
+
+    ws.setDistance(start, 0.0);
+    pq.push(start, heuristic(start, goal));
+    int nodes_explored = 0;
+
+    while (!pq.isEmpty()) {
+        int u = pq.top();
+        pq.pop();
+        ws.setVisited(u);
+        nodes_explored++;
+
+        if (u == goal) {
+            result.path = expandPath(ws, start, goal);
+            result.path_found = true;
+            result.total_distance = ws.getDistance(goal);
+            break;
+        }
+
+        // Direcciones a explorar según cómo se llegó a u: desde el origen
+        // las cuatro; tras un tramo horizontal, seguir y girar a los dos
+        // lados; tras uno vertical, seguir y los giros (forzados o hacia
+        // puntos de salto horizontales)
+        int x = u % width;
+        int y = u / width;
+        int parent = ws.getParent(u);
+        int directions[4][2];
+        int direction_count = 0;
+        if (parent == -1) {
+            const int all[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+            for (int d = 0; d < 4; d++) {
+                directions[direction_count][0] = all[d][0];
+                directions[direction_count][1] = all[d][1];
+                direction_count++;
+            }
+        } else {
+            int px = parent % width;
+            int py = parent / width;
+            int dx = (x > px) - (x < px);
+            int dy = (y > py) - (y < py);
+            if (dx != 0) {
+                directions[0][0] = dx; directions[0][1] = 0;
+                directions[1][0] = 0;  directions[1][1] = 1;
+                directions[2][0] = 0;  directions[2][1] = -1;
+            } else {
+                directions[0][0] = 0;  directions[0][1] = dy;
+                directions[1][0] = 1;  directions[1][1] = 0;
+                directions[2][0] = -1; directions[2][1] = 0;
+            }
+            direction_count = 3;
+        }
+
+        for (int d = 0; d < direction_count; d++) {
+            int dx = directions[d][0];
+            int dy = directions[d][1];
+            int jump_point = jump(x + dx, y + dy, dx, dy, goal_x, goal_y);
+            if (jump_point == -1 || ws.isVisited(jump_point)) {
+                continue;
+            }
+            int steps = std::abs(jump_point % width - x) + std::abs(jump_point / width - y);
+            double new_distance = ws.getDistance(u) + steps * cell_cost;
+            if (new_distance < ws.getDistance(jump_point)) {
+                ws.setDistance(jump_point, new_distance);
+                ws.setParent(jump_point, u);
+                pq.pushOrDecrease(jump_point, new_distance + heuristic(jump_point, goal));
+            }
+        }
+    }
+
+    result.nodes_explored = nodes_explored;
+    auto end_time = std::chrono::high_resolution_clock::now();
+    result.time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    return result;
+}
+
+// Camino completo: los padres son puntos de salto unidos por tramos rectos
+DynamicArray<int> JumpPointSearch::expandPath(const SearchWorkspace& ws, int start, int goal) const {
+    DynamicArray<int> reversed;
+    int current = goal;
+    reversed.push_back(current);
+    while (current != start) {
+        int parent = ws.getParent(current);
+        int step = std::abs(parent - current) < width ? (parent > current ? 1 : -1)
+                                                      : (parent > current ? width : -width);
+        for (int cell = current + step; cell != parent; cell += step) {
+            reversed.push_back(cell);
+        }
+        reversed.push_back(parent);
+        current = parent;
+    }
+
+    DynamicArray<int> path(reversed.getSize());
+    for (int i = reversed.getSize() - 1; i >= 0; i--) {
+        path.push_back(reversed[i]);
+    }
+    return path;
+}
+
+// Información
+int JumpPointSearch::getWidth() const {
+    return width;
+}
+
+int JumpPointSearch::getHeight() const {
+    return height;
+}
+
+int JumpPointSearch::getCellCount() const {
+    return width * height;
+}
+
+double JumpPointSearch::getCellCost() const {
+    return cell_cost;
+}
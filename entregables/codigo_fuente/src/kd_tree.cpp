@@ -0,0 +1,231 @@
+#include "../include/kd_tree.h"
+#include <cmath>
+#include <limits>
+
+// Constructor
+KdTree::KdTree() {}
+
+// Construir sobre las posiciones de 'nodes'
+void KdTree::build(const DynamicArray<Node>& nodes) {
+    int n = nodes.getSize();
+    DynamicArray<double> x_coords(n > 0 ? n : 1);
+    DynamicArray<double> y_coords(n > 0 ? n : 1);
+    for (int i = 0; i < n; i++) {
+        x_coords.push_back(nodes[i].getX());
+        y_coords.push_back(nodes[i].getY());
+    }
+    build(x_coords, y_coords);
+}
+
+// Construir sobre dos arrays de coordenadas
+void KdTree::build(const DynamicArray<double>& x_coords, const DynamicArray<double>& y_coords) {
+    int n = x_coords.getSize();
+    items = DynamicArray<int>(n > 0 ? n : 1);
+    split_axis = DynamicArray<char>(n > 0 ? n : 1);
+    xs = x_coords;
+    ys = y_coords;
+    for (int i = 0; i < n; i++) {
+        items.push_back(i);
+        split_axis.push_back(0);
+    }
+    buildRange(0, n);
+}
+
+// Dividir [begin, end) por la mediana del eje de mayor extensión
+void KdTree::buildRange(int begin, int end) {
+    if (end - begin <= LEAF_SIZE) {
+        return;
+    }
+
+    double min_x = xs[begin], max_x = xs[begin];
+    double min_y = ys[begin], max_y = ys[begin];
+    for (int p = begin + 1; p < end; p++) {
+        if (xs[p] < min_x) min_x = xs[p];
+        if (xs[p] > max_x) max_x = xs[p];
+        if (ys[p] < min_y) min_y = ys[p];
+        if (ys[p] > max_y) max_y = ys[p];
+    }
+    int axis = (max_y - min_y) > (max_x - min_x) ? 1 : 0;
+
+    int mid = begin + (end - begin) / 2;
+    selectMedian(begin, end, mid, axis);
+    split_axis[mid] = static_cast<char>(axis);
+
+    buildRange(begin, mid);
+    buildRange(mid + 1, end);
+}
+
+// Selección (quickselect con partición en tres partes, robusta a
+// coordenadas repetidas): deja en 'mid' el punto que iría ahí si el rango
+// estuviera ordenado por 'axis', con los menores o iguales antes y los
+// mayores o iguales después
+void KdTree::selectMedian(int begin, int end, int mid, int axis) {
+    const DynamicArray<double>& key = axis == 0 ? xs : ys;
+    while (end - begin > 1) {
+        double pivot = key[begin + (end - begin) / 2];
+        int less = begin, i = begin, greater = end;
+        while (i < greater) {
+            if (key[i] < pivot) {
+                swapPoints(less++, i++);
+            } else if (key[i] > pivot) {
+                swapPoints(i, --greater);
+            } else {
+                i++;
+            }
+        }
+        if (mid < less) {
+            end = less;
+        } else if (mid >= greater) {
+            begin = greater;
+        } else {
+            return;
+        }
+    }
+}
+
+void KdTree::swapPoints(int a, int b) {
+    int item = items[a];
+    items[a] = items[b];
+    items[b] = item;
+    double x = xs[a];
+    xs[a] = xs[b];
+    xs[b] = x;
+    double y = ys[a];
+    ys[a] = ys[b];
+    ys[b] = y;
+}
+
+// Recorrido de [begin, end) para los k mejores. 'best' guarda distancias al
+// cuadrado en orden creciente y 'limit' es la del k-ésimo (o la máxima)
+void KdTree::searchNearest(int begin, int end, double x, double y, int k, double& limit,
+                           DynamicArray<std::pair<double, int>>& best) const {
+    int mid = begin + (end - begin) / 2;
+    bool leaf = end - begin <= LEAF_SIZE;
+    int scan_begin = leaf ? begin : mid;
+    int scan_end = leaf ? end : mid + 1;
+
+    for (int p = scan_begin; p < scan_end; p++) {
+        double dx = xs[p] - x;
+        double dy = ys[p] - y;
+        double squared = dx * dx + dy * dy;
+        if (squared > limit) continue;
+
+        // Inserción ordenada en la lista de los k mejores
+        std::pair<double, int> candidate(squared, items[p]);
+        if (best.getSize() == k) {
+            if (!(candidate < best[k - 1])) continue;
+            best[k - 1] = candidate;
+        } else {
+            best.push_back(candidate);
+        }
+        for (int j = best.getSize() - 1; j > 0 && best[j] < best[j - 1]; j--) {
+            std::pair<double, int> temp = best[j];
+            best[j] = best[j - 1];
+            best[j - 1] = temp;
+        }
+        if (best.getSize() == k) {
+            limit = best[k - 1].first;
+        }
+    }
+    if (leaf) {
+        return;
+    }
+
+    // Primero el lado del plano de corte que contiene al punto; el otro solo
+    // si el plano está dentro del límite (con igualdad, por los empates)
+    double diff = split_axis[mid] == 0 ? x - xs[mid] : y - ys[mid];
+    if (diff < 0.0) {
+        searchNearest(begin, mid, x, y, k, limit, best);
+        if (diff * diff <= limit) searchNearest(mid + 1, end, x, y, k, limit, best);
+    } else {
+        searchNearest(mid + 1, end, x, y, k, limit, best);
+        if (diff * diff <= limit) searchNearest(begin, mid, x, y, k, limit, best);
+    }
+}
+
+// Recorrido de [begin, end) acumulando los puntos dentro del radio
+void KdTree::searchRadius(int begin, int end, double x, double y, double squared_radius,
+                          DynamicArray<std::pair<double, int>>& found) const {
+    int mid = begin + (end - begin) / 2;
+    bool leaf = end - begin <= LEAF_SIZE;
+    int scan_begin = leaf ? begin : mid;
+    int scan_end = leaf ? end : mid + 1;
+
+    for (int p = scan_begin; p < scan_end; p++) {
+        double dx = xs[p] - x;
+        double dy = ys[p] - y;
+        double squared = dx * dx + dy * dy;
+        if (squared <= squared_radius) {
+            found.push_back(std::make_pair(squared, items[p]));
+        }
+    }
+    if (leaf) {
+        return;
+    }
+
+    double diff = split_axis[mid] == 0 ? x - xs[mid] : y - ys[mid];
+    if (diff <= 0.0 || diff * diff <= squared_radius) {
+        searchRadius(begin, mid, x, y, squared_radius, found);
+    }
+    if (diff >= 0.0 || diff * diff <= squared_radius) {
+        searchRadius(mid + 1, end, x, y, squared_radius, found);
+    }
+}
+
+// Índice del punto más cercano a (x, y)
+int KdTree::nearest(double x, double y) const {
+    if (items.getSize() == 0) {
+        return -1;
+    }
+    DynamicArray<std::pair<double, int>> best(1);
+    double limit = std::numeric_limits<double>::infinity();
+    searchNearest(0, items.getSize(), x, y, 1, limit, best);
+    return best[0].second;
+}
+
+// Los k puntos más cercanos a (x, y) a distancia <= max_distance
+int KdTree::kNearest(double x, double y, int k, double max_distance,
+                     DynamicArray<std::pair<double, int>>& neighbors) const {
+    neighbors.clear();
+    if (k <= 0 || items.getSize() == 0 || max_distance < 0.0) {
+        return 0;
+    }
+
+    double limit = max_distance * max_distance;
+    searchNearest(0, items.getSize(), x, y, k, limit, neighbors);
+    for (int j = 0; j < neighbors.getSize(); j++) {
+        neighbors[j].first = std::sqrt(neighbors[j].first);
+    }
+    return neighbors.getSize();
+}
+
+// Todos los puntos a distancia <= radius de (x, y)
+int KdTree::withinRadius(double x, double y, double radius,
+                         DynamicArray<std::pair<double, int>>& neighbors) const {
+    neighbors.clear();
+    if (items.getSize() == 0 || radius < 0.0) {
+        return 0;
+    }
+
+    searchRadius(0, items.getSize(), x, y, radius * radius, neighbors);
+    for (int j = 0; j < neighbors.getSize(); j++) {
+        neighbors[j].first = std::sqrt(neighbors[j].first);
+    }
+    return neighbors.getSize();
+}
+
+// Información
+int KdTree::getSize() const {
+    return items.getSize();
+}
+
+bool KdTree::isEmpty() const {
+    return items.getSize() == 0;
+}
+
+void KdTree::clear() {
+    items.clear();
+    xs.clear();
+    ys.clear();
+    split_axis.clear();
+}
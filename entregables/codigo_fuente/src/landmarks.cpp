@@ -0,0 +1,396 @@
+#include "../include/landmarks.h"
+#include "../include/indexed_priority_queue.h"
+#include <iostream>
+#include <fstream>
+#include <chrono>
+
+// Adyacencia CSR (directa o inversa) usada solo durante el preprocesamiento
+struct LandmarkAdjacency {
+    DynamicArray<int> offsets;
+    DynamicArray<int> targets;
+    DynamicArray<double> weights;
+};
+
+static void buildAdjacency(const CompactGraph& graph, bool reverse, LandmarkAdjacency& adjacency) {
+    int n = graph.getNodeCount();
+    int m = graph.getEdgeCount();
+    adjacency.offsets = DynamicArray<int>(n + 1);
+    adjacency.targets = DynamicArray<int>(m > 0 ? m : 1);
+    adjacency.weights = DynamicArray<double>(m > 0 ? m : 1);
+
+    if (!reverse) {
+        adjacency.offsets.push_back(0);
+        for (int u = 0; u < n; u++) {
+            for (int e = graph.edgesBegin(u); e < graph.edgesEnd(u); e++) {
+                adjacency.targets.push_back(graph.getTarget(e));
+                adjacency.weights.push_back(graph.getWeight(e));
+            }
+            adjacency.offsets.push_back(adjacency.targets.getSize());
+        }
+        return;
+    }
+
+    // Inversa: contar aristas entrantes, acumular y repartir (counting sort)
+    for (int i = 0; i <= n; i++) {
+        adjacency.offsets.push_back(0);
+    }
+    for (int e = 0; e < m; e++) {
+        adjacency.offsets[graph.getTarget(e) + 1]++;
+    }
+    for (int i = 0; i < n; i++) {
+        adjacency.offsets[i + 1] += adjacency.offsets[i];
+    }
+    for (int e = 0; e < m; e++) {
+        adjacency.targets.push_back(0);
+        adjacency.weights.push_back(0.0);
+    }
+
+    DynamicArray<int> next(n > 0 ? n : 1);
+    for (int i = 0; i < n; i++) {
+        next.push_back(adjacency.offsets[i]);
+    }
+    for (int u = 0; u < n; u++) {
+        for (int e = graph.edgesBegin(u); e < graph.edgesEnd(u); e++) {
+            int slot = next[graph.getTarget(e)]++;
+            adjacency.targets[slot] = u;
+            adjacency.weights[slot] = graph.getWeight(e);
+        }
+    }
+}
+
+// Dijkstra uno-a-todos. 'distance' debe tener n entradas; si se pasan
+// 'parent' y 'order' se llenan con el árbol de caminos mínimos y el orden
+// en que se asentaron los nodos
+static void shortestDistances(const LandmarkAdjacency& adjacency, int n, int source,
+                              DynamicArray<double>& distance, DynamicArray<int>* parent,
+                              DynamicArray<int>* order) {
+    const double INF = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < n; i++) {
+        distance[i] = INF;
+        if (parent) (*parent)[i] = -1;
+    }
+    if (order) order->clear();
+
+    IndexedPriorityQueue<double, 4> heap(n);
+    distance[source] = 0.0;
+    heap.push(source, 0.0);
+
+    while (!heap.isEmpty()) {
+        int u = heap.top();
+        heap.pop();
+        if (order) order->push_back(u);
+
+        for (int e = adjacency.offsets[u]; e < adjacency.offsets[u + 1]; e++) {
+            int v = adjacency.targets[e];
+            double new_distance = distance[u] + adjacency.weights[e];
+            if (new_distance < distance[v]) {
+                distance[v] = new_distance;
+                if (parent) (*parent)[v] = u;
+                heap.pushOrDecrease(v, new_distance);
+            }
+        }
+    }
+}
+
+// Constructor
+Landmarks::Landmarks() : node_count(0), landmark_count(0), preprocessing_ms(0.0) {}
+
+void Landmarks::build(const Graph& graph, int count, LandmarkSelection selection) {
+    CompactGraph compact(graph);
+    build(compact, count, selection);
+}
+
+void Landmarks::build(const CompactGraph& graph, int count, LandmarkSelection selection) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    const double INF = std::numeric_limits<double>::infinity();
+
+    int n = graph.getNodeCount();
+    if (count > n) count = n;
+    if (count < 0) count = 0;
+
+    node_count = n;
+    landmark_count = count;
+    landmark_nodes = DynamicArray<int>(count > 0 ? count : 1);
+
+    // Las columnas de landmarks aún no calculados quedan en infinito, por lo
+    // que lowerBound las ignora mientras se eligen los siguientes
+    int cells = n * count;
+    from_landmark = DynamicArray<double>(cells > 0 ? cells : 1);
+    to_landmark = DynamicArray<double>(cells > 0 ? cells : 1);
+    for (int i = 0; i < cells; i++) {
+        from_landmark.push_back(INF);
+        to_landmark.push_back(INF);
+    }
+
+    if (count == 0) {
+        preprocessing_ms = 0.0;
+        return;
+    }
+
+    LandmarkAdjacency forward, backward;
+    buildAdjacency(graph, false, forward);
+    buildAdjacency(graph, true, backward);
+
+    DynamicArray<double> distance(n);
+    DynamicArray<int> parent(n);
+    DynamicArray<double> coverage(n);   // FARTHEST: distancia mínima a los landmarks elegidos
+    DynamicArray<double> subtree(n);    // AVOID: tamaño de cada subárbol
+    DynamicArray<bool> is_landmark(n);
+    DynamicArray<bool> covered(n);      // AVOID: el subárbol contiene un landmark
+    for (int i = 0; i < n; i++) {
+        distance.push_back(INF);
+        parent.push_back(-1);
+        coverage.push_back(INF);
+        subtree.push_back(0.0);
+        is_landmark.push_back(false);
+        covered.push_back(false);
+    }
+    DynamicArray<int> order(n);
+    DynamicArray<int> child_offsets(n + 1);
+    DynamicArray<int> children(n);
+
+    unsigned int seed = 20240611u;
+
+    for (int l = 0; l < count; l++) {
+        int chosen = -1;
+
+        if (selection == LANDMARKS_FARTHEST) {
+            if (l == 0) {
+                // El primero es el nodo más lejano a un nodo arbitrario
+                shortestDistances(forward, n, 0, distance, nullptr, nullptr);
+                double farthest = -1.0;
+                for (int v = 0; v < n; v++) {
+                    if (distance[v] < INF && distance[v] > farthest) {
+                        farthest = distance[v];
+                        chosen = v;
+                    }
+                }
+            } else {
+                // Priorizar nodos que ningún landmark alcanza (otra componente);
+                // si no hay, el que maximiza la distancia al landmark más cercano
+                double farthest = -1.0;
+                for (int v = 0; v < n && farthest < INF; v++) {
+                    if (!is_landmark[v] && coverage[v] > farthest) {
+                        farthest = coverage[v];
+                        chosen = v;
+                    }
+                }
+            }
+        } else {
+            // AVOID (Goldberg y Werneck): árbol de caminos mínimos desde una
+            // raíz aleatoria, peso de cada nodo = d(r, v) - cota(r, v), tamaño
+            // del subárbol = suma de pesos (0 si contiene un landmark).
+            // Se desciende por el hijo de mayor tamaño hasta una hoja.
+            seed = seed * 1103515245u + 12345u;
+            int root = static_cast<int>((seed >> 8) % static_cast<unsigned int>(n));
+            shortestDistances(forward, n, root, distance, &parent, &order);
+
+            for (int i = 0; i < order.getSize(); i++) {
+                int v = order[i];
+                subtree[v] = 0.0;
+                covered[v] = is_landmark[v];
+            }
+            for (int i = order.getSize() - 1; i >= 0; i--) {
+                int v = order[i];
+                if (covered[v]) {
+                    subtree[v] = 0.0;
+                } else {
+                    subtree[v] += distance[v] - lowerBound(root, v);
+                }
+                int p = parent[v];
+                if (p != -1) {
+                    if (covered[v]) {
+                        covered[p] = true;
+                    } else {
+                        subtree[p] += subtree[v];
+                    }
+                }
+            }
+
+            // Hijos de cada nodo del árbol en formato CSR
+            child_offsets.clear();
+            for (int i = 0; i <= n; i++) {
+                child_offsets.push_back(0);
+            }
+            for (int i = 0; i < order.getSize(); i++) {
+                if (parent[order[i]] != -1) {
+                    child_offsets[parent[order[i]] + 1]++;
+                }
+            }
+            for (int i = 0; i < n; i++) {
+                child_offsets[i + 1] += child_offsets[i];
+            }
+            children.clear();
+            for (int i = 0; i < order.getSize(); i++) {
+                children.push_back(0);
+            }
+            for (int i = 0; i < order.getSize(); i++) {
+                int v = order[i];
+                if (parent[v] != -1) {
+                    children[child_offsets[parent[v]]++] = v;
+                }
+            }
+            // Tras el reparto child_offsets[v] apunta al final de los hijos de v
+
+            if (!covered[root] && subtree[root] > 0.0) {
+                int current = root;
+                while (true) {
+                    int begin = current == 0 ? 0 : child_offsets[current - 1];
+                    int best = -1;
+                    for (int c = begin; c < child_offsets[current]; c++) {
+                        int child = children[c];
+                        if (subtree[child] > 0.0 && (best == -1 || subtree[child] > subtree[best])) {
+                            best = child;
+                        }
+                    }
+                    if (best == -1) break;
+                    current = best;
+                }
+                chosen = current;
+            }
+        }
+
+        // Respaldo: cualquier nodo que aún no sea landmark
+        if (chosen == -1 || is_landmark[chosen]) {
+            chosen = -1;
+            for (int v = 0; v < n && chosen == -1; v++) {
+                if (!is_landmark[v]) chosen = v;
+            }
+        }
+
+        is_landmark[chosen] = true;
+        landmark_nodes.push_back(chosen);
+
+        // d(L, v) sobre las aristas directas y d(v, L) sobre las inversas
+        shortestDistances(forward, n, chosen, distance, nullptr, nullptr);
+        for (int v = 0; v < n; v++) {
+            from_landmark[v * count + l] = distance[v];
+            if (distance[v] < coverage[v]) coverage[v] = distance[v];
+        }
+        shortestDistances(backward, n, chosen, distance, nullptr, nullptr);
+        for (int v = 0; v < n; v++) {
+            to_landmark[v * count + l] = distance[v];
+        }
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    preprocessing_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
+
+// Guardar landmarks en archivo binario
+bool Landmarks::saveToBinary(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: No se pudo crear el archivo " << filename << std::endl;
+        return false;
+    }
+
+    const char magic[4] = {'A', 'L', 'T', '1'};
+    file.write(magic, 4);
+    file.write(reinterpret_cast<const char*>(&node_count), sizeof(int));
+    file.write(reinterpret_cast<const char*>(&landmark_count), sizeof(int));
+
+    size_t cells = static_cast<size_t>(node_count) * landmark_count;
+    if (landmark_count > 0) {
+        file.write(reinterpret_cast<const char*>(&landmark_nodes[0]), landmark_count * sizeof(int));
+        file.write(reinterpret_cast<const char*>(&from_landmark[0]), cells * sizeof(double));
+        file.write(reinterpret_cast<const char*>(&to_landmark[0]), cells * sizeof(double));
+    }
+
+    file.close();
+    return true;
+}
+
+// Cargar landmarks; falla si el archivo corresponde a otro grafo
+bool Landmarks::loadFromBinary(const std::string& filename, int expected_node_count) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo " << filename << std::endl;
+        return false;
+    }
+
+    char magic[4];
+    int file_nodes = 0, file_landmarks = 0;
+    file.read(magic, 4);
+    file.read(reinterpret_cast<char*>(&file_nodes), sizeof(int));
+    file.read(reinterpret_cast<char*>(&file_landmarks), sizeof(int));
+
+    if (!file || magic[0] != 'A' || magic[1] != 'L' || magic[2] != 'T' || magic[3] != '1') {
+        std::cerr << "Error: " << filename << " no es un archivo de landmarks" << std::endl;
+        return false;
+    }
+    if (file_nodes != expected_node_count || file_landmarks < 0 || file_landmarks > file_nodes) {
+        std::cerr << "Error: los landmarks de " << filename << " no corresponden al grafo ("
+                  << file_nodes << " nodos, se esperaban " << expected_node_count << ")" << std::endl;
+        return false;
+    }
+
+    int cells = file_nodes * file_landmarks;
+    DynamicArray<int> nodes(file_landmarks > 0 ? file_landmarks : 1);
+    DynamicArray<double> from(cells > 0 ? cells : 1);
+    DynamicArray<double> to(cells > 0 ? cells : 1);
+    for (int i = 0; i < file_landmarks; i++) {
+        nodes.push_back(0);
+    }
+    for (int i = 0; i < cells; i++) {
+        from.push_back(0.0);
+        to.push_back(0.0);
+    }
+
+    if (file_landmarks > 0) {
+        file.read(reinterpret_cast<char*>(&nodes[0]), file_landmarks * sizeof(int));
+        file.read(reinterpret_cast<char*>(&from[0]), static_cast<size_t>(cells) * sizeof(double));
+        file.read(reinterpret_cast<char*>(&to[0]), static_cast<size_t>(cells) * sizeof(double));
+    }
+    if (!file) {
+        std::cerr << "Error: archivo de landmarks truncado: " << filename << std::endl;
+        return false;
+    }
+
+    node_count = file_nodes;
+    landmark_count = file_landmarks;
+    landmark_nodes = nodes;
+    from_landmark = from;
+    to_landmark = to;
+    preprocessing_ms = 0.0;
+    return true;
+}
+
+// Archivo de landmarks asociado a un grafo guardado con saveGraphToBinary
+std::string Landmarks::landmarkFileFor(const std::string& graph_filename) {
+    return graph_filename + ".alt";
+}
+
+// Información
+bool Landmarks::isEmpty() const {
+    return landmark_count == 0;
+}
+
+int Landmarks::getNodeCount() const {
+    return node_count;
+}
+
+int Landmarks::getLandmarkCount() const {
+    return landmark_count;
+}
+
+int Landmarks::getLandmarkNode(int i) const {
+    return landmark_nodes[i];
+}
+
+double Landmarks::getDistanceFromLandmark(int landmark, int index) const {
+    return from_landmark[index * landmark_count + landmark];
+}
+
+double Landmarks::getDistanceToLandmark(int landmark, int index) const {
+    return to_landmark[index * landmark_count + landmark];
+}
+
+double Landmarks::getPreprocessingTime() const {
+    return preprocessing_ms;
+}
+
+size_t Landmarks::getMemoryUsage() const {
+    size_t cells = static_cast<size_t>(node_count) * landmark_count;
+    return 2 * cells * sizeof(double) + static_cast<size_t>(landmark_count) * sizeof(int);
+}
@@ -6,7 +6,8 @@
 #include <ctime>
 
 // Generar grafo grande con patrón de cuadrícula
-void LargeGraphGenerator::generateGridGraph(Graph& graph, int width, int height, double spacing) {
+void LargeGraphGenerator::generateGridGraph(Graph& graph, int width, int height, double spacing,
+                                            const DynamicArray<char>* blocked) {
     graph.clear();
     std::cout << "Generando grafo de cuadrícula " << width << "x" << height << "..." << std::endl;
     
@@ -26,17 +27,20 @@ void LargeGraphGenerator::generateGridGraph(Graph& graph, int width, int height,
     for (int y = 0; y < height; y++) {
         for (int x = 0; x < width; x++) {
             int current_id = getGridIndex(x, y, width);
+            if (blocked && (*blocked)[current_id]) {
+                continue;
+            }
             
             // Conectar con vecino derecho
-            if (x < width - 1) {
-                int right_id = getGridIndex(x + 1, y, width);
+            int right_id = getGridIndex(x + 1, y, width);
+            if (x < width - 1 && !(blocked && (*blocked)[right_id])) {
                 graph.addEdge(current_id, right_id, spacing);
                 graph.addEdge(right_id, current_id, spacing);
             }
             
             // Conectar con vecino inferior
-            if (y < height - 1) {
-                int down_id = getGridIndex(x, y + 1, width);
+            int down_id = getGridIndex(x, y + 1, width);
+            if (y < height - 1 && !(blocked && (*blocked)[down_id])) {
                 graph.addEdge(current_id, down_id, spacing);
                 graph.addEdge(down_id, current_id, spacing);
             }
@@ -122,11 +126,14 @@ void LargeGraphGenerator::generateCityLikeGraph(Graph& graph, int num_nodes, int
         graph.addNode(Node(i, name, x, y));
     }
     
-    // Conectar nodos cercanos
+    // Conectar nodos cercanos usando un índice espacial (solo se examinan
+    // las celdas vecinas, no todos los nodos)
     const DynamicArray<Node>& nodes = graph.getAllNodes();
+    SpatialGrid spatial_grid;
+    spatial_grid.build(nodes);
     
     for (int i = 0; i < nodes.getSize(); i++) {
-        connectNearbyNodes(graph, i, nodes, 30.0, 5); // Conectar con nodos dentro de 30 unidades, máximo 5 conexiones
+        connectNearbyNodes(graph, i, nodes, spatial_grid, 30.0, 5); // Los 5 más cercanos dentro de 30 unidades
         
         // Mostrar progreso
         if (i % 10000 == 0 && i > 0) {
@@ -157,7 +164,16 @@ void LargeGraphGenerator::addObstacles(Graph& graph, double obstacle_percentage)
 }
 
 // Guardar grafo en archivo binario
-bool LargeGraphGenerator::saveGraphToBinary(const Graph& graph, const std::string& filename) {
+// Sección opcional al final del archivo binario: marca, cantidad de nodos y
+// la posición original de cada nodo
+static const int ORIGINAL_ORDER_TAG = 0x4D524550; // "PERM"
+
+bool LargeGraphGenerator::saveGraphToBinary(const Graph& graph, const std::string& filename,
+                                            const DynamicArray<int>* original_order) {
+    if (original_order && original_order->getSize() != graph.getNodeCount()) {
+        std::cerr << "Error: La permutación no corresponde al grafo" << std::endl;
+        return false;
+    }
     std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         std::cerr << "Error: No se pudo crear el archivo " << filename << std::endl;
@@ -189,10 +205,10 @@ bool LargeGraphGenerator::saveGraphToBinary(const Graph& graph, const std::strin
         file.write(reinterpret_cast<const char*>(&y), sizeof(double));
     }
     
-    // Guardar aristas
+    // Guardar aristas: por cada nodo, en el orden anterior, sus destinos como
+    // índices internos (posición en la lista de nodos), no como IDs
     for (int i = 0; i < nodes.getSize(); i++) {
-        const Node& node = nodes[i];
-        const LinkedList<Edge>& adjacencies = graph.getAdjacencies(node.getId());
+        const EdgeList& adjacencies = graph.getAdjacenciesAt(i);
         
         int adj_count = adjacencies.getSize();
         file.write(reinterpret_cast<const char*>(&adj_count), sizeof(int));
@@ -200,7 +216,7 @@ bool LargeGraphGenerator::saveGraphToBinary(const Graph& graph, const std::strin
         for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
             const Edge& edge = *it;
             
-            int dest = edge.getDestination();
+            int dest = edge.getDestinationIndex();
             double weight = edge.getWeight();
             
             file.write(reinterpret_cast<const char*>(&dest), sizeof(int));
@@ -208,13 +224,23 @@ bool LargeGraphGenerator::saveGraphToBinary(const Graph& graph, const std::strin
         }
     }
     
+    if (original_order) {
+        file.write(reinterpret_cast<const char*>(&ORIGINAL_ORDER_TAG), sizeof(int));
+        file.write(reinterpret_cast<const char*>(&node_count), sizeof(int));
+        for (int i = 0; i < node_count; i++) {
+            int position = (*original_order)[i];
+            file.write(reinterpret_cast<const char*>(&position), sizeof(int));
+        }
+    }
+    
     file.close();
     std::cout << "Grafo guardado exitosamente en " << filename << std::endl;
     return true;
 }
 
 // Cargar grafo desde archivo binario
-bool LargeGraphGenerator::loadGraphFromBinary(Graph& graph, const std::string& filename) {
+bool LargeGraphGenerator::loadGraphFromBinary(Graph& graph, const std::string& filename,
+                                              DynamicArray<int>* original_order) {
     std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         std::cerr << "Error: No se pudo abrir el archivo " << filename << std::endl;
@@ -227,6 +253,11 @@ bool LargeGraphGenerator::loadGraphFromBinary(Graph& graph, const std::string& f
     // Leer número de nodos
     int node_count;
     file.read(reinterpret_cast<char*>(&node_count), sizeof(int));
+    if (!file || node_count < 0) {
+        std::cerr << "Error: Encabezado inválido en " << filename << std::endl;
+        return false;
+    }
+    graph.reserve(node_count);
     
     // Leer nodos
     for (int i = 0; i < node_count; i++) {
@@ -246,10 +277,17 @@ bool LargeGraphGenerator::loadGraphFromBinary(Graph& graph, const std::string& f
         file.read(reinterpret_cast<char*>(&x), sizeof(double));
         file.read(reinterpret_cast<char*>(&y), sizeof(double));
         
-        graph.addNode(Node(id, name, x, y));
+        // Un ID repetido o reservado (INT_MIN) desalinearía los índices de
+        // las aristas
+        if (!graph.addNode(Node(id, name, x, y))) {
+            std::cerr << "Error: ID de nodo inválido o repetido en " << filename << std::endl;
+            graph.clear();
+            return false;
+        }
     }
     
-    // Leer aristas
+    // Leer aristas: origen y destino son índices internos, así que los IDs
+    // de los nodos pueden ser cualesquiera
     for (int i = 0; i < node_count; i++) {
         int adj_count;
         file.read(reinterpret_cast<char*>(&adj_count), sizeof(int));
@@ -261,7 +299,28 @@ bool LargeGraphGenerator::loadGraphFromBinary(Graph& graph, const std::string& f
             file.read(reinterpret_cast<char*>(&dest), sizeof(int));
             file.read(reinterpret_cast<char*>(&weight), sizeof(double));
             
-            graph.addEdge(i, dest, weight);
+            graph.addEdgeAt(i, dest, weight);
+        }
+    }
+    
+    // Permutación opcional; sin ella, cada nodo está en su posición original
+    if (original_order) {
+        original_order->clear();
+        int tag = 0;
+        int count = 0;
+        file.read(reinterpret_cast<char*>(&tag), sizeof(int));
+        file.read(reinterpret_cast<char*>(&count), sizeof(int));
+        bool present = file && tag == ORIGINAL_ORDER_TAG && count == node_count;
+        for (int i = 0; i < node_count; i++) {
+            int position = i;
+            if (present) {
+                file.read(reinterpret_cast<char*>(&position), sizeof(int));
+            }
+            original_order->push_back(position);
+        }
+        if (present && !file) {
+            std::cerr << "Error: Permutación truncada en " << filename << std::endl;
+            return false;
         }
     }
     
@@ -291,22 +350,16 @@ double LargeGraphGenerator::calculateDistance(double x1, double y1, double x2, d
     return std::sqrt(dx * dx + dy * dy);
 }
 
-void LargeGraphGenerator::connectNearbyNodes(Graph& graph, int node_id, const DynamicArray<Node>& nodes, 
-                                           double max_distance, int max_connections) {
+void LargeGraphGenerator::connectNearbyNodes(Graph& graph, int node_id, const DynamicArray<Node>& nodes,
+                                           const SpatialGrid& spatial_grid, double max_distance,
+                                           int max_connections) {
     const Node& current_node = nodes[node_id];
-    int connections_made = 0;
+    DynamicArray<std::pair<double, int>> neighbors(max_connections > 0 ? max_connections : 1);
+    spatial_grid.kNearest(current_node.getX(), current_node.getY(), max_connections,
+                          max_distance, node_id, neighbors);
     
-    for (int i = 0; i < nodes.getSize() && connections_made < max_connections; i++) {
-        if (i != node_id) {
-            const Node& other_node = nodes[i];
-            double distance = calculateDistance(current_node.getX(), current_node.getY(),
-                                              other_node.getX(), other_node.getY());
-            
-            if (distance <= max_distance) {
-                graph.addEdge(node_id, i, distance);
-                connections_made++;
-            }
-        }
+    for (int k = 0; k < neighbors.getSize(); k++) {
+        graph.addEdge(node_id, neighbors[k].second, neighbors[k].first);
     }
 }
 
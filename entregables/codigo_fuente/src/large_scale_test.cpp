@@ -36,12 +36,12 @@ void generateGridGraph(Graph& graph) {
 
 void generateCityGraph(Graph& graph) {
     int num_nodes, num_clusters;
-    std::cout << "Ingrese número de nodos (1000-100000): ";
+    std::cout << "Ingrese número de nodos (1000-2000000): ";
     std::cin >> num_nodes;
     std::cout << "Ingrese número de clusters (5-50): ";
     std::cin >> num_clusters;
     
-    if (num_nodes < 1000 || num_nodes > 100000) {
+    if (num_nodes < 1000 || num_nodes > 2000000) {
         std::cout << "Número de nodos inválido. Usando 10000." << std::endl;
         num_nodes = 10000;
     }
@@ -1,13 +1,692 @@
 #include "../include/map_loader.h"
+#include "../include/spatial_grid.h"
+#include "../include/mapped_file.h"
+#include "../include/parallel_for.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <iomanip>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <climits>
+#include <limits>
 
-// Cargar mapa desde archivo CSV
-bool MapLoader::loadFromCSV(Graph& graph, const std::string& nodes_file, const std::string& edges_file) {
+// ===== Tokenizador CSV sobre memoria =====
+
+// Siguiente campo de la fila: [field_begin, field_end) hasta la próxima coma
+// o el fin de línea. Retorna false cuando la fila no tiene más campos
+bool MapLoader::nextField(const char*& cursor, const char* line_end,
+                          const char*& field_begin, const char*& field_end) {
+    if (cursor > line_end) {
+        return false;
+    }
+    field_begin = cursor;
+    const char* p = cursor;
+    while (p < line_end && *p != ',') {
+        p++;
+    }
+    field_end = p;
+    cursor = p + 1;   // Pasa de line_end cuando no había coma: fila agotada
+    return true;
+}
+
+// Entero decimal que ocupa todo el campo (se ignoran espacios alrededor).
+// INT_MIN queda fuera de rango: HashIndex lo reserva como celda vacía
+bool MapLoader::parseInt(const char* begin, const char* end, int& value) {
+    while (begin < end && (*begin == ' ' || *begin == '\t')) begin++;
+    while (end > begin && (end[-1] == ' ' || end[-1] == '\t')) end--;
+    
+    bool negative = false;
+    if (begin < end && (*begin == '-' || *begin == '+')) {
+        negative = *begin == '-';
+        begin++;
+    }
+    if (begin == end) {
+        return false;
+    }
+    
+    long long result = 0;
+    for (const char* p = begin; p < end; p++) {
+        if (*p < '0' || *p > '9') {
+            return false;
+        }
+        result = result * 10 + (*p - '0');
+        if (result > INT_MAX) {
+            return false;
+        }
+    }
+    value = static_cast<int>(negative ? -result : result);
+    return true;
+}
+
+// Número real que ocupa todo el campo: [signo] dígitos [. dígitos] [e [signo] dígitos].
+// Con a lo sumo 19 dígitos significativos se acumula una mantisa entera; si
+// cabe exacta en un double y la potencia de 10 también (|exp| <= 22), un
+// solo producto o cociente da el resultado correctamente redondeado. Los
+// casos restantes (poco frecuentes) se delegan a strtod sobre una copia
+bool MapLoader::parseDouble(const char* begin, const char* end, double& value) {
+    static const double POWERS_OF_TEN[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    
+    while (begin < end && (*begin == ' ' || *begin == '\t')) begin++;
+    while (end > begin && (end[-1] == ' ' || end[-1] == '\t')) end--;
+    
+    const char* p = begin;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+    
+    unsigned long long mantissa = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    bool any_digit = false;
+    bool exact = true;   // false si se descartaron dígitos distintos de cero
+    
+    for (; p < end && *p >= '0' && *p <= '9'; p++) {
+        any_digit = true;
+        if (significant_digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            if (mantissa != 0) significant_digits++;
+        } else {
+            exponent++;
+            if (*p != '0') exact = false;
+        }
+    }
+    if (p < end && *p == '.') {
+        p++;
+        for (; p < end && *p >= '0' && *p <= '9'; p++) {
+            any_digit = true;
+            if (significant_digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                if (mantissa != 0) significant_digits++;
+                exponent--;
+            } else if (*p != '0') {
+                exact = false;
+            }
+        }
+    }
+    if (!any_digit) {
+        return false;
+    }
+    
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negative_exponent = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative_exponent = *p == '-';
+            p++;
+        }
+        if (p == end || *p < '0' || *p > '9') {
+            return false;
+        }
+        int written_exponent = 0;
+        for (; p < end && *p >= '0' && *p <= '9'; p++) {
+            if (written_exponent < 100000) {
+                written_exponent = written_exponent * 10 + (*p - '0');
+            }
+        }
+        exponent += negative_exponent ? -written_exponent : written_exponent;
+    }
+    if (p != end) {
+        return false;
+    }
+    
+    if (exact && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+        double result = static_cast<double>(mantissa);
+        result = exponent < 0 ? result / POWERS_OF_TEN[-exponent] : result * POWERS_OF_TEN[exponent];
+        value = negative ? -result : result;
+        return true;
+    }
+    
+    char buffer[128];
+    size_t length = static_cast<size_t>(end - begin);
+    if (length < sizeof(buffer)) {
+        std::memcpy(buffer, begin, length);
+        buffer[length] = '\0';
+        value = std::strtod(buffer, nullptr);
+    } else {
+        std::string copy(begin, end);
+        value = std::strtod(copy.c_str(), nullptr);
+    }
+    return true;
+}
+
+// Contar una fila rechazada y guardar/imprimir su mensaje si aún hay cupo
+void MapLoader::reportMalformedRow(CSVLoadReport& report, const std::string& filename,
+                                   int line_number, const char* reason) {
+    report.malformed_rows++;
+    if (report.errors.getSize() < MAX_REPORTED_ERRORS) {
+        std::ostringstream message;
+        message << filename << ":" << line_number << ": " << reason;
+        report.errors.push_back(message.str());
+        std::cerr << "Error: " << message.str() << std::endl;
+    }
+}
+
+// Mensaje final de una carga: filas no impresas y conteos
+void MapLoader::printLoadSummary(const CSVLoadReport& report, int node_count, int edge_count) {
+    if (report.malformed_rows > report.errors.getSize()) {
+        std::cerr << "... y " << (report.malformed_rows - report.errors.getSize())
+                  << " filas mal formadas más" << std::endl;
+    }
+    std::cout << "Mapa cargado exitosamente: " << node_count
+              << " nodos, " << edge_count << " aristas";
+    if (report.malformed_rows > 0) {
+        std::cout << " (" << report.malformed_rows << " filas omitidas)";
+    }
+    std::cout << std::endl;
+}
+
+// Fila de nodos "id,name,x,y". Retorna el motivo del rechazo o nullptr
+const char* MapLoader::parseNodeRow(const char* line, const char* line_end, int& id,
+                                    const char*& name_begin, const char*& name_end,
+                                    double& x, double& y) {
+    const char* cursor = line;
+    const char* field_begin;
+    const char* field_end;
+    
+    if (!nextField(cursor, line_end, field_begin, field_end) || !parseInt(field_begin, field_end, id)) {
+        return "el campo id no es un entero válido";
+    }
+    if (!nextField(cursor, line_end, name_begin, name_end)) {
+        return "falta el campo name";
+    }
+    if (!nextField(cursor, line_end, field_begin, field_end)) {
+        return "falta el campo x";
+    }
+    if (!parseDouble(field_begin, field_end, x)) {
+        return "el campo x no es numérico";
+    }
+    if (!nextField(cursor, line_end, field_begin, field_end)) {
+        return "falta el campo y";
+    }
+    if (!parseDouble(field_begin, field_end, y)) {
+        return "el campo y no es numérico";
+    }
+    return nullptr;
+}
+
+// Fila de aristas "source,destination,weight". Retorna el motivo del rechazo o nullptr
+const char* MapLoader::parseEdgeRow(const char* line, const char* line_end, int& source,
+                                    int& destination, double& weight) {
+    const char* cursor = line;
+    const char* field_begin;
+    const char* field_end;
+    
+    if (!nextField(cursor, line_end, field_begin, field_end) || !parseInt(field_begin, field_end, source)) {
+        return "el campo source no es un entero válido";
+    }
+    if (!nextField(cursor, line_end, field_begin, field_end)) {
+        return "falta el campo destination";
+    }
+    if (!parseInt(field_begin, field_end, destination)) {
+        return "el campo destination no es un entero válido";
+    }
+    if (!nextField(cursor, line_end, field_begin, field_end)) {
+        return "falta el campo weight";
+    }
+    if (!parseDouble(field_begin, field_end, weight)) {
+        return "el campo weight no es numérico";
+    }
+    return nullptr;
+}
+
+// Siguiente línea de [line, end): line_end sin '\r' final y next_line tras el '\n'
+static void splitLine(const char* line, const char* end, const char*& line_end, const char*& next_line) {
+    const char* newline = static_cast<const char*>(std::memchr(line, '\n', end - line));
+    line_end = newline ? newline : end;
+    next_line = newline ? newline + 1 : end;
+    if (line_end > line && line_end[-1] == '\r') {
+        line_end--;
+    }
+}
+
+// Cargar mapa desde archivos CSV
+bool MapLoader::loadFromCSV(Graph& graph, const std::string& nodes_file, const std::string& edges_file,
+                            CSVLoadReport* report) {
+    graph.clear();
+    CSVLoadReport local_report;
+    CSVLoadReport& result = report ? *report : local_report;
+    result = CSVLoadReport();
+    
+    MappedFile nodes_map;
+    if (!nodes_map.open(nodes_file)) {
+        std::cerr << "Error: No se pudo abrir el archivo de nodos: " << nodes_file << std::endl;
+        return false;
+    }
+    MappedFile edges_map;
+    if (!edges_map.open(edges_file)) {
+        std::cerr << "Error: No se pudo abrir el archivo de aristas: " << edges_file << std::endl;
+        return false;
+    }
+    
+    // Nodos: una fila por línea, así que el número de saltos de línea acota
+    // el número de nodos y el grafo se dimensiona una sola vez
+    const char* data = nodes_map.getData();
+    const char* end = data + nodes_map.getSize();
+    int line_count = 1;
+    for (const char* p = data; (p = static_cast<const char*>(std::memchr(p, '\n', end - p))) != nullptr; p++) {
+        line_count++;
+    }
+    graph.reserve(line_count);
+    
+    const char* line = data;
+    const char* line_end;
+    const char* next_line;
+    int line_number = 0;
+    for (; line < end; line = next_line) {
+        splitLine(line, end, line_end, next_line);
+        line_number++;
+        
+        // La primera línea es la cabecera; las líneas vacías se ignoran
+        if (line_number == 1 || line_end == line) {
+            continue;
+        }
+        int id;
+        const char* name_begin;
+        const char* name_end;
+        double x, y;
+        const char* reason = parseNodeRow(line, line_end, id, name_begin, name_end, x, y);
+        if (!reason && !graph.addNode(Node(id, std::string(name_begin, name_end), x, y))) {
+            reason = "ID de nodo repetido";
+        }
+        if (reason) {
+            reportMalformedRow(result, nodes_file, line_number, reason);
+        } else {
+            result.nodes_loaded++;
+        }
+    }
+    
+    // Aristas: se insertan directamente mientras se leen
+    data = edges_map.getData();
+    end = data + edges_map.getSize();
+    line_number = 0;
+    for (line = data; line < end; line = next_line) {
+        splitLine(line, end, line_end, next_line);
+        line_number++;
+        
+        if (line_number == 1 || line_end == line) {
+            continue;
+        }
+        int source, destination;
+        double weight;
+        const char* reason = parseEdgeRow(line, line_end, source, destination, weight);
+        if (!reason && !graph.addEdge(source, destination, weight)) {
+            reason = "la arista referencia un nodo inexistente";
+        }
+        if (reason) {
+            reportMalformedRow(result, edges_file, line_number, reason);
+        } else {
+            result.edges_loaded++;
+        }
+    }
+    
+    printLoadSummary(result, graph.getNodeCount(), graph.getEdgeCount());
+    return true;
+}
+
+// ===== Carga paralela por fragmentos =====
+
+// Filas de un fragmento del archivo de nodos, parseadas por un hilo. Las
+// líneas se numeran dentro del fragmento; al combinar se suman las líneas
+// de los fragmentos anteriores
+struct MapLoader::NodeChunk {
+    const char* begin;
+    const char* end;
+    bool has_header;                  // Solo el primer fragmento
+    int line_count;
+    DynamicArray<int> lines;          // Línea de cada fila válida
+    DynamicArray<int> ids;
+    DynamicArray<double> xs;
+    DynamicArray<double> ys;
+    DynamicArray<int> name_offsets;   // Nombres empaquetados
+    DynamicArray<char> name_chars;
+    DynamicArray<std::pair<int, const char*>> errors; // (línea, motivo)
+};
+
+// Filas de un fragmento del archivo de aristas. Con índice de nodos, los
+// extremos se guardan ya traducidos a índices internos
+struct MapLoader::EdgeChunk {
+    const char* begin;
+    const char* end;
+    bool has_header;
+    int line_count;
+    DynamicArray<int> lines;
+    DynamicArray<int> sources;
+    DynamicArray<int> destinations;
+    DynamicArray<double> weights;
+    DynamicArray<std::pair<int, const char*>> errors;
+};
+
+// Dividir [data, end) en chunk_count fragmentos de tamaño parecido que
+// empiezan al inicio de una línea (bounds tiene chunk_count + 1 entradas)
+void MapLoader::splitAtNewlines(const char* data, const char* end, int chunk_count,
+                                DynamicArray<const char*>& bounds) {
+    bounds.clear();
+    bounds.push_back(data);
+    for (int k = 1; k < chunk_count; k++) {
+        const char* p = data + static_cast<long long>(end - data) * k / chunk_count;
+        if (p < bounds[k - 1]) {
+            p = bounds[k - 1];
+        }
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        bounds.push_back(newline ? newline + 1 : end);
+    }
+    bounds.push_back(end);
+}
+
+void MapLoader::parseNodeChunk(NodeChunk& chunk) {
+    chunk.line_count = 0;
+    chunk.name_offsets.push_back(0);
+    const char* line_end;
+    const char* next_line;
+    for (const char* line = chunk.begin; line < chunk.end; line = next_line) {
+        splitLine(line, chunk.end, line_end, next_line);
+        chunk.line_count++;
+        if ((chunk.has_header && chunk.line_count == 1) || line_end == line) {
+            continue;
+        }
+        
+        int id;
+        const char* name_begin;
+        const char* name_end;
+        double x, y;
+        const char* reason = parseNodeRow(line, line_end, id, name_begin, name_end, x, y);
+        if (reason) {
+            chunk.errors.push_back(std::make_pair(chunk.line_count, reason));
+            continue;
+        }
+        chunk.lines.push_back(chunk.line_count);
+        chunk.ids.push_back(id);
+        chunk.xs.push_back(x);
+        chunk.ys.push_back(y);
+        for (const char* c = name_begin; c < name_end; c++) {
+            chunk.name_chars.push_back(*c);
+        }
+        chunk.name_offsets.push_back(chunk.name_chars.getSize());
+    }
+}
+
+void MapLoader::parseEdgeChunk(EdgeChunk& chunk, const HashIndex* node_index) {
+    chunk.line_count = 0;
+    const char* line_end;
+    const char* next_line;
+    for (const char* line = chunk.begin; line < chunk.end; line = next_line) {
+        splitLine(line, chunk.end, line_end, next_line);
+        chunk.line_count++;
+        if ((chunk.has_header && chunk.line_count == 1) || line_end == line) {
+            continue;
+        }
+        
+        int source, destination;
+        double weight;
+        const char* reason = parseEdgeRow(line, line_end, source, destination, weight);
+        if (!reason && node_index) {
+            source = node_index->find(source);
+            destination = node_index->find(destination);
+            if (source == -1 || destination == -1) {
+                reason = "la arista referencia un nodo inexistente";
+            }
+        }
+        if (reason) {
+            chunk.errors.push_back(std::make_pair(chunk.line_count, reason));
+            continue;
+        }
+        chunk.lines.push_back(chunk.line_count);
+        chunk.sources.push_back(source);
+        chunk.destinations.push_back(destination);
+        chunk.weights.push_back(weight);
+    }
+}
+
+// Abrir ambos archivos y parsear los nodos en paralelo
+bool MapLoader::parseNodesInParallel(const std::string& nodes_file, const std::string& edges_file,
+                                     MappedFile& nodes_map, MappedFile& edges_map,
+                                     NodeChunk* chunks, int num_threads) {
+    if (!nodes_map.open(nodes_file)) {
+        std::cerr << "Error: No se pudo abrir el archivo de nodos: " << nodes_file << std::endl;
+        return false;
+    }
+    if (!edges_map.open(edges_file)) {
+        std::cerr << "Error: No se pudo abrir el archivo de aristas: " << edges_file << std::endl;
+        return false;
+    }
+    
+    DynamicArray<const char*> bounds;
+    splitAtNewlines(nodes_map.getData(), nodes_map.getData() + nodes_map.getSize(), num_threads, bounds);
+    for (int c = 0; c < num_threads; c++) {
+        chunks[c].begin = bounds[c];
+        chunks[c].end = bounds[c + 1];
+        chunks[c].has_header = c == 0;
+    }
+    parallelFor(num_threads, num_threads, [chunks](int c) {
+        parseNodeChunk(chunks[c]);
+    });
+    return true;
+}
+
+// Parsear las aristas en paralelo (node_index: traducir IDs a índices)
+void MapLoader::parseEdgesInParallel(const MappedFile& edges_map, EdgeChunk* chunks, int num_threads,
+                                     const HashIndex* node_index) {
+    DynamicArray<const char*> bounds;
+    splitAtNewlines(edges_map.getData(), edges_map.getData() + edges_map.getSize(), num_threads, bounds);
+    for (int c = 0; c < num_threads; c++) {
+        chunks[c].begin = bounds[c];
+        chunks[c].end = bounds[c + 1];
+        chunks[c].has_header = c == 0;
+    }
+    parallelFor(num_threads, num_threads, [chunks, node_index](int c) {
+        parseEdgeChunk(chunks[c], node_index);
+    });
+}
+
+bool MapLoader::loadFromCSVParallel(Graph& graph, const std::string& nodes_file, const std::string& edges_file,
+                                    int num_threads, CSVLoadReport* report) {
+    graph.clear();
+    CSVLoadReport local_report;
+    CSVLoadReport& result = report ? *report : local_report;
+    result = CSVLoadReport();
+    if (num_threads < 1) num_threads = 1;
+    
+    MappedFile nodes_map, edges_map;
+    NodeChunk* node_chunks = new NodeChunk[num_threads];
+    if (!parseNodesInParallel(nodes_file, edges_file, nodes_map, edges_map, node_chunks, num_threads)) {
+        delete[] node_chunks;
+        return false;
+    }
+    
+    // Inserción secuencial en orden de archivo (Graph no es thread-safe)
+    int total_rows = 0;
+    for (int c = 0; c < num_threads; c++) {
+        total_rows += node_chunks[c].ids.getSize();
+    }
+    graph.reserve(total_rows);
+    int line_base = 0;
+    for (int c = 0; c < num_threads; c++) {
+        NodeChunk& chunk = node_chunks[c];
+        int next_error = 0;
+        for (int r = 0; r < chunk.ids.getSize(); r++) {
+            for (; next_error < chunk.errors.getSize() && chunk.errors[next_error].first < chunk.lines[r]; next_error++) {
+                reportMalformedRow(result, nodes_file, line_base + chunk.errors[next_error].first,
+                                   chunk.errors[next_error].second);
+            }
+            std::string name(chunk.name_chars.begin() + chunk.name_offsets[r],
+                             chunk.name_chars.begin() + chunk.name_offsets[r + 1]);
+            if (graph.addNode(Node(chunk.ids[r], name, chunk.xs[r], chunk.ys[r]))) {
+                result.nodes_loaded++;
+            } else {
+                reportMalformedRow(result, nodes_file, line_base + chunk.lines[r], "ID de nodo repetido");
+            }
+        }
+        for (; next_error < chunk.errors.getSize(); next_error++) {
+            reportMalformedRow(result, nodes_file, line_base + chunk.errors[next_error].first,
+                               chunk.errors[next_error].second);
+        }
+        line_base += chunk.line_count;
+    }
+    delete[] node_chunks;
+    
+    EdgeChunk* edge_chunks = new EdgeChunk[num_threads];
+    parseEdgesInParallel(edges_map, edge_chunks, num_threads, nullptr);
+    line_base = 0;
+    for (int c = 0; c < num_threads; c++) {
+        EdgeChunk& chunk = edge_chunks[c];
+        int next_error = 0;
+        for (int r = 0; r < chunk.sources.getSize(); r++) {
+            for (; next_error < chunk.errors.getSize() && chunk.errors[next_error].first < chunk.lines[r]; next_error++) {
+                reportMalformedRow(result, edges_file, line_base + chunk.errors[next_error].first,
+                                   chunk.errors[next_error].second);
+            }
+            if (graph.addEdge(chunk.sources[r], chunk.destinations[r], chunk.weights[r])) {
+                result.edges_loaded++;
+            } else {
+                reportMalformedRow(result, edges_file, line_base + chunk.lines[r],
+                                   "la arista referencia un nodo inexistente");
+            }
+        }
+        for (; next_error < chunk.errors.getSize(); next_error++) {
+            reportMalformedRow(result, edges_file, line_base + chunk.errors[next_error].first,
+                               chunk.errors[next_error].second);
+        }
+        line_base += chunk.line_count;
+    }
+    delete[] edge_chunks;
+    
+    printLoadSummary(result, graph.getNodeCount(), graph.getEdgeCount());
+    return true;
+}
+
+bool MapLoader::loadCompactFromCSV(CompactGraph& graph, const std::string& nodes_file, const std::string& edges_file,
+                                   int num_threads, CSVLoadReport* report) {
+    CSVLoadReport local_report;
+    CSVLoadReport& result = report ? *report : local_report;
+    result = CSVLoadReport();
+    if (num_threads < 1) num_threads = 1;
+    
+    MappedFile nodes_map, edges_map;
+    NodeChunk* node_chunks = new NodeChunk[num_threads];
+    if (!parseNodesInParallel(nodes_file, edges_file, nodes_map, edges_map, node_chunks, num_threads)) {
+        delete[] node_chunks;
+        return false;
+    }
+    
+    // Nodos en orden de archivo; el índice ID -> posición detecta repetidos
+    int total_rows = 0;
+    for (int c = 0; c < num_threads; c++) {
+        total_rows += node_chunks[c].ids.getSize();
+    }
+    int capacity = total_rows > 0 ? total_rows : 1;
+    DynamicArray<int> ids(capacity);
+    DynamicArray<double> xs(capacity);
+    DynamicArray<double> ys(capacity);
+    DynamicArray<int> name_offsets(capacity + 1);
+    DynamicArray<char> name_chars(capacity * 8);
+    HashIndex node_index(total_rows * 2);
+    name_offsets.push_back(0);
+    
+    int line_base = 0;
+    for (int c = 0; c < num_threads; c++) {
+        NodeChunk& chunk = node_chunks[c];
+        int next_error = 0;
+        for (int r = 0; r < chunk.ids.getSize(); r++) {
+            for (; next_error < chunk.errors.getSize() && chunk.errors[next_error].first < chunk.lines[r]; next_error++) {
+                reportMalformedRow(result, nodes_file, line_base + chunk.errors[next_error].first,
+                                   chunk.errors[next_error].second);
+            }
+            if (node_index.contains(chunk.ids[r])) {
+                reportMalformedRow(result, nodes_file, line_base + chunk.lines[r], "ID de nodo repetido");
+                continue;
+            }
+            node_index.insert(chunk.ids[r], ids.getSize());
+            ids.push_back(chunk.ids[r]);
+            xs.push_back(chunk.xs[r]);
+            ys.push_back(chunk.ys[r]);
+            for (int k = chunk.name_offsets[r]; k < chunk.name_offsets[r + 1]; k++) {
+                name_chars.push_back(chunk.name_chars[k]);
+            }
+            name_offsets.push_back(name_chars.getSize());
+            result.nodes_loaded++;
+        }
+        for (; next_error < chunk.errors.getSize(); next_error++) {
+            reportMalformedRow(result, nodes_file, line_base + chunk.errors[next_error].first,
+                               chunk.errors[next_error].second);
+        }
+        line_base += chunk.line_count;
+    }
+    delete[] node_chunks;
+    
+    // Aristas: cada hilo traduce sus IDs con el índice (solo lectura), así
+    // que los extremos inexistentes ya vienen como errores del fragmento
+    EdgeChunk* edge_chunks = new EdgeChunk[num_threads];
+    parseEdgesInParallel(edges_map, edge_chunks, num_threads, &node_index);
+    int total_edges = 0;
+    for (int c = 0; c < num_threads; c++) {
+        total_edges += edge_chunks[c].sources.getSize();
+    }
+    int edge_capacity = total_edges > 0 ? total_edges : 1;
+    DynamicArray<int> sources(edge_capacity);
+    DynamicArray<int> destinations(edge_capacity);
+    DynamicArray<double> weights(edge_capacity);
+    line_base = 0;
+    for (int c = 0; c < num_threads; c++) {
+        EdgeChunk& chunk = edge_chunks[c];
+        for (int r = 0; r < chunk.sources.getSize(); r++) {
+            sources.push_back(chunk.sources[r]);
+            destinations.push_back(chunk.destinations[r]);
+            weights.push_back(chunk.weights[r]);
+        }
+        for (int e = 0; e < chunk.errors.getSize(); e++) {
+            reportMalformedRow(result, edges_file, line_base + chunk.errors[e].first, chunk.errors[e].second);
+        }
+        line_base += chunk.line_count;
+    }
+    result.edges_loaded = total_edges;
+    delete[] edge_chunks;
+    
+    graph.buildFromEdgeList(ids, xs, ys, name_offsets, name_chars, sources, destinations, weights, num_threads);
+    
+    printLoadSummary(result, graph.getNodeCount(), graph.getEdgeCount());
+    return true;
+}
+
+// Guardar el grafo en el formato CSV que lee loadFromCSV. El formato no
+// admite comillas: los nombres no deben contener comas ni saltos de línea
+bool MapLoader::saveToCSV(const Graph& graph, const std::string& nodes_file, const std::string& edges_file) {
+    std::ofstream nodes_stream(nodes_file);
+    std::ofstream edges_stream(edges_file);
+    if (!nodes_stream.is_open() || !edges_stream.is_open()) {
+        std::cerr << "Error: No se pudo crear el archivo CSV: " << nodes_file << " / " << edges_file << std::endl;
+        return false;
+    }
+    
+    // 17 dígitos significativos: las coordenadas y pesos se recuperan exactos
+    nodes_stream << std::setprecision(17);
+    edges_stream << std::setprecision(17);
+    nodes_stream << "id,name,x,y\n";
+    edges_stream << "source,destination,weight\n";
+    
+    const DynamicArray<Node>& nodes = graph.getAllNodes();
+    for (int i = 0; i < nodes.getSize(); i++) {
+        const Node& node = nodes[i];
+        nodes_stream << node.getId() << ',' << node.getName() << ',' << node.getX() << ',' << node.getY() << '\n';
+        
+        const EdgeList& edges = graph.getAdjacencies(node.getId());
+        for (auto it = edges.begin(); it != edges.end(); ++it) {
+            edges_stream << (*it).getSource() << ',' << (*it).getDestination() << ',' << (*it).getWeight() << '\n';
+        }
+    }
+    
+    return nodes_stream.good() && edges_stream.good();
+}
+
+// Cargador anterior, conservado como referencia del benchmark
+bool MapLoader::loadFromCSVLegacy(Graph& graph, const std::string& nodes_file, const std::string& edges_file) {
     // Limpiar el grafo existente
     graph.clear();
     
@@ -158,39 +837,23 @@ void MapLoader::generateSyntheticMap(Graph& graph, int num_nodes, double width,
         graph.addNode(Node(i, name, x, y));
     }
     
-    // Conectar cada nodo con sus vecinos más cercanos
+    // Conectar cada nodo con sus vecinos más cercanos (índice espacial en
+    // lugar de ordenar las distancias a todos los nodos)
     const DynamicArray<Node>& nodes = graph.getAllNodes();
+    SpatialGrid spatial_grid;
+    spatial_grid.build(nodes);
+    DynamicArray<std::pair<double, int>> neighbors;
     
     for (int i = 0; i < nodes.getSize(); i++) {
         // Encontrar los 3-5 vecinos más cercanos
         int max_connections = 3 + (std::rand() % 3); // 3-5 conexiones
-        
-        DynamicArray<std::pair<double, int>> distances;
-        
-        for (int j = 0; j < nodes.getSize(); j++) {
-            if (i != j) {
-                double dist = calculateDistance(nodes[i].getX(), nodes[i].getY(),
-                                              nodes[j].getX(), nodes[j].getY());
-                distances.push_back(std::make_pair(dist, j));
-            }
-        }
-        
-        // Ordenar por distancia (bubble sort simple)
-        for (int k = 0; k < distances.getSize() - 1; k++) {
-            for (int l = 0; l < distances.getSize() - k - 1; l++) {
-                if (distances[l].first > distances[l + 1].first) {
-                    auto temp = distances[l];
-                    distances[l] = distances[l + 1];
-                    distances[l + 1] = temp;
-                }
-            }
-        }
+        spatial_grid.kNearest(nodes[i].getX(), nodes[i].getY(), max_connections,
+                              std::numeric_limits<double>::infinity(), i, neighbors);
         
         // Conectar con los vecinos más cercanos
-        int connections = std::min(max_connections, distances.getSize());
-        for (int k = 0; k < connections; k++) {
-            int neighbor = distances[k].second;
-            double weight = distances[k].first;
+        for (int k = 0; k < neighbors.getSize(); k++) {
+            int neighbor = neighbors[k].second;
+            double weight = neighbors[k].first;
             
             // Solo agregar si no existe ya la conexión
             if (!graph.hasEdge(i, neighbor)) {
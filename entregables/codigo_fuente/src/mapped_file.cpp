@@ -0,0 +1,169 @@
+#include "../include/mapped_file.h"
+#include <iostream>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Datos de los archivos vacíos (abiertos sin proyección)
+static const char EMPTY_FILE_DATA[1] = {0};
+
+// Constructor y destructor
+#ifdef _WIN32
+MappedFile::MappedFile() : data(nullptr), size(0), file_handle(nullptr), mapping_handle(nullptr) {}
+#else
+MappedFile::MappedFile() : data(nullptr), size(0) {}
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        std::cerr << "Error: No se pudo abrir el archivo " << filename << std::endl;
+        return false;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        std::cerr << "Error: No se pudo obtener el tamaño de " << filename << std::endl;
+        CloseHandle(file);
+        return false;
+    }
+    if (file_size.QuadPart == 0) {
+        // CreateFileMapping no admite archivos vacíos
+        CloseHandle(file);
+        data = EMPTY_FILE_DATA;
+        this->filename = filename;
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        std::cerr << "Error: No se pudo proyectar el archivo " << filename << std::endl;
+        CloseHandle(file);
+        return false;
+    }
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        std::cerr << "Error: No se pudo proyectar el archivo " << filename << std::endl;
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    data = static_cast<const char*>(view);
+    size = static_cast<size_t>(file_size.QuadPart);
+    file_handle = file;
+    mapping_handle = mapping;
+    this->filename = filename;
+    return true;
+}
+
+void MappedFile::close() {
+    if (data && data != EMPTY_FILE_DATA) {
+        UnmapViewOfFile(data);
+        CloseHandle(static_cast<HANDLE>(mapping_handle));
+        CloseHandle(static_cast<HANDLE>(file_handle));
+    }
+    data = nullptr;
+    size = 0;
+    file_handle = nullptr;
+    mapping_handle = nullptr;
+    filename.clear();
+}
+
+void MappedFile::swap(MappedFile& other) {
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    std::swap(filename, other.filename);
+    std::swap(file_handle, other.file_handle);
+    std::swap(mapping_handle, other.mapping_handle);
+}
+
+#else
+
+bool MappedFile::open(const std::string& filename) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        std::cerr << "Error: No se pudo abrir el archivo " << filename << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        std::cerr << "Error: No se pudo obtener el tamaño de " << filename << std::endl;
+        ::close(fd);
+        return false;
+    }
+    if (info.st_size == 0) {
+        // mmap no admite longitud 0
+        ::close(fd);
+        data = EMPTY_FILE_DATA;
+        this->filename = filename;
+        return true;
+    }
+
+    // La proyección sigue siendo válida después de cerrar el descriptor
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        std::cerr << "Error: No se pudo proyectar el archivo " << filename << std::endl;
+        return false;
+    }
+
+    data = static_cast<const char*>(view);
+    size = static_cast<size_t>(info.st_size);
+    this->filename = filename;
+    return true;
+}
+
+void MappedFile::close() {
+    if (data && data != EMPTY_FILE_DATA) {
+        munmap(const_cast<char*>(data), size);
+    }
+    data = nullptr;
+    size = 0;
+    filename.clear();
+}
+
+void MappedFile::swap(MappedFile& other) {
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    std::swap(filename, other.filename);
+}
+
+#endif
+
+// Información
+bool MappedFile::isOpen() const {
+    return data != nullptr;
+}
+
+const char* MappedFile::getData() const {
+    return data;
+}
+
+size_t MappedFile::getSize() const {
+    return size;
+}
+
+const std::string& MappedFile::getFilename() const {
+    return filename;
+}
@@ -0,0 +1,276 @@
+#include "../include/node_reordering.h"
+#include <cstdlib>
+
+// Vecinos sin dirección del nodo u (salientes y entrantes), por índice
+template <typename Visit>
+static void forEachNeighbor(const Graph& graph, int u, Visit visit) {
+    const EdgeList& outgoing = graph.getAdjacenciesAt(u);
+    for (auto it = outgoing.begin(); it != outgoing.end(); ++it) {
+        visit((*it).getDestinationIndex());
+    }
+    const EdgeList& incoming = graph.getIncomingEdgesAt(u);
+    for (auto it = incoming.begin(); it != incoming.end(); ++it) {
+        visit((*it).getSourceIndex());
+    }
+}
+
+// BFS sin dirección desde 'root' que agrega a 'order' los nodos cuya marca
+// no es 'stamp' (y se la pone); el propio 'order' hace de cola. Con
+// 'degree', los vecinos descubiertos desde cada nodo se encolan por grado
+// creciente (Cuthill-McKee)
+static void breadthFirstFrom(const Graph& graph, int root, DynamicArray<int>& mark, int stamp,
+                             DynamicArray<int>& order, const DynamicArray<int>* degree) {
+    int head = order.getSize();
+    mark[root] = stamp;
+    order.push_back(root);
+    while (head < order.getSize()) {
+        int u = order[head++];
+        int first_new = order.getSize();
+        forEachNeighbor(graph, u, [&](int v) {
+            if (mark[v] != stamp) {
+                mark[v] = stamp;
+                order.push_back(v);
+            }
+        });
+        if (degree) {
+            // Pocos vecinos por nodo: inserción (estable por índice de descubrimiento)
+            for (int i = first_new + 1; i < order.getSize(); i++) {
+                int v = order[i];
+                int j = i - 1;
+                while (j >= first_new && (*degree)[order[j]] > (*degree)[v]) {
+                    order[j + 1] = order[j];
+                    j--;
+                }
+                order[j + 1] = v;
+            }
+        }
+    }
+}
+
+// Índice d del punto (x, y) sobre la curva de Hilbert que recorre una
+// cuadrícula de side x side (side potencia de 2)
+static unsigned int hilbertIndex(unsigned int side, unsigned int x, unsigned int y) {
+    unsigned int d = 0;
+    for (unsigned int s = side / 2; s > 0; s /= 2) {
+        unsigned int rx = (x & s) ? 1u : 0u;
+        unsigned int ry = (y & s) ? 1u : 0u;
+        d += s * s * ((3u * rx) ^ ry);
+        // Rotar el cuadrante para que la curva sea continua
+        if (ry == 0) {
+            if (rx == 1) {
+                x = side - 1 - x;
+                y = side - 1 - y;
+            }
+            unsigned int t = x;
+            x = y;
+            y = t;
+        }
+    }
+    return d;
+}
+
+// Calcular el orden según la estrategia
+void NodeReordering::computeOrder(const Graph& graph, NodeOrdering ordering, DynamicArray<int>& order) {
+    switch (ordering) {
+        case ORDER_HILBERT:
+            hilbertOrder(graph, order);
+            break;
+        case ORDER_BFS:
+            bfsOrder(graph, order);
+            break;
+        case ORDER_RCM:
+            reverseCuthillMcKeeOrder(graph, order);
+            break;
+    }
+}
+
+// Las coordenadas se llevan a una cuadrícula de 2^16 x 2^16 (misma escala
+// en ambos ejes) y los nodos se ordenan por su índice de Hilbert con radix
+// sort estable (dos pasadas de 16 bits): los empates conservan el orden original
+void NodeReordering::hilbertOrder(const Graph& graph, DynamicArray<int>& order) {
+    const unsigned int SIDE = 1u << 16;
+    int n = graph.getNodeCount();
+    order = DynamicArray<int>(n > 0 ? n : 1);
+    if (n == 0) return;
+
+    double min_x = graph.getNodeAt(0).getX();
+    double max_x = min_x;
+    double min_y = graph.getNodeAt(0).getY();
+    double max_y = min_y;
+    for (int i = 1; i < n; i++) {
+        const Node& node = graph.getNodeAt(i);
+        if (node.getX() < min_x) min_x = node.getX();
+        if (node.getX() > max_x) max_x = node.getX();
+        if (node.getY() < min_y) min_y = node.getY();
+        if (node.getY() > max_y) max_y = node.getY();
+    }
+    double span = max_x - min_x > max_y - min_y ? max_x - min_x : max_y - min_y;
+    double scale = span > 0.0 ? (SIDE - 1) / span : 0.0;
+
+    DynamicArray<unsigned int> keys(n);
+    DynamicArray<int> buffer(n);
+    for (int i = 0; i < n; i++) {
+        const Node& node = graph.getNodeAt(i);
+        unsigned int cx = static_cast<unsigned int>((node.getX() - min_x) * scale);
+        unsigned int cy = static_cast<unsigned int>((node.getY() - min_y) * scale);
+        keys.push_back(hilbertIndex(SIDE, cx, cy));
+        order.push_back(i);
+        buffer.push_back(0);
+    }
+
+    DynamicArray<int> counts(SIDE + 1);
+    for (unsigned int b = 0; b <= SIDE; b++) {
+        counts.push_back(0);
+    }
+    for (int shift = 0; shift < 32; shift += 16) {
+        for (unsigned int b = 0; b <= SIDE; b++) {
+            counts[b] = 0;
+        }
+        for (int i = 0; i < n; i++) {
+            counts[((keys[order[i]] >> shift) & 0xFFFFu) + 1]++;
+        }
+        for (unsigned int b = 1; b <= SIDE; b++) {
+            counts[b] += counts[b - 1];
+        }
+        for (int i = 0; i < n; i++) {
+            buffer[counts[(keys[order[i]] >> shift) & 0xFFFFu]++] = order[i];
+        }
+        for (int i = 0; i < n; i++) {
+            order[i] = buffer[i];
+        }
+    }
+}
+
+// Un BFS por componente, empezando cada uno por su nodo de menor índice
+void NodeReordering::bfsOrder(const Graph& graph, DynamicArray<int>& order) {
+    int n = graph.getNodeCount();
+    order = DynamicArray<int>(n > 0 ? n : 1);
+    DynamicArray<int> mark(n > 0 ? n : 1);
+    for (int i = 0; i < n; i++) {
+        mark.push_back(0);
+    }
+    for (int root = 0; root < n; root++) {
+        if (mark[root] == 0) {
+            breadthFirstFrom(graph, root, mark, 1, order, nullptr);
+        }
+    }
+}
+
+// Cuthill-McKee por componente: los componentes se toman en orden de grado
+// creciente de su primer nodo; cada uno se recorre desde un nodo
+// aproximadamente periférico (el último alcanzado por un BFS de prueba) y
+// los vecinos se encolan por grado creciente. Al final se invierte el orden,
+// lo que reduce el ancho de banda de la matriz de adyacencia
+void NodeReordering::reverseCuthillMcKeeOrder(const Graph& graph, DynamicArray<int>& order) {
+    int n = graph.getNodeCount();
+    DynamicArray<int> cuthill_mckee(n > 0 ? n : 1);
+    order = DynamicArray<int>(n > 0 ? n : 1);
+    if (n == 0) return;
+
+    // Grado sin dirección y nodos ordenados por grado (counting sort)
+    DynamicArray<int> degree(n);
+    int max_degree = 0;
+    for (int i = 0; i < n; i++) {
+        int d = graph.getAdjacenciesAt(i).getSize() + graph.getIncomingEdgesAt(i).getSize();
+        degree.push_back(d);
+        if (d > max_degree) max_degree = d;
+    }
+    DynamicArray<int> counts(max_degree + 2);
+    for (int d = 0; d <= max_degree + 1; d++) {
+        counts.push_back(0);
+    }
+    for (int i = 0; i < n; i++) {
+        counts[degree[i] + 1]++;
+    }
+    for (int d = 1; d <= max_degree + 1; d++) {
+        counts[d] += counts[d - 1];
+    }
+    DynamicArray<int> by_degree(n);
+    for (int i = 0; i < n; i++) {
+        by_degree.push_back(0);
+    }
+    for (int i = 0; i < n; i++) {
+        by_degree[counts[degree[i]]++] = i;
+    }
+
+    // mark: 1 si ya está en el orden final; probe: BFS de prueba (marca k + 2)
+    DynamicArray<int> mark(n);
+    DynamicArray<int> probe_mark(n);
+    for (int i = 0; i < n; i++) {
+        mark.push_back(0);
+        probe_mark.push_back(0);
+    }
+    DynamicArray<int> probe;
+    for (int k = 0; k < n; k++) {
+        int seed = by_degree[k];
+        if (mark[seed] != 0) continue;
+        probe.clear();
+        breadthFirstFrom(graph, seed, probe_mark, k + 2, probe, &degree);
+        breadthFirstFrom(graph, probe[probe.getSize() - 1], mark, 1, cuthill_mckee, &degree);
+    }
+
+    for (int i = n - 1; i >= 0; i--) {
+        order.push_back(cuthill_mckee[i]);
+    }
+}
+
+// Copiar el grafo con los nodos en el orden dado
+bool NodeReordering::apply(const Graph& graph, const DynamicArray<int>& order, Graph& reordered) {
+    int n = graph.getNodeCount();
+    if (order.getSize() != n || &graph == &reordered) {
+        return false;
+    }
+    DynamicArray<int> new_index(n > 0 ? n : 1);
+    for (int i = 0; i < n; i++) {
+        new_index.push_back(-1);
+    }
+    for (int k = 0; k < n; k++) {
+        int old_index = order[k];
+        if (old_index < 0 || old_index >= n || new_index[old_index] != -1) {
+            return false;
+        }
+        new_index[old_index] = k;
+    }
+
+    reordered.clear();
+    reordered.reserve(n);
+    for (int k = 0; k < n; k++) {
+        reordered.addNode(graph.getNodeAt(order[k]));
+    }
+    // Cada lista de adyacencia conserva el orden de sus aristas
+    for (int k = 0; k < n; k++) {
+        const EdgeList& edges = graph.getAdjacenciesAt(order[k]);
+        for (auto it = edges.begin(); it != edges.end(); ++it) {
+            reordered.addEdgeAt(k, new_index[(*it).getDestinationIndex()], (*it).getWeight());
+        }
+    }
+    return true;
+}
+
+void NodeReordering::reorder(const Graph& graph, NodeOrdering ordering, Graph& reordered, DynamicArray<int>& order) {
+    computeOrder(graph, ordering, order);
+    apply(graph, order, reordered);
+}
+
+// Promedio de |índice origen - índice destino| por arista
+double NodeReordering::averageEdgeSpan(const Graph& graph) {
+    long long total = 0;
+    int edges = 0;
+    for (int u = 0; u < graph.getNodeCount(); u++) {
+        const EdgeList& adjacencies = graph.getAdjacenciesAt(u);
+        for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
+            total += std::abs((*it).getDestinationIndex() - u);
+            edges++;
+        }
+    }
+    return edges > 0 ? static_cast<double>(total) / edges : 0.0;
+}
+
+const char* NodeReordering::getName(NodeOrdering ordering) {
+    switch (ordering) {
+        case ORDER_HILBERT: return "Hilbert";
+        case ORDER_BFS: return "BFS";
+        case ORDER_RCM: return "RCM";
+    }
+    return "?";
+}
@@ -1,14 +1,67 @@
 #include "../include/performance_analyzer.h"
 #include "../include/large_graph_generator.h"
+#include "../include/map_loader.h"
+#include "../include/indexed_priority_queue.h"
+#include "../include/parallel_for.h"
+#include "../include/query_executor.h"
+#include "../include/delta_stepping.h"
+#include "../include/jump_point_search.h"
+#include "../include/implicit_grid_graph.h"
+#include "../include/graph_search.h"
+#include "../include/node_reordering.h"
+#include "../include/node_pool.h"
+#include "../include/queue.h"
+#include "../include/ring_queue.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <cstdlib>
 #include <ctime>
 #include <cmath>
+#include <limits>
+#include <cstdio>
+
+// Dijkstra uno-a-todos sobre CSR con un heap de la aridad indicada.
+// Retorna el tiempo en ms y deja en 'settled' los nodos asentados.
+template<int Arity>
+static double timeIndexedDijkstra(const CompactGraph& graph, int source, int& settled) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    
+    int n = graph.getNodeCount();
+    DynamicArray<double> distance(n);
+    DynamicArray<bool> done(n);
+    for (int i = 0; i < n; i++) {
+        distance.push_back(1e300);
+        done.push_back(false);
+    }
+    
+    IndexedPriorityQueue<double, Arity> pq(n);
+    distance[source] = 0.0;
+    pq.push(source, 0.0);
+    settled = 0;
+    
+    while (!pq.isEmpty()) {
+        int u = pq.top();
+        pq.pop();
+        done[u] = true;
+        settled++;
+        
+        for (int e = graph.edgesBegin(u); e < graph.edgesEnd(u); e++) {
+            int v = graph.getTarget(e);
+            double candidate = distance[u] + graph.getWeight(e);
+            if (!done[v] && candidate < distance[v]) {
+                distance[v] = candidate;
+                pq.pushOrDecrease(v, candidate);
+            }
+        }
+    }
+    
+    auto end_time = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
 
 // Constructor
-PerformanceAnalyzer::PerformanceAnalyzer() {}
+PerformanceAnalyzer::PerformanceAnalyzer() : landmarks(nullptr), hierarchy(nullptr) {}
 
 // Medir rendimiento de construcción de grafo
 PerformanceMetrics PerformanceAnalyzer::measureGraphConstruction(int num_nodes, const std::string& graph_type) {
@@ -50,6 +103,7 @@ PerformanceMetrics PerformanceAnalyzer::measureSearchAlgorithm(const Graph& grap
     metrics.goal_node = goal;
     
     SearchAlgorithms search(&graph);
+    search.setLandmarks(landmarks);
     SearchResult result;
     
     auto start_time = std::chrono::high_resolution_clock::now();
@@ -64,6 +118,14 @@ PerformanceMetrics PerformanceAnalyzer::measureSearchAlgorithm(const Graph& grap
         result = search.bestFirstSearch(start, goal);
     } else if (algorithm == "A*") {
         result = search.aStar(start, goal);
+    } else if (algorithm == "Bidirectional Dijkstra") {
+        result = search.bidirectionalDijkstra(start, goal);
+    } else if (algorithm == "Bidirectional A*") {
+        result = search.bidirectionalAStar(start, goal);
+    } else if (algorithm == "ALT") {
+        result = search.altSearch(start, goal);
+    } else if (algorithm == "CH" && hierarchy) {
+        result = hierarchy->query(start, goal);
     }
     
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -81,6 +143,36 @@ PerformanceMetrics PerformanceAnalyzer::measureSearchAlgorithm(const Graph& grap
     return metrics;
 }
 
+// Landmarks para el algoritmo "ALT"
+void PerformanceAnalyzer::setLandmarks(const Landmarks* landmarks) {
+    this->landmarks = landmarks;
+}
+
+// Jerarquía para el algoritmo "CH"
+void PerformanceAnalyzer::setContractionHierarchy(ContractionHierarchy* hierarchy) {
+    this->hierarchy = hierarchy;
+}
+
+// Medir preprocesamiento ALT
+PerformanceMetrics PerformanceAnalyzer::measureLandmarkPreprocessing(const Graph& graph, Landmarks& landmarks,
+                                                                     int landmark_count, LandmarkSelection selection) {
+    PerformanceMetrics metrics;
+    metrics.algorithm_name = std::string("ALT Preprocessing (") +
+                             (selection == LANDMARKS_AVOID ? "avoid" : "farthest") +
+                             ", k=" + std::to_string(landmark_count) + ")";
+    metrics.graph_size = graph.getNodeCount();
+    
+    landmarks.build(graph, landmark_count, selection);
+    
+    metrics.construction_time = std::chrono::milliseconds(static_cast<long long>(landmarks.getPreprocessingTime()));
+    metrics.memory_used_mb = landmarks.getMemoryUsage() / (1024 * 1024);
+    
+    std::cout << metrics.algorithm_name << ": " << landmarks.getPreprocessingTime() << " ms, "
+              << landmarks.getMemoryUsage() / 1024 << " KB" << std::endl;
+    
+    return metrics;
+}
+
 // Ejecutar suite completa de pruebas
 void PerformanceAnalyzer::runComprehensiveTest(const Graph& graph, int num_test_pairs) {
     std::cout << "\n=== Suite Completa de Pruebas de Rendimiento ===" << std::endl;
@@ -133,6 +225,8 @@ void PerformanceAnalyzer::compareAlgorithmsLargeGraph(const Graph& graph, int st
     algorithms.push_back("BFS");      // Más eficiente para grafos grandes
     algorithms.push_back("Dijkstra"); // Óptimo para caminos más cortos
     algorithms.push_back("A*");       // Más eficiente con heurística
+    algorithms.push_back("Bidirectional Dijkstra");
+    algorithms.push_back("Bidirectional A*");
     
     std::cout << "\nAlgoritmo\t\tTiempo(ms)\tNodos\t\tDistancia\tMemoria(MB)" << std::endl;
     std::cout << "------------------------------------------------------------------------" << std::endl;
@@ -238,12 +332,350 @@ size_t PerformanceAnalyzer::estimateMemoryUsage(const Graph& graph) {
     memory += graph.getEdgeCount() * sizeof(Edge);
     
     // Memoria de listas de adyacencia (aproximada)
-    memory += graph.getNodeCount() * sizeof(LinkedList<Edge>);
+    memory += graph.getNodeCount() * sizeof(EdgeList);
     
     // Convertir a MB
     return memory / (1024 * 1024);
 }
 
+// Benchmark: costo de búsqueda de nodos por ID a distintos tamaños de grafo
+void PerformanceAnalyzer::benchmarkNodeLookup(const DynamicArray<int>& graph_sizes, int num_lookups) {
+    std::cout << "\n=== Benchmark de Búsqueda de Nodos por ID ===" << std::endl;
+    std::cout << "Búsquedas por tamaño: " << num_lookups << std::endl;
+    std::cout << "\nNodos\t\tConstrucción(ms)\tgetNode(ns/op)\thasNode(ns/op)" << std::endl;
+    std::cout << "------------------------------------------------------------------------" << std::endl;
+    
+    std::srand(12345);
+    
+    for (int s = 0; s < graph_sizes.getSize(); s++) {
+        int num_nodes = graph_sizes[s];
+        Graph graph;
+        
+        auto build_start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < num_nodes; i++) {
+            graph.addNode(Node(i, "", i % 1000, i / 1000));
+        }
+        auto build_end = std::chrono::high_resolution_clock::now();
+        
+        // IDs de consulta pregenerados para no medir std::rand
+        DynamicArray<int> queries(num_lookups);
+        for (int i = 0; i < num_lookups; i++) {
+            queries.push_back(static_cast<int>((double(std::rand()) / (RAND_MAX + 1.0)) * num_nodes));
+        }
+        
+        // Acumular un checksum evita que el compilador elimine las búsquedas
+        long long checksum = 0;
+        
+        auto get_start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < num_lookups; i++) {
+            const Node* node = graph.getNode(queries[i]);
+            if (node) checksum += node->getId();
+        }
+        auto get_end = std::chrono::high_resolution_clock::now();
+        
+        auto has_start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < num_lookups; i++) {
+            if (graph.hasNode(queries[i] + num_nodes / 2)) checksum++;
+        }
+        auto has_end = std::chrono::high_resolution_clock::now();
+        
+        double build_ms = std::chrono::duration<double, std::milli>(build_end - build_start).count();
+        double get_ns = std::chrono::duration<double, std::nano>(get_end - get_start).count() / num_lookups;
+        double has_ns = std::chrono::duration<double, std::nano>(has_end - has_start).count() / num_lookups;
+        
+        std::cout << num_nodes << "\t\t" << build_ms << "\t\t\t" << get_ns << "\t\t" << has_ns
+                  << (checksum == -1 ? " " : "") << std::endl;
+    }
+}
+
+// Benchmark: memoria y tiempo de búsqueda de Graph vs CompactGraph (CSR)
+void PerformanceAnalyzer::benchmarkCompactGraph(int grid_side) {
+    std::cout << "\n=== Benchmark Graph vs CompactGraph (CSR) ===" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+    
+    auto freeze_start = std::chrono::high_resolution_clock::now();
+    CompactGraph compact(graph);
+    auto freeze_end = std::chrono::high_resolution_clock::now();
+    
+    // Memoria por arista: Edge + puntero 'next' de la lista vs destino + peso del CSR
+    size_t list_bytes_per_edge = sizeof(Edge) + sizeof(Edge*);
+    size_t csr_bytes_per_edge = sizeof(int) + sizeof(double);
+    
+    std::cout << "Nodos: " << compact.getNodeCount() << ", aristas: " << compact.getEdgeCount() << std::endl;
+    std::cout << "Construcción del CSR: "
+              << std::chrono::duration<double, std::milli>(freeze_end - freeze_start).count() << " ms" << std::endl;
+    std::cout << "Bytes por arista (listas de adyacencia): >= " << list_bytes_per_edge
+              << " (sin contar cabecera de malloc)" << std::endl;
+    std::cout << "Bytes por arista (CSR): " << csr_bytes_per_edge << std::endl;
+    std::cout << "Memoria total del CSR: " << formatMemory(compact.getMemoryUsage() / (1024 * 1024)) << std::endl;
+    
+    int start = 0;
+    int goal = compact.getNodeCount() - 1;
+    
+    SearchAlgorithms list_search(&graph);
+    SearchAlgorithms csr_search(&compact);
+    
+    std::cout << "\nAlgoritmo\tGraph(ms)\tCSR(ms)\t\tNodos" << std::endl;
+    std::cout << "--------------------------------------------------------" << std::endl;
+    
+    SearchResult list_bfs = list_search.breadthFirstSearch(start, goal);
+    SearchResult csr_bfs = csr_search.breadthFirstSearch(start, goal);
+    std::cout << "BFS\t\t" << list_bfs.time_taken.count() << "\t\t" << csr_bfs.time_taken.count()
+              << "\t\t" << csr_bfs.nodes_explored << std::endl;
+    
+    SearchResult list_dfs = list_search.depthFirstSearch(start, goal);
+    SearchResult csr_dfs = csr_search.depthFirstSearch(start, goal);
+    std::cout << "DFS\t\t" << list_dfs.time_taken.count() << "\t\t" << csr_dfs.time_taken.count()
+              << "\t\t" << csr_dfs.nodes_explored << std::endl;
+    
+    SearchResult list_astar = list_search.aStar(start, goal);
+    SearchResult csr_astar = csr_search.aStar(start, goal);
+    std::cout << "A*\t\t" << list_astar.time_taken.count() << "\t\t" << csr_astar.time_taken.count()
+              << "\t\t" << csr_astar.nodes_explored << std::endl;
+}
+
+// Benchmark: Dijkstra uno-a-todos con heap indexado de aridad 2, 4 y 8
+void PerformanceAnalyzer::benchmarkHeapArity(int grid_side, int city_nodes, int repetitions) {
+    std::cout << "\n=== Benchmark de Aridad del Heap Indexado ===" << std::endl;
+    
+    Graph grid_graph;
+    LargeGraphGenerator::generateGridGraph(grid_graph, grid_side, grid_side);
+    Graph city_graph;
+    LargeGraphGenerator::generateCityLikeGraph(city_graph, city_nodes, 10);
+    
+    CompactGraph graphs[2] = {CompactGraph(grid_graph), CompactGraph(city_graph)};
+    const char* names[2] = {"Cuadrícula", "Ciudad"};
+    
+    std::cout << "\nGrafo\t\tAridad\tTiempo promedio(ms)\tNodos asentados" << std::endl;
+    std::cout << "------------------------------------------------------------------" << std::endl;
+    
+    for (int g = 0; g < 2; g++) {
+        const CompactGraph& graph = graphs[g];
+        if (graph.getNodeCount() == 0) continue;
+        
+        double times[3] = {0.0, 0.0, 0.0};
+        int settled[3] = {0, 0, 0};
+        
+        // Alternar aridades en cada repetición para repartir efectos de caché
+        for (int r = 0; r < repetitions; r++) {
+            int source = (r * 7919) % graph.getNodeCount();
+            times[0] += timeIndexedDijkstra<2>(graph, source, settled[0]);
+            times[1] += timeIndexedDijkstra<4>(graph, source, settled[1]);
+            times[2] += timeIndexedDijkstra<8>(graph, source, settled[2]);
+        }
+        
+        const int arities[3] = {2, 4, 8};
+        for (int a = 0; a < 3; a++) {
+            std::cout << names[g] << "\t" << arities[a] << "\t" << (times[a] / repetitions)
+                      << "\t\t\t" << settled[a] << std::endl;
+        }
+    }
+}
+
+// Benchmark: muchas consultas cortas con workspace nuevo vs reutilizado
+void PerformanceAnalyzer::benchmarkWorkspaceReuse(int grid_side, int num_queries) {
+    std::cout << "\n=== Benchmark de Reutilización de SearchWorkspace ===" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+    CompactGraph compact(graph);
+    int n = compact.getNodeCount();
+    if (n == 0) return;
+    
+    // Consultas locales: el destino está a pocas cuadras del origen, por lo
+    // que el costo de inicializar O(V) domina cuando no se reutiliza nada
+    DynamicArray<int> starts(num_queries);
+    DynamicArray<int> goals(num_queries);
+    std::srand(42);
+    for (int q = 0; q < num_queries; q++) {
+        int x = std::rand() % (grid_side - 10);
+        int y = std::rand() % (grid_side - 10);
+        starts.push_back(compact.getNodeId(y * grid_side + x));
+        goals.push_back(compact.getNodeId((y + 5) * grid_side + x + 5));
+    }
+    
+    std::cout << "Nodos: " << n << ", consultas: " << num_queries << std::endl;
+    std::cout << "\nAlgoritmo\tNuevo(ms)\tReutilizado(ms)\tAceleración" << std::endl;
+    std::cout << "------------------------------------------------------------" << std::endl;
+    
+    const char* names[2] = {"Dijkstra", "A*"};
+    for (int a = 0; a < 2; a++) {
+        long long checksum_fresh = 0, checksum_reused = 0;
+        
+        auto fresh_start = std::chrono::high_resolution_clock::now();
+        for (int q = 0; q < num_queries; q++) {
+            SearchWorkspace fresh;
+            SearchAlgorithms search(&compact);
+            SearchResult r = a == 0 ? search.dijkstra(starts[q], goals[q], fresh)
+                                    : search.aStar(starts[q], goals[q], fresh);
+            checksum_fresh += r.nodes_explored;
+        }
+        auto fresh_end = std::chrono::high_resolution_clock::now();
+        
+        SearchWorkspace shared(n);
+        SearchAlgorithms search(&compact);
+        auto reused_start = std::chrono::high_resolution_clock::now();
+        for (int q = 0; q < num_queries; q++) {
+            SearchResult r = a == 0 ? search.dijkstra(starts[q], goals[q], shared)
+                                    : search.aStar(starts[q], goals[q], shared);
+            checksum_reused += r.nodes_explored;
+        }
+        auto reused_end = std::chrono::high_resolution_clock::now();
+        
+        double fresh_ms = std::chrono::duration<double, std::milli>(fresh_end - fresh_start).count();
+        double reused_ms = std::chrono::duration<double, std::milli>(reused_end - reused_start).count();
+        std::cout << names[a] << "\t\t" << fresh_ms << "\t\t" << reused_ms << "\t\t"
+                  << (reused_ms > 0.0 ? fresh_ms / reused_ms : 0.0) << "x" << std::endl;
+        
+        if (checksum_fresh != checksum_reused) {
+            std::cout << "ADVERTENCIA: resultados distintos entre ambas variantes" << std::endl;
+        }
+    }
+}
+
+// Benchmark: A* euclidiano vs ALT con distinto número de landmarks
+void PerformanceAnalyzer::benchmarkLandmarks(int city_nodes, int num_queries) {
+    std::cout << "\n=== Benchmark ALT (Landmarks) ===" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateCityLikeGraph(graph, city_nodes, 10);
+    CompactGraph compact(graph);
+    int n = compact.getNodeCount();
+    if (n == 0) return;
+    
+    // Pares alcanzables: el destino es el último nodo que alcanza un BFS desde
+    // el origen (el más lejano en saltos dentro de su componente)
+    DynamicArray<int> starts(num_queries);
+    DynamicArray<int> goals(num_queries);
+    SearchAlgorithms search(&compact);
+    std::srand(7);
+    for (int q = 0; q < num_queries; q++) {
+        int start = std::rand() % n;
+        int farthest = start;
+        DynamicArray<int> queue;
+        DynamicArray<bool> seen(n);
+        for (int i = 0; i < n; i++) seen.push_back(false);
+        queue.push_back(start);
+        seen[start] = true;
+        for (int head = 0; head < queue.getSize(); head++) {
+            int u = queue[head];
+            farthest = u;
+            for (int e = compact.edgesBegin(u); e < compact.edgesEnd(u); e++) {
+                if (!seen[compact.getTarget(e)]) {
+                    seen[compact.getTarget(e)] = true;
+                    queue.push_back(compact.getTarget(e));
+                }
+            }
+        }
+        starts.push_back(compact.getNodeId(start));
+        goals.push_back(compact.getNodeId(farthest));
+    }
+    
+    std::cout << "Nodos: " << n << ", aristas: " << compact.getEdgeCount()
+              << ", consultas: " << num_queries << std::endl;
+    std::cout << "\nAlgoritmo\t\tPrep(ms)\tMemoria(KB)\tTiempo(ms)\tNodos promedio" << std::endl;
+    std::cout << "------------------------------------------------------------------------------" << std::endl;
+    
+    long long astar_nodes = 0;
+    auto astar_start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < num_queries; q++) {
+        astar_nodes += search.aStar(starts[q], goals[q]).nodes_explored;
+    }
+    auto astar_end = std::chrono::high_resolution_clock::now();
+    std::cout << "A* euclidiano\t\t-\t\t-\t\t"
+              << std::chrono::duration<double, std::milli>(astar_end - astar_start).count() << "\t\t"
+              << astar_nodes / num_queries << std::endl;
+    
+    const int counts[3] = {4, 8, 16};
+    for (int c = 0; c < 3; c++) {
+        for (int s = 0; s < 2; s++) {
+            LandmarkSelection selection = s == 0 ? LANDMARKS_FARTHEST : LANDMARKS_AVOID;
+            Landmarks landmarks;
+            landmarks.build(compact, counts[c], selection);
+            search.setLandmarks(&landmarks);
+            
+            long long alt_nodes = 0;
+            auto alt_start = std::chrono::high_resolution_clock::now();
+            for (int q = 0; q < num_queries; q++) {
+                alt_nodes += search.altSearch(starts[q], goals[q]).nodes_explored;
+            }
+            auto alt_end = std::chrono::high_resolution_clock::now();
+            
+            std::cout << "ALT " << (s == 0 ? "farthest" : "avoid") << " k=" << counts[c] << "\t"
+                      << landmarks.getPreprocessingTime() << "\t\t" << landmarks.getMemoryUsage() / 1024
+                      << "\t\t" << std::chrono::duration<double, std::milli>(alt_end - alt_start).count()
+                      << "\t\t" << alt_nodes / num_queries << std::endl;
+        }
+    }
+    search.setLandmarks(nullptr);
+}
+
+// Benchmark: preprocesamiento CH y tiempo por consulta vs Dijkstra y A*
+void PerformanceAnalyzer::benchmarkContractionHierarchy(int grid_side, int num_queries) {
+    std::cout << "\n=== Benchmark Contraction Hierarchies ===" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+    CompactGraph compact(graph);
+    int n = compact.getNodeCount();
+    if (n == 0) return;
+    
+    ContractionHierarchy hierarchy;
+    hierarchy.build(compact);
+    
+    std::cout << "Nodos: " << n << ", aristas originales: " << compact.getEdgeCount() << std::endl;
+    std::cout << "Preprocesamiento: " << hierarchy.getPreprocessingTime() << " ms" << std::endl;
+    std::cout << "Aristas en la jerarquía: " << hierarchy.getEdgeCount()
+              << " (atajos: " << hierarchy.getShortcutCount() << ")" << std::endl;
+    std::cout << "Memoria de la jerarquía: " << hierarchy.getMemoryUsage() / 1024 << " KB" << std::endl;
+    
+    DynamicArray<int> starts(num_queries);
+    DynamicArray<int> goals(num_queries);
+    std::srand(11);
+    for (int q = 0; q < num_queries; q++) {
+        starts.push_back(compact.getNodeId(std::rand() % n));
+        goals.push_back(compact.getNodeId(std::rand() % n));
+    }
+    
+    SearchAlgorithms search(&compact);
+    double times[3] = {0.0, 0.0, 0.0};
+    long long nodes[3] = {0, 0, 0};
+    int mismatches = 0;
+    
+    for (int q = 0; q < num_queries; q++) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        SearchResult dijkstra_result = search.dijkstra(starts[q], goals[q]);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        SearchResult astar_result = search.aStar(starts[q], goals[q]);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        SearchResult ch_result = hierarchy.query(starts[q], goals[q]);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        
+        times[0] += std::chrono::duration<double, std::micro>(t1 - t0).count();
+        times[1] += std::chrono::duration<double, std::micro>(t2 - t1).count();
+        times[2] += std::chrono::duration<double, std::micro>(t3 - t2).count();
+        nodes[0] += dijkstra_result.nodes_explored;
+        nodes[1] += astar_result.nodes_explored;
+        nodes[2] += ch_result.nodes_explored;
+        
+        if (std::abs(dijkstra_result.total_distance - ch_result.total_distance) > 1e-6) {
+            mismatches++;
+        }
+    }
+    
+    const char* names[3] = {"Dijkstra", "A*", "CH"};
+    std::cout << "\nAlgoritmo\tTiempo promedio(us)\tNodos promedio" << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl;
+    for (int a = 0; a < 3; a++) {
+        std::cout << names[a] << "\t\t" << times[a] / num_queries << "\t\t\t" << nodes[a] / num_queries << std::endl;
+    }
+    if (mismatches > 0) {
+        std::cout << "ADVERTENCIA: " << mismatches << " consultas con distancia distinta a Dijkstra" << std::endl;
+    }
+}
+
 // Limpiar resultados
 void PerformanceAnalyzer::clearResults() {
     results.clear();
@@ -272,3 +704,1101 @@ std::string PerformanceAnalyzer::formatMemory(size_t memory_mb) {
     return std::to_string(memory_mb) + " MB";
 }
 
+// Benchmark: arranque con el binario clásico vs CSR proyectado en memoria
+void PerformanceAnalyzer::benchmarkMappedGraph(int grid_side, int num_queries) {
+    std::cout << "\n=== Benchmark de Carga: Binario Clásico vs CSR Proyectado ===" << std::endl;
+    
+    std::string classic_file = "benchmark_graph.bin";
+    std::string mapped_file = "benchmark_graph.csr";
+    {
+        Graph graph;
+        LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+        LargeGraphGenerator::saveGraphToBinary(graph, classic_file);
+        CompactGraph(graph).saveToBinary(mapped_file);
+    }
+    
+    // Arranque clásico: parsear el archivo, reinsertar nodos y aristas y
+    // congelar el CSR para las búsquedas
+    auto classic_start = std::chrono::high_resolution_clock::now();
+    Graph loaded;
+    LargeGraphGenerator::loadGraphFromBinary(loaded, classic_file);
+    auto classic_loaded = std::chrono::high_resolution_clock::now();
+    CompactGraph built(loaded);
+    auto classic_end = std::chrono::high_resolution_clock::now();
+    
+    // Arranque proyectado: solo se valida la cabecera
+    auto mapped_start = std::chrono::high_resolution_clock::now();
+    CompactGraph mapped;
+    bool mapped_ok = mapped.mapFromBinary(mapped_file);
+    auto mapped_end = std::chrono::high_resolution_clock::now();
+    
+    if (!mapped_ok) {
+        std::cout << "No se pudo proyectar " << mapped_file << std::endl;
+        std::remove(classic_file.c_str());
+        std::remove(mapped_file.c_str());
+        return;
+    }
+    
+    std::cout << "Nodos: " << mapped.getNodeCount() << ", aristas: " << mapped.getEdgeCount() << std::endl;
+    std::cout << "Carga clásica (loadGraphFromBinary): "
+              << std::chrono::duration<double, std::milli>(classic_loaded - classic_start).count() << " ms" << std::endl;
+    std::cout << "  + construcción del CSR: "
+              << std::chrono::duration<double, std::milli>(classic_end - classic_loaded).count() << " ms" << std::endl;
+    std::cout << "Proyección (mapFromBinary): "
+              << std::chrono::duration<double, std::micro>(mapped_end - mapped_start).count() << " us" << std::endl;
+    
+    // Consultas cortas: la primera toca páginas aún no cargadas
+    SearchAlgorithms built_search(&built);
+    SearchAlgorithms mapped_search(&mapped);
+    double built_us = 0.0, mapped_us = 0.0, first_query_us = 0.0;
+    bool same = true;
+    std::srand(7);
+    for (int q = 0; q < num_queries; q++) {
+        int start = mapped.getNodeId(std::rand() % mapped.getNodeCount());
+        int goal = mapped.getNodeId(std::rand() % mapped.getNodeCount());
+        
+        auto t0 = std::chrono::high_resolution_clock::now();
+        SearchResult mapped_result = mapped_search.aStar(start, goal);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        SearchResult built_result = built_search.aStar(start, goal);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        
+        double query_us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+        if (q == 0) first_query_us = query_us;
+        mapped_us += query_us;
+        built_us += std::chrono::duration<double, std::micro>(t2 - t1).count();
+        same = same && mapped_result.path_found == built_result.path_found &&
+               std::abs(mapped_result.total_distance - built_result.total_distance) < 1e-9;
+    }
+    
+    std::cout << "Primera consulta A* sobre el archivo proyectado: " << first_query_us << " us" << std::endl;
+    std::cout << "A* promedio (" << num_queries << " consultas): CSR en memoria "
+              << built_us / num_queries << " us, proyectado " << mapped_us / num_queries << " us" << std::endl;
+    if (!same) {
+        std::cout << "ADVERTENCIA: resultados distintos entre CSR en memoria y proyectado" << std::endl;
+    }
+    
+    std::remove(classic_file.c_str());
+    std::remove(mapped_file.c_str());
+}
+
+// Benchmark: generación de grafos tipo ciudad y sintéticos con índice espacial
+void PerformanceAnalyzer::benchmarkSpatialGeneration(const DynamicArray<int>& graph_sizes) {
+    std::cout << "\n=== Benchmark de Generación con Índice Espacial ===" << std::endl;
+    
+    DynamicArray<std::string> rows;
+    for (int s = 0; s < graph_sizes.getSize(); s++) {
+        int num_nodes = graph_sizes[s];
+        std::ostringstream row;
+        row << num_nodes;
+        
+        {
+            Graph city;
+            auto start = std::chrono::high_resolution_clock::now();
+            LargeGraphGenerator::generateCityLikeGraph(city, num_nodes, 10);
+            auto end = std::chrono::high_resolution_clock::now();
+            row << "\t\t" << std::chrono::duration<double, std::milli>(end - start).count()
+                << "\t\t" << city.getEdgeCount();
+        }
+        {
+            Graph synthetic;
+            auto start = std::chrono::high_resolution_clock::now();
+            MapLoader::generateSyntheticMap(synthetic, num_nodes, 1000.0, 1000.0);
+            auto end = std::chrono::high_resolution_clock::now();
+            row << "\t\t" << std::chrono::duration<double, std::milli>(end - start).count()
+                << "\t\t" << synthetic.getEdgeCount();
+        }
+        rows.push_back(row.str());
+    }
+    
+    std::cout << "\nNodos\t\tCiudad(ms)\tAristas\t\tSintético(ms)\tAristas" << std::endl;
+    std::cout << "------------------------------------------------------------------------" << std::endl;
+    for (int r = 0; r < rows.getSize(); r++) {
+        std::cout << rows[r] << std::endl;
+    }
+}
+
+// Benchmark: nodo más cercano a una coordenada, recorrido lineal vs k-d tree
+void PerformanceAnalyzer::benchmarkNearestNode(int num_nodes, int num_queries) {
+    std::cout << "\n=== Benchmark de Búsqueda por Coordenadas: Lineal vs k-d tree ===" << std::endl;
+    
+    Graph graph;
+    std::srand(11);
+    for (int i = 0; i < num_nodes; i++) {
+        double x = std::rand() % 10000 + (std::rand() % 1000) / 1000.0;
+        double y = std::rand() % 10000 + (std::rand() % 1000) / 1000.0;
+        graph.addNode(Node(i, "", x, y));
+    }
+    const DynamicArray<Node>& nodes = graph.getAllNodes();
+    
+    auto build_start = std::chrono::high_resolution_clock::now();
+    graph.buildSpatialIndex();
+    auto build_end = std::chrono::high_resolution_clock::now();
+    
+    DynamicArray<double> query_x(num_queries);
+    DynamicArray<double> query_y(num_queries);
+    for (int q = 0; q < num_queries; q++) {
+        query_x.push_back(std::rand() % 10000 + (std::rand() % 1000) / 1000.0);
+        query_y.push_back(std::rand() % 10000 + (std::rand() % 1000) / 1000.0);
+    }
+    
+    // El recorrido lineal es O(n) por consulta: se mide sobre pocas
+    int linear_queries = num_queries < 100 ? num_queries : 100;
+    DynamicArray<int> linear_best(linear_queries);
+    auto linear_start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < linear_queries; q++) {
+        int best = -1;
+        double best_distance = 0.0;
+        for (int i = 0; i < nodes.getSize(); i++) {
+            double dx = nodes[i].getX() - query_x[q];
+            double dy = nodes[i].getY() - query_y[q];
+            double distance = dx * dx + dy * dy;
+            if (best == -1 || distance < best_distance) {
+                best = i;
+                best_distance = distance;
+            }
+        }
+        linear_best.push_back(nodes[best].getId());
+    }
+    auto linear_end = std::chrono::high_resolution_clock::now();
+    
+    long long checksum = 0;
+    auto tree_start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < num_queries; q++) {
+        checksum += graph.findNearestNode(query_x[q], query_y[q]);
+    }
+    auto tree_end = std::chrono::high_resolution_clock::now();
+    
+    bool same = true;
+    for (int q = 0; q < linear_queries; q++) {
+        same = same && graph.findNearestNode(query_x[q], query_y[q]) == linear_best[q];
+    }
+    
+    DynamicArray<int> node_ids;
+    long long found = 0;
+    auto k_start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < num_queries; q++) {
+        found += graph.findNearestNodes(query_x[q], query_y[q], 10, node_ids);
+    }
+    auto k_end = std::chrono::high_resolution_clock::now();
+    
+    auto radius_start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < num_queries; q++) {
+        found += graph.findNodesInRadius(query_x[q], query_y[q], 10.0, node_ids);
+    }
+    auto radius_end = std::chrono::high_resolution_clock::now();
+    
+    double linear_us = std::chrono::duration<double, std::micro>(linear_end - linear_start).count() / linear_queries;
+    double tree_us = std::chrono::duration<double, std::micro>(tree_end - tree_start).count() / num_queries;
+    
+    std::cout << "Nodos: " << graph.getNodeCount() << ", consultas: " << num_queries << std::endl;
+    std::cout << "Construcción del k-d tree: "
+              << std::chrono::duration<double, std::milli>(build_end - build_start).count() << " ms" << std::endl;
+    std::cout << "\nConsulta			Tiempo por consulta (us)" << std::endl;
+    std::cout << "--------------------------------------------------------" << std::endl;
+    std::cout << "Más cercano (lineal)		" << linear_us << std::endl;
+    std::cout << "Más cercano (k-d tree)		" << tree_us << std::endl;
+    std::cout << "10 más cercanos (k-d tree)	"
+              << std::chrono::duration<double, std::micro>(k_end - k_start).count() / num_queries << std::endl;
+    std::cout << "Radio 10 (k-d tree)		"
+              << std::chrono::duration<double, std::micro>(radius_end - radius_start).count() / num_queries << std::endl;
+    std::cout << "Aceleración: " << linear_us / tree_us << "x (suma de control " << checksum << ", "
+              << found << " resultados)" << std::endl;
+    if (!same) {
+        std::cout << "ADVERTENCIA: el k-d tree y el recorrido lineal difieren" << std::endl;
+    }
+}
+
+// Benchmark: carga CSV con el cargador anterior vs el tokenizador sobre memoria
+void PerformanceAnalyzer::benchmarkCSVLoading(int grid_side) {
+    std::cout << "\n=== Benchmark de Carga CSV: Anterior vs Tokenizador sobre Memoria ===" << std::endl;
+    
+    std::string nodes_file = "benchmark_nodes.csv";
+    std::string edges_file = "benchmark_edges.csv";
+    {
+        Graph graph;
+        LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+        MapLoader::saveToCSV(graph, nodes_file, edges_file);
+    }
+    
+    Graph fast;
+    CSVLoadReport report;
+    auto fast_start = std::chrono::high_resolution_clock::now();
+    bool fast_ok = MapLoader::loadFromCSV(fast, nodes_file, edges_file, &report);
+    auto fast_end = std::chrono::high_resolution_clock::now();
+    
+    Graph legacy;
+    auto legacy_start = std::chrono::high_resolution_clock::now();
+    bool legacy_ok = MapLoader::loadFromCSVLegacy(legacy, nodes_file, edges_file);
+    auto legacy_end = std::chrono::high_resolution_clock::now();
+    
+    double fast_ms = std::chrono::duration<double, std::milli>(fast_end - fast_start).count();
+    double legacy_ms = std::chrono::duration<double, std::milli>(legacy_end - legacy_start).count();
+    
+    std::cout << "Nodos: " << fast.getNodeCount() << ", aristas: " << fast.getEdgeCount() << std::endl;
+    std::cout << "Cargador anterior (stringstream + stoi/stod): " << legacy_ms << " ms" << std::endl;
+    std::cout << "Tokenizador sobre archivo proyectado: " << fast_ms << " ms" << std::endl;
+    std::cout << "Aceleración: " << legacy_ms / fast_ms << "x" << std::endl;
+    if (!fast_ok || !legacy_ok || report.malformed_rows != 0 ||
+        fast.getNodeCount() != legacy.getNodeCount() || fast.getEdgeCount() != legacy.getEdgeCount()) {
+        std::cout << "ADVERTENCIA: los dos cargadores no producen el mismo grafo" << std::endl;
+    }
+    
+    std::remove(nodes_file.c_str());
+    std::remove(edges_file.c_str());
+}
+
+void PerformanceAnalyzer::benchmarkParallelCSVLoading(int grid_side) {
+    std::cout << "\n=== Benchmark de Carga CSV Paralela: Escalado por Hilos ===" << std::endl;
+    
+    std::string nodes_file = "benchmark_nodes.csv";
+    std::string edges_file = "benchmark_edges.csv";
+    {
+        Graph graph;
+        LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+        MapLoader::saveToCSV(graph, nodes_file, edges_file);
+    }
+    
+    Graph sequential;
+    auto sequential_start = std::chrono::high_resolution_clock::now();
+    MapLoader::loadFromCSV(sequential, nodes_file, edges_file);
+    auto sequential_end = std::chrono::high_resolution_clock::now();
+    double sequential_ms = std::chrono::duration<double, std::milli>(sequential_end - sequential_start).count();
+    
+    std::cout << "Nodos: " << sequential.getNodeCount() << ", aristas: " << sequential.getEdgeCount()
+              << ", núcleos disponibles: " << defaultThreadCount() << std::endl;
+    std::cout << "Carga secuencial (loadFromCSV): " << sequential_ms << " ms" << std::endl;
+    
+    // Entrada de buildFromEdgeList ya parseada, para medir la construcción
+    // del CSR por separado del parseo
+    int n = sequential.getNodeCount();
+    DynamicArray<int> ids(n), name_offsets(n + 1);
+    DynamicArray<double> xs(n), ys(n);
+    DynamicArray<char> name_chars;
+    DynamicArray<int> sources(sequential.getEdgeCount()), destinations(sequential.getEdgeCount());
+    DynamicArray<double> weights(sequential.getEdgeCount());
+    name_offsets.push_back(0);
+    for (int i = 0; i < n; i++) {
+        const Node& node = sequential.getNodeAt(i);
+        ids.push_back(node.getId());
+        xs.push_back(node.getX());
+        ys.push_back(node.getY());
+        std::string name = node.getName();
+        for (size_t c = 0; c < name.size(); c++) {
+            name_chars.push_back(name[c]);
+        }
+        name_offsets.push_back(name_chars.getSize());
+        const EdgeList& edges = sequential.getAdjacenciesAt(i);
+        for (auto it = edges.begin(); it != edges.end(); ++it) {
+            sources.push_back(i);
+            destinations.push_back((*it).getDestinationIndex());
+            weights.push_back((*it).getWeight());
+        }
+    }
+    
+    std::cout << "\nHilos\tGraph (ms)\tAceleración\tCSR directo (ms)\tAceleración\tConstrucción CSR (ms)\tAceleración" << std::endl;
+    std::cout << "--------------------------------------------------------------------------------------------------------------" << std::endl;
+    
+    const int thread_counts[] = {1, 2, 4, 8, 16};
+    double graph_base_ms = 0.0;
+    double compact_base_ms = 0.0;
+    double build_base_ms = 0.0;
+    bool consistent = true;
+    for (int t = 0; t < 5; t++) {
+        Graph graph;
+        auto graph_start = std::chrono::high_resolution_clock::now();
+        MapLoader::loadFromCSVParallel(graph, nodes_file, edges_file, thread_counts[t]);
+        auto graph_end = std::chrono::high_resolution_clock::now();
+        
+        CompactGraph compact;
+        auto compact_start = std::chrono::high_resolution_clock::now();
+        MapLoader::loadCompactFromCSV(compact, nodes_file, edges_file, thread_counts[t]);
+        auto compact_end = std::chrono::high_resolution_clock::now();
+        
+        CompactGraph built;
+        auto build_start = std::chrono::high_resolution_clock::now();
+        built.buildFromEdgeList(ids, xs, ys, name_offsets, name_chars, sources, destinations, weights,
+                                thread_counts[t]);
+        auto build_end = std::chrono::high_resolution_clock::now();
+        
+        double graph_ms = std::chrono::duration<double, std::milli>(graph_end - graph_start).count();
+        double compact_ms = std::chrono::duration<double, std::milli>(compact_end - compact_start).count();
+        double build_ms = std::chrono::duration<double, std::milli>(build_end - build_start).count();
+        if (t == 0) {
+            graph_base_ms = graph_ms;
+            compact_base_ms = compact_ms;
+            build_base_ms = build_ms;
+        }
+        consistent = consistent && graph.getNodeCount() == sequential.getNodeCount() &&
+                     graph.getEdgeCount() == sequential.getEdgeCount() &&
+                     compact.getEdgeCount() == sequential.getEdgeCount() &&
+                     built.getEdgeCount() == sequential.getEdgeCount();
+        
+        std::cout << thread_counts[t] << "\t" << graph_ms << "\t\t" << graph_base_ms / graph_ms << "x\t\t"
+                  << compact_ms << "\t\t\t" << compact_base_ms / compact_ms << "x\t\t"
+                  << build_ms << "\t\t\t" << build_base_ms / build_ms << "x" << std::endl;
+    }
+    if (!consistent) {
+        std::cout << "ADVERTENCIA: la carga paralela no produce el mismo grafo" << std::endl;
+    }
+    
+    std::remove(nodes_file.c_str());
+    std::remove(edges_file.c_str());
+}
+
+void PerformanceAnalyzer::benchmarkDistanceMatrix(int city_nodes, int side) {
+    std::cout << "\n=== Benchmark de Matriz de Distancias ===" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateCityLikeGraph(graph, city_nodes, 10);
+    CompactGraph compact(graph);
+    int n = compact.getNodeCount();
+    if (n == 0 || side <= 0) return;
+    
+    DynamicArray<int> sources(side);
+    DynamicArray<int> targets(side);
+    std::srand(42);
+    for (int i = 0; i < side; i++) {
+        sources.push_back(compact.getNodeId(std::rand() % n));
+        targets.push_back(compact.getNodeId(std::rand() % n));
+    }
+    double cells = static_cast<double>(side) * side;
+    
+    // Dijkstra por par: se mide un subconjunto de filas y se extrapola
+    int sample_rows = side < 5 ? side : 5;
+    SearchAlgorithms pairwise(&compact);
+    double pair_checksum = 0.0;
+    auto pair_start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < sample_rows; i++) {
+        for (int j = 0; j < side; j++) {
+            pair_checksum += pairwise.dijkstra(sources[i], targets[j]).total_distance;
+        }
+    }
+    auto pair_end = std::chrono::high_resolution_clock::now();
+    double pair_ms = std::chrono::duration<double, std::milli>(pair_end - pair_start).count() * side / sample_rows;
+    
+    std::cout << "Nodos: " << n << ", matriz: " << side << " x " << side
+              << ", núcleos disponibles: " << defaultThreadCount() << std::endl;
+    std::cout << "\nMétodo\t\t\t\tTiempo (ms)\tCeldas/s" << std::endl;
+    std::cout << "------------------------------------------------------------" << std::endl;
+    std::cout << "Dijkstra por par (estimado)\t" << pair_ms << "\t\t" << cells / (pair_ms / 1000.0) << std::endl;
+    
+    SearchAlgorithms batch(&compact);
+    int thread_counts[2] = {1, defaultThreadCount()};
+    DistanceMatrix reference;
+    for (int t = 0; t < 2; t++) {
+        if (t == 1 && thread_counts[1] == 1) break;
+        auto batch_start = std::chrono::high_resolution_clock::now();
+        DistanceMatrix matrix = batch.distanceMatrix(sources, targets, thread_counts[t]);
+        auto batch_end = std::chrono::high_resolution_clock::now();
+        double batch_ms = std::chrono::duration<double, std::milli>(batch_end - batch_start).count();
+        std::cout << "Uno-a-muchos, " << thread_counts[t] << " hilo(s)\t\t" << batch_ms << "\t\t"
+                  << cells / (batch_ms / 1000.0) << std::endl;
+        
+        if (t == 0) {
+            reference = matrix;
+            double batch_checksum = 0.0;
+            for (int i = 0; i < sample_rows; i++) {
+                for (int j = 0; j < side; j++) {
+                    if (matrix.at(i, j) != std::numeric_limits<double>::infinity()) {
+                        batch_checksum += matrix.at(i, j);
+                    }
+                }
+            }
+            if (std::abs(batch_checksum - pair_checksum) > 1e-6 * (1.0 + pair_checksum)) {
+                std::cout << "ADVERTENCIA: la matriz no coincide con Dijkstra por par" << std::endl;
+            }
+        } else {
+            for (int c = 0; c < matrix.distances.getSize(); c++) {
+                if (matrix.distances[c] != reference.distances[c]) {
+                    std::cout << "ADVERTENCIA: el resultado depende del número de hilos" << std::endl;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void PerformanceAnalyzer::benchmarkQueryExecutor(int city_nodes, int num_queries) {
+    std::cout << "\n=== Benchmark de QueryExecutor: Consultas por Segundo ===" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateCityLikeGraph(graph, city_nodes, 10);
+    CompactGraph compact(graph);
+    int n = compact.getNodeCount();
+    if (n == 0) return;
+    
+    DynamicArray<RouteQuery> queries(num_queries);
+    std::srand(42);
+    for (int q = 0; q < num_queries; q++) {
+        queries.push_back(RouteQuery(compact.getNodeId(std::rand() % n), compact.getNodeId(std::rand() % n),
+                                     q % 2 == 0 ? QUERY_DIJKSTRA : QUERY_ASTAR));
+    }
+    
+    std::cout << "Nodos: " << n << ", consultas: " << num_queries
+              << ", núcleos disponibles: " << defaultThreadCount() << std::endl;
+    std::cout << "\nHilos\tTiempo (ms)\tConsultas/s\tAceleración" << std::endl;
+    std::cout << "------------------------------------------------------------" << std::endl;
+    
+    const int thread_counts[] = {1, 2, 4, 8, 16};
+    double base_ms = 0.0;
+    double base_checksum = 0.0;
+    for (int t = 0; t < 5; t++) {
+        QueryExecutor executor(&compact, thread_counts[t]);
+        DynamicArray<SearchResult> results;
+        auto run_start = std::chrono::high_resolution_clock::now();
+        executor.run(queries, results);
+        auto run_end = std::chrono::high_resolution_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(run_end - run_start).count();
+        
+        double checksum = 0.0;
+        for (int q = 0; q < results.getSize(); q++) {
+            checksum += results[q].total_distance;
+        }
+        if (t == 0) {
+            base_ms = ms;
+            base_checksum = checksum;
+        } else if (checksum != base_checksum) {
+            std::cout << "ADVERTENCIA: resultados distintos con " << thread_counts[t] << " hilos" << std::endl;
+        }
+        std::cout << thread_counts[t] << "\t" << ms << "\t\t" << num_queries / (ms / 1000.0) << "\t\t"
+                  << base_ms / ms << "x" << std::endl;
+    }
+}
+
+void PerformanceAnalyzer::benchmarkDeltaStepping(int grid_side, int random_nodes, int city_nodes) {
+    std::cout << "\n=== Benchmark de Delta-Stepping (SSSP uno-a-todos) ===" << std::endl;
+    
+    CompactGraph graphs[3];
+    {
+        Graph graph;
+        LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+        graphs[0].build(graph);
+    }
+    {
+        // Grado promedio ~10 independientemente del tamaño
+        Graph graph;
+        LargeGraphGenerator::generateRandomGraph(graph, random_nodes, 5.0 / random_nodes);
+        graphs[1].build(graph);
+    }
+    {
+        Graph graph;
+        LargeGraphGenerator::generateCityLikeGraph(graph, city_nodes, 10);
+        graphs[2].build(graph);
+    }
+    const char* names[3] = {"Cuadrícula", "Aleatorio", "Ciudad"};
+    const int thread_counts[] = {1, 2, 4, 8};
+    
+    std::cout << "Núcleos disponibles: " << defaultThreadCount() << std::endl;
+    std::cout << "\nGrafo\t\tNodos\tDelta\tMétodo\t\t\tTiempo (ms)\tFases" << std::endl;
+    std::cout << "--------------------------------------------------------------------------------" << std::endl;
+    
+    for (int g = 0; g < 3; g++) {
+        const CompactGraph& graph = graphs[g];
+        int n = graph.getNodeCount();
+        if (n == 0) continue;
+        
+        int settled = 0;
+        double dijkstra_ms = timeIndexedDijkstra<4>(graph, 0, settled);
+        std::cout << names[g] << "\t" << n << "\t-\tDijkstra secuencial\t" << dijkstra_ms << "\t\t-" << std::endl;
+        
+        DynamicArray<double> reference;
+        for (int t = 0; t < 4; t++) {
+            DeltaStepping sssp(&graph);
+            DynamicArray<double> distances;
+            DynamicArray<int> parents;
+            auto start = std::chrono::high_resolution_clock::now();
+            sssp.run(graph.getNodeId(0), distances, parents, thread_counts[t]);
+            auto end = std::chrono::high_resolution_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            
+            if (t == 0) {
+                reference = distances;
+            } else {
+                for (int v = 0; v < n; v++) {
+                    if (distances[v] != reference[v]) {
+                        std::cout << "ADVERTENCIA: distancias distintas con " << thread_counts[t] << " hilos" << std::endl;
+                        break;
+                    }
+                }
+            }
+            std::cout << names[g] << "\t" << n << "\t" << sssp.getLastDelta() << "\tDelta-stepping, "
+                      << thread_counts[t] << " hilo(s)\t" << ms << "\t\t" << sssp.getPhaseCount() << std::endl;
+        }
+    }
+}
+
+void PerformanceAnalyzer::benchmarkIsochrones(int grid_side, int num_queries) {
+    std::cout << "\n=== Benchmark de Isócronas con Workspace Reutilizado ===" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+    CompactGraph compact(graph);
+    int n = compact.getNodeCount();
+    if (n == 0) return;
+    
+    // Depósitos al azar con bandas de 5, 10 y 20 unidades de costo
+    DynamicArray<int> depots(num_queries);
+    std::srand(42);
+    for (int q = 0; q < num_queries; q++) {
+        depots.push_back(compact.getNodeId(std::rand() % n));
+    }
+    DynamicArray<double> limits;
+    limits.push_back(5.0);
+    limits.push_back(10.0);
+    limits.push_back(20.0);
+    
+    SearchAlgorithms search(&compact);
+    long long checksum_fresh = 0, checksum_reused = 0;
+    auto fresh_start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < num_queries; q++) {
+        SearchWorkspace fresh;
+        DynamicArray<Isochrone> bands = search.isochrones(depots[q], limits, fresh);
+        checksum_fresh += bands[2].reachable_count + bands[2].boundary_nodes.getSize();
+    }
+    auto fresh_end = std::chrono::high_resolution_clock::now();
+    
+    SearchWorkspace shared(n);
+    auto reused_start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < num_queries; q++) {
+        DynamicArray<Isochrone> bands = search.isochrones(depots[q], limits, shared);
+        checksum_reused += bands[2].reachable_count + bands[2].boundary_nodes.getSize();
+    }
+    auto reused_end = std::chrono::high_resolution_clock::now();
+    
+    double fresh_ms = std::chrono::duration<double, std::milli>(fresh_end - fresh_start).count();
+    double reused_ms = std::chrono::duration<double, std::milli>(reused_end - reused_start).count();
+    std::cout << "Nodos: " << n << ", consultas: " << num_queries
+              << ", nodos por zona (promedio): " << checksum_reused / num_queries << std::endl;
+    std::cout << "\nWorkspace\tTotal (ms)\tPor consulta (ms)" << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "Nuevo\t\t" << fresh_ms << "\t\t" << fresh_ms / num_queries << std::endl;
+    std::cout << "Reutilizado\t" << reused_ms << "\t\t" << reused_ms / num_queries << std::endl;
+    std::cout << "Aceleración: " << (reused_ms > 0.0 ? fresh_ms / reused_ms : 0.0) << "x" << std::endl;
+    if (checksum_fresh != checksum_reused) {
+        std::cout << "ADVERTENCIA: resultados distintos entre ambas variantes" << std::endl;
+    }
+}
+
+// Benchmark de Jump Point Search
+void PerformanceAnalyzer::benchmarkJumpPointSearch(int grid_side, int num_queries) {
+    std::cout << "\n=== Benchmark de A* vs Jump Point Search en Cuadrícula ===" << std::endl;
+    
+    int cells = grid_side * grid_side;
+    if (cells == 0) return;
+    const char* scenarios[] = {"Abierta", "20% obstáculos"};
+    std::cout << "\nCuadrícula\tAlgoritmo\tNodos expandidos (prom.)\tTiempo (ms, prom.)" << std::endl;
+    std::cout << "----------------------------------------------------------------------" << std::endl;
+    
+    for (int s = 0; s < 2; s++) {
+        // Un solo grafo en memoria a la vez (2M nodos cada uno)
+        DynamicArray<char> blocked(cells);
+        std::srand(42);
+        for (int i = 0; i < cells; i++) {
+            blocked.push_back(s == 1 && std::rand() % 5 == 0 ? 1 : 0);
+        }
+        Graph graph;
+        LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side, 1.0, &blocked);
+        JumpPointSearch jps;
+        if (!jps.detectFrom(graph)) {
+            std::cout << "ADVERTENCIA: el grafo generado no se reconoció como cuadrícula" << std::endl;
+            continue;
+        }
+        
+        // Pares de celdas libres en esquinas opuestas (caminos largos)
+        DynamicArray<int> starts(num_queries);
+        DynamicArray<int> goals(num_queries);
+        while (starts.getSize() < num_queries) {
+            int start = (std::rand() % (grid_side / 4)) * grid_side + std::rand() % (grid_side / 4);
+            int goal = cells - 1 - ((std::rand() % (grid_side / 4)) * grid_side + std::rand() % (grid_side / 4));
+            if (jps.isBlocked(start) || jps.isBlocked(goal)) continue;
+            starts.push_back(start);
+            goals.push_back(goal);
+        }
+        
+        SearchAlgorithms search(&graph);
+        long long astar_explored = 0, jps_explored = 0;
+        double astar_ms = 0.0, jps_ms = 0.0;
+        bool mismatch = false;
+        for (int q = 0; q < num_queries; q++) {
+            auto astar_start = std::chrono::high_resolution_clock::now();
+            SearchResult astar = search.aStar(starts[q], goals[q]);
+            auto astar_end = std::chrono::high_resolution_clock::now();
+            SearchResult jump = jps.findPath(starts[q], goals[q]);
+            auto jps_end = std::chrono::high_resolution_clock::now();
+            astar_ms += std::chrono::duration<double, std::milli>(astar_end - astar_start).count();
+            jps_ms += std::chrono::duration<double, std::milli>(jps_end - astar_end).count();
+            astar_explored += astar.nodes_explored;
+            jps_explored += jump.nodes_explored;
+            mismatch = mismatch || astar.path_found != jump.path_found ||
+                       std::abs(astar.total_distance - jump.total_distance) > 1e-6;
+        }
+        
+        std::cout << scenarios[s] << "\tA*\t\t" << astar_explored / num_queries << "\t\t\t"
+                  << astar_ms / num_queries << std::endl;
+        std::cout << scenarios[s] << "\tJPS\t\t" << jps_explored / num_queries << "\t\t\t"
+                  << jps_ms / num_queries << std::endl;
+        std::cout << "Aceleración: " << (jps_ms > 0.0 ? astar_ms / jps_ms : 0.0) << "x, nodos expandidos: "
+                  << (jps_explored > 0 ? static_cast<double>(astar_explored) / jps_explored : 0.0) << "x menos" << std::endl;
+        if (mismatch) {
+            std::cout << "ADVERTENCIA: distancias distintas entre A* y JPS" << std::endl;
+        }
+    }
+}
+
+// Benchmark de la cuadrícula implícita
+void PerformanceAnalyzer::benchmarkImplicitGrid(int grid_side, int num_queries) {
+    std::cout << "\n=== Benchmark de Cuadrícula Materializada vs Implícita ===" << std::endl;
+    
+    auto graph_start = std::chrono::high_resolution_clock::now();
+    Graph graph;
+    LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+    auto graph_end = std::chrono::high_resolution_clock::now();
+    ImplicitGridGraph grid(grid_side, grid_side);
+    auto grid_end = std::chrono::high_resolution_clock::now();
+    int cells = grid.getNodeCount();
+    if (cells == 0) return;
+    
+    double graph_build_ms = std::chrono::duration<double, std::milli>(graph_end - graph_start).count();
+    double grid_build_ms = std::chrono::duration<double, std::milli>(grid_end - graph_end).count();
+    std::cout << "\nRepresentación\tConstrucción (ms)\tMemoria del grafo" << std::endl;
+    std::cout << "------------------------------------------------------------" << std::endl;
+    std::cout << "Graph\t\t" << graph_build_ms << "\t\t\t~" << estimateMemoryUsage(graph) << " MB" << std::endl;
+    std::cout << "Implícita\t" << grid_build_ms << "\t\t\t" << grid.getMemoryUsage() << " bytes" << std::endl;
+    std::cout << "(El estado de búsqueda es un SearchWorkspace de " << cells << " nodos en ambos casos)" << std::endl;
+    
+    // Desde cerca de una esquina hasta puntos al azar de la mitad opuesta
+    DynamicArray<int> starts(num_queries);
+    DynamicArray<int> goals(num_queries);
+    std::srand(42);
+    for (int q = 0; q < num_queries; q++) {
+        starts.push_back((std::rand() % 10) * grid_side + std::rand() % 10);
+        goals.push_back(cells / 2 + std::rand() % (cells / 2));
+    }
+    
+    SearchAlgorithms on_graph(&graph);
+    SearchAlgorithms on_grid(&grid);
+    const char* names[] = {"BFS", "Dijkstra", "A*"};
+    std::cout << "\nAlgoritmo\tGraph (ms)\tImplícita (ms)\tAceleración" << std::endl;
+    std::cout << "------------------------------------------------------------" << std::endl;
+    bool mismatch = false;
+    for (int a = 0; a < 3; a++) {
+        double times[2] = {0.0, 0.0};
+        for (int q = 0; q < num_queries; q++) {
+            SearchResult results[2];
+            for (int r = 0; r < 2; r++) {
+                SearchAlgorithms& search = r == 0 ? on_graph : on_grid;
+                auto start_time = std::chrono::high_resolution_clock::now();
+                results[r] = a == 0 ? search.breadthFirstSearch(starts[q], goals[q])
+                           : a == 1 ? search.dijkstra(starts[q], goals[q])
+                                    : search.aStar(starts[q], goals[q]);
+                auto end_time = std::chrono::high_resolution_clock::now();
+                times[r] += std::chrono::duration<double, std::milli>(end_time - start_time).count();
+            }
+            // nodes_explored puede variar: el orden de los vecinos cambia los empates
+            mismatch = mismatch || results[0].path_found != results[1].path_found ||
+                       std::abs(results[0].total_distance - results[1].total_distance) > 1e-9;
+        }
+        std::cout << names[a] << "\t\t" << times[0] / num_queries << "\t\t" << times[1] / num_queries
+                  << "\t\t" << (times[1] > 0.0 ? times[0] / times[1] : 0.0) << "x" << std::endl;
+    }
+    if (mismatch) {
+        std::cout << "ADVERTENCIA: resultados distintos entre ambas representaciones" << std::endl;
+    }
+}
+
+// Heurística euclidiana llamada a través de un puntero a función volatile:
+// el compilador no puede expandirla inline (referencia del benchmark)
+static double compactEuclidean(const CompactGraph& graph, int index, double goal_x, double goal_y) {
+    double dx = graph.getX(index) - goal_x;
+    double dy = graph.getY(index) - goal_y;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+static double (* volatile indirect_euclidean)(const CompactGraph&, int, double, double) = compactEuclidean;
+
+struct IndirectEuclideanHeuristic {
+    double goal_x;
+    double goal_y;
+    
+    IndirectEuclideanHeuristic(const CompactGraph& graph, int goal_index)
+        : goal_x(graph.getX(goal_index)), goal_y(graph.getY(goal_index)) {}
+    
+    double estimate(const CompactGraph& graph, int index) const {
+        return indirect_euclidean(graph, index, goal_x, goal_y);
+    }
+};
+
+// Tiempo promedio (ms) de 'search' sobre todos los pares; acumula las distancias
+template <typename Search>
+static double timeQueries(Search search, const DynamicArray<int>& starts, const DynamicArray<int>& goals,
+                          double& distance_sum) {
+    SearchWorkspace ws;
+    distance_sum = 0.0;
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < starts.getSize(); q++) {
+        distance_sum += search(starts[q], goals[q], ws).total_distance;
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end_time - start_time).count() / starts.getSize();
+}
+
+// Benchmark de GraphSearch según representación y políticas
+void PerformanceAnalyzer::benchmarkTemplatedSearch(int city_nodes, int num_queries) {
+    std::cout << "\n=== Benchmark de Búsquedas Genéricas (GraphSearch) ===" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateCityLikeGraph(graph, city_nodes, 20);
+    CompactGraph compact(graph);
+    const DynamicArray<Node>& nodes = graph.getAllNodes();
+    if (nodes.getSize() == 0 || num_queries <= 0) return;
+    
+    DynamicArray<int> starts(num_queries);
+    DynamicArray<int> goals(num_queries);
+    std::srand(42);
+    for (int q = 0; q < num_queries; q++) {
+        starts.push_back(nodes[std::rand() % nodes.getSize()].getId());
+        goals.push_back(nodes[std::rand() % nodes.getSize()].getId());
+    }
+    
+    GraphAdjacencyView view(&graph);
+    GraphSearch<GraphAdjacencyView> on_lists(&view);
+    GraphSearch<CompactGraph> on_csr(&compact);
+    GraphSearch<CompactGraph, IndirectEuclideanHeuristic> on_csr_indirect(&compact);
+    GraphSearch<CompactGraph, EuclideanHeuristic, IndexedHeapQueue<2> > on_csr_binary(&compact);
+    GraphSearch<CompactGraph, EuclideanHeuristic, IndexedHeapQueue<8> > on_csr_octal(&compact);
+    
+    double sums[9];
+    double times[9];
+    const char* labels[9] = {
+        "Dijkstra\tGraph (listas enlazadas)",
+        "Dijkstra\tCSR inline, heap 4-ario",
+        "Dijkstra\tCSR inline, heap 2-ario",
+        "Dijkstra\tCSR inline, heap 8-ario",
+        "A*\t\tGraph (listas enlazadas)",
+        "A*\t\tCSR, heurística por puntero",
+        "A*\t\tCSR inline, heap 4-ario",
+        "A*\t\tCSR inline, heap 2-ario",
+        "A*\t\tCSR inline, heap 8-ario"};
+    times[0] = timeQueries([&](int s, int g, SearchWorkspace& ws) { return on_lists.dijkstra(s, g, ws); }, starts, goals, sums[0]);
+    times[1] = timeQueries([&](int s, int g, SearchWorkspace& ws) { return on_csr.dijkstra(s, g, ws); }, starts, goals, sums[1]);
+    times[2] = timeQueries([&](int s, int g, SearchWorkspace& ws) { return on_csr_binary.dijkstra(s, g, ws); }, starts, goals, sums[2]);
+    times[3] = timeQueries([&](int s, int g, SearchWorkspace& ws) { return on_csr_octal.dijkstra(s, g, ws); }, starts, goals, sums[3]);
+    times[4] = timeQueries([&](int s, int g, SearchWorkspace& ws) { return on_lists.aStar(s, g, ws); }, starts, goals, sums[4]);
+    times[5] = timeQueries([&](int s, int g, SearchWorkspace& ws) { return on_csr_indirect.aStar(s, g, ws); }, starts, goals, sums[5]);
+    times[6] = timeQueries([&](int s, int g, SearchWorkspace& ws) { return on_csr.aStar(s, g, ws); }, starts, goals, sums[6]);
+    times[7] = timeQueries([&](int s, int g, SearchWorkspace& ws) { return on_csr_binary.aStar(s, g, ws); }, starts, goals, sums[7]);
+    times[8] = timeQueries([&](int s, int g, SearchWorkspace& ws) { return on_csr_octal.aStar(s, g, ws); }, starts, goals, sums[8]);
+    
+    std::cout << "Nodos: " << graph.getNodeCount() << ", consultas: " << num_queries << std::endl;
+    std::cout << "\nAlgoritmo\tVariante\t\t\tms/consulta\tvs Graph" << std::endl;
+    std::cout << "----------------------------------------------------------------------" << std::endl;
+    bool mismatch = false;
+    for (int v = 0; v < 9; v++) {
+        int baseline = v < 4 ? 0 : 4;
+        std::cout << labels[v] << "\t" << times[v] << "\t\t"
+                  << (times[v] > 0.0 ? times[baseline] / times[v] : 0.0) << "x" << std::endl;
+        mismatch = mismatch || std::abs(sums[v] - sums[0]) > 1e-6 * (1.0 + sums[0]);
+    }
+    if (mismatch) {
+        std::cout << "ADVERTENCIA: distancias distintas entre variantes" << std::endl;
+    }
+}
+
+// Dijkstra sobre todos los pares: acumula tiempo (ms), nodos asentados y distancias
+static void timeDijkstraQueries(SearchAlgorithms& search, const DynamicArray<int>& starts,
+                                const DynamicArray<int>& goals, double& total_ms,
+                                long long& settled, double& distance_sum) {
+    total_ms = 0.0;
+    settled = 0;
+    distance_sum = 0.0;
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < starts.getSize(); q++) {
+        SearchResult result = search.dijkstra(starts[q], goals[q]);
+        settled += result.nodes_explored;
+        distance_sum += result.total_distance;
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    total_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
+
+// Benchmark de reordenamiento de nodos
+void PerformanceAnalyzer::benchmarkNodeReordering(int city_nodes, int num_queries) {
+    std::cout << "\n=== Benchmark de Reordenamiento de Nodos ===" << std::endl;
+    
+    Graph original;
+    LargeGraphGenerator::generateCityLikeGraph(original, city_nodes, 20);
+    int n = original.getNodeCount();
+    if (n == 0 || num_queries <= 0) return;
+    
+    // Mismos pares de IDs para todos los órdenes
+    DynamicArray<int> starts(num_queries);
+    DynamicArray<int> goals(num_queries);
+    std::srand(42);
+    for (int q = 0; q < num_queries; q++) {
+        starts.push_back(original.getNodeId(std::rand() % n));
+        goals.push_back(original.getNodeId(std::rand() % n));
+    }
+    
+    std::cout << "Nodos: " << n << ", aristas: " << original.getEdgeCount()
+              << ", consultas: " << num_queries << std::endl;
+    std::cout << "\nOrden\t\tReordenar(ms)\tSalto medio\tGraph ms/q\tGraph ns/nodo\tCSR ms/q\tCSR ns/nodo" << std::endl;
+    std::cout << "------------------------------------------------------------------------------------------------" << std::endl;
+    
+    const NodeOrdering orderings[3] = {ORDER_HILBERT, ORDER_BFS, ORDER_RCM};
+    double reference_sum = 0.0;
+    bool mismatch = false;
+    for (int o = -1; o < 3; o++) {
+        Graph reordered;
+        double reorder_ms = 0.0;
+        if (o >= 0) {
+            DynamicArray<int> order;
+            auto start_time = std::chrono::high_resolution_clock::now();
+            NodeReordering::reorder(original, orderings[o], reordered, order);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            reorder_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+        }
+        const Graph& graph = o >= 0 ? reordered : original;
+        CompactGraph compact(graph);
+        SearchAlgorithms on_graph(&graph);
+        SearchAlgorithms on_compact(&compact);
+        
+        double graph_ms, compact_ms, graph_sum, compact_sum;
+        long long graph_settled, compact_settled;
+        timeDijkstraQueries(on_graph, starts, goals, graph_ms, graph_settled, graph_sum);
+        timeDijkstraQueries(on_compact, starts, goals, compact_ms, compact_settled, compact_sum);
+        if (o < 0) {
+            reference_sum = graph_sum;
+        }
+        mismatch = mismatch || std::abs(graph_sum - reference_sum) > 1e-6 * (1.0 + reference_sum) ||
+                   std::abs(compact_sum - reference_sum) > 1e-6 * (1.0 + reference_sum);
+        
+        std::cout << (o >= 0 ? NodeReordering::getName(orderings[o]) : "Original") << "\t\t"
+                  << reorder_ms << "\t\t" << NodeReordering::averageEdgeSpan(graph) << "\t\t"
+                  << graph_ms / num_queries << "\t\t"
+                  << (graph_settled > 0 ? graph_ms * 1e6 / graph_settled : 0.0) << "\t\t"
+                  << compact_ms / num_queries << "\t\t"
+                  << (compact_settled > 0 ? compact_ms * 1e6 / compact_settled : 0.0) << std::endl;
+    }
+    if (mismatch) {
+        std::cout << "ADVERTENCIA: las distancias cambian con el orden de los nodos" << std::endl;
+    }
+}
+
+// HeapNodeAllocator que cuenta las llamadas a new (referencia del benchmark del pool)
+struct CountingHeapAllocator {
+    static long long allocations;
+    
+    void* allocate(size_t bytes) {
+        allocations++;
+        return ::operator new(bytes);
+    }
+    
+    void deallocate(void* pointer, size_t) {
+        ::operator delete(pointer);
+    }
+};
+
+long long CountingHeapAllocator::allocations = 0;
+
+// Listas de adyacencia de una cuadrícula side x side (salientes y
+// entrantes, como Graph) a partir de la lista vacía 'empty'. Retorna ms
+template <typename List>
+static double buildGridAdjacency(DynamicArray<List>& lists, const List& empty, int side) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    int n = side * side;
+    for (int i = 0; i < n; i++) {
+        lists.push_back(empty);
+    }
+    const int dx[4] = {1, -1, 0, 0};
+    const int dy[4] = {0, 0, 1, -1};
+    for (int y = 0; y < side; y++) {
+        for (int x = 0; x < side; x++) {
+            int u = y * side + x;
+            for (int d = 0; d < 4; d++) {
+                int nx = x + dx[d];
+                int ny = y + dy[d];
+                if (nx < 0 || nx >= side || ny < 0 || ny >= side) continue;
+                int v = ny * side + nx;
+                Edge edge(u, v, 1.0);
+                edge.setIndices(u, v);
+                lists[u].push_back(edge);
+                lists[v].push_back(edge);
+            }
+        }
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
+
+// BFS completo desde el nodo 0 con la cola dada. Retorna ms
+template <typename QueueType>
+static double timeFullBFS(const Graph& graph, QueueType& queue, int& visited_count) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    int n = graph.getNodeCount();
+    DynamicArray<bool> visited(n);
+    for (int i = 0; i < n; i++) {
+        visited.push_back(false);
+    }
+    visited[0] = true;
+    queue.enqueue(0);
+    visited_count = 0;
+    while (!queue.isEmpty()) {
+        int u = queue.front();
+        queue.dequeue();
+        visited_count++;
+        const EdgeList& edges = graph.getAdjacenciesAt(u);
+        for (auto it = edges.begin(); it != edges.end(); ++it) {
+            int v = (*it).getDestinationIndex();
+            if (!visited[v]) {
+                visited[v] = true;
+                queue.enqueue(v);
+            }
+        }
+    }
+    auto end_time = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
+
+// Benchmark de listas y colas con nodos del heap vs NodePool
+void PerformanceAnalyzer::benchmarkNodePool(int grid_side) {
+    std::cout << "\n=== Benchmark de Pool de Nodos (LinkedList y Queue) ===" << std::endl;
+    int n = grid_side * grid_side;
+    if (n == 0) return;
+    
+    // Listas de adyacencia: construcción, llamadas a new, memoria y liberación
+    typedef LinkedList<Edge, CountingHeapAllocator> HeapEdgeList;
+    CountingHeapAllocator::allocations = 0;
+    DynamicArray<HeapEdgeList>* heap_lists = new DynamicArray<HeapEdgeList>(n);
+    double heap_build_ms = buildGridAdjacency(*heap_lists, HeapEdgeList(), grid_side);
+    long long heap_allocations = CountingHeapAllocator::allocations;
+    auto heap_free_start = std::chrono::high_resolution_clock::now();
+    delete heap_lists;
+    auto heap_free_end = std::chrono::high_resolution_clock::now();
+    double heap_free_ms = std::chrono::duration<double, std::milli>(heap_free_end - heap_free_start).count();
+    
+    NodePool pool;
+    DynamicArray<EdgeList>* pool_lists = new DynamicArray<EdgeList>(n);
+    double pool_build_ms = buildGridAdjacency(*pool_lists, EdgeList(PoolNodeAllocator(&pool)), grid_side);
+    long long edge_nodes = pool.getAllocationCount();
+    int pool_chunks = pool.getChunkCount();
+    size_t pool_bytes = pool.getReservedBytes();
+    // Como Graph::clear: vaciar sin liberar nodo por nodo y devolver los bloques
+    auto pool_free_start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < pool_lists->getSize(); i++) {
+        (*pool_lists)[i].discard();
+    }
+    pool.release();
+    delete pool_lists;
+    auto pool_free_end = std::chrono::high_resolution_clock::now();
+    double pool_free_ms = std::chrono::duration<double, std::milli>(pool_free_end - pool_free_start).count();
+    
+    // Cada nodo del heap lleva además la cabecera de malloc (8 bytes,
+    // redondeado a 16): estimación para glibc
+    size_t heap_node_bytes = (pool.getSlotSize() + 8 + 15) / 16 * 16;
+    std::cout << "Cuadrícula " << grid_side << "x" << grid_side << ": " << n << " nodos, "
+              << edge_nodes << " nodos de lista (salientes + entrantes)" << std::endl;
+    std::cout << "\nListas de aristas\tConstrucción (ms)\tLlamadas a new\tMemoria (MB)\tLiberación (ms)" << std::endl;
+    std::cout << "------------------------------------------------------------------------------------------" << std::endl;
+    std::cout << "Heap\t\t\t" << heap_build_ms << "\t\t\t" << heap_allocations << "\t\t~"
+              << edge_nodes * heap_node_bytes / (1024.0 * 1024.0) << "\t\t" << heap_free_ms << std::endl;
+    std::cout << "NodePool\t\t" << pool_build_ms << "\t\t\t" << pool_chunks << "\t\t"
+              << pool_bytes / (1024.0 * 1024.0) << "\t\t" << pool_free_ms << std::endl;
+    
+    // Cola de BFS sobre el grafo completo
+    Graph graph;
+    auto graph_start = std::chrono::high_resolution_clock::now();
+    LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+    auto graph_end = std::chrono::high_resolution_clock::now();
+    double graph_ms = std::chrono::duration<double, std::milli>(graph_end - graph_start).count();
+    
+    int heap_visited = 0;
+    int pool_visited = 0;
+    CountingHeapAllocator::allocations = 0;
+    Queue<int, CountingHeapAllocator> heap_queue;
+    double heap_bfs_ms = timeFullBFS(graph, heap_queue, heap_visited);
+    long long heap_queue_allocations = CountingHeapAllocator::allocations;
+    NodePool queue_pool;
+    Queue<int, PoolNodeAllocator> pool_queue{PoolNodeAllocator(&queue_pool)};
+    double pool_bfs_ms = timeFullBFS(graph, pool_queue, pool_visited);
+    
+    std::cout << "\nCola de BFS (" << heap_visited << " nodos)\tTiempo (ms)\tLlamadas a new" << std::endl;
+    std::cout << "------------------------------------------------------------" << std::endl;
+    std::cout << "Heap\t\t\t\t" << heap_bfs_ms << "\t\t" << heap_queue_allocations << std::endl;
+    std::cout << "NodePool\t\t\t" << pool_bfs_ms << "\t\t" << queue_pool.getChunkCount() << std::endl;
+    std::cout << "\ngenerateGridGraph (aristas en el pool de Graph): " << graph_ms << " ms, "
+              << graph.getEdgeMemoryBytes() / (1024.0 * 1024.0) << " MB de aristas" << std::endl;
+    if (heap_visited != pool_visited) {
+        std::cout << "ADVERTENCIA: los BFS visitaron distinta cantidad de nodos" << std::endl;
+    }
+}
+
+// Benchmark de cola enlazada vs buffer circular en un BFS completo
+void PerformanceAnalyzer::benchmarkRingQueue(int grid_side, int repetitions) {
+    std::cout << "\n=== Benchmark de Cola Enlazada vs Buffer Circular (BFS) ===" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateGridGraph(graph, grid_side, grid_side);
+    int n = graph.getNodeCount();
+    if (n == 0 || repetitions <= 0) return;
+    
+    // Mejor tiempo de 'repetitions' BFS completos desde el nodo 0 por variante
+    const char* names[4] = {"Queue (new por nodo)", "Queue (NodePool)", "RingQueue", "RingQueue reservada"};
+    double best[4] = {0.0, 0.0, 0.0, 0.0};
+    int visited[4] = {0, 0, 0, 0};
+    int max_frontier = 0;
+    for (int r = 0; r < repetitions; r++) {
+        double times[4];
+        {
+            Queue<int> queue;
+            times[0] = timeFullBFS(graph, queue, visited[0]);
+        }
+        {
+            NodePool pool;
+            Queue<int, PoolNodeAllocator> queue{PoolNodeAllocator(&pool)};
+            times[1] = timeFullBFS(graph, queue, visited[1]);
+        }
+        {
+            RingQueue<int> queue;
+            times[2] = timeFullBFS(graph, queue, visited[2]);
+            max_frontier = queue.getCapacity();
+        }
+        {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            RingQueue<int> queue;
+            queue.reserve(n);
+            auto end_time = std::chrono::high_resolution_clock::now();
+            times[3] = timeFullBFS(graph, queue, visited[3]) +
+                       std::chrono::duration<double, std::milli>(end_time - start_time).count();
+        }
+        for (int v = 0; v < 4; v++) {
+            if (r == 0 || times[v] < best[v]) {
+                best[v] = times[v];
+            }
+        }
+    }
+    
+    std::cout << "Cuadrícula " << grid_side << "x" << grid_side << ": " << n << " nodos, mejor de "
+              << repetitions << " BFS completos" << std::endl;
+    std::cout << "\nCola\t\t\tTiempo (ms)\tns/nodo\t\tAceleración" << std::endl;
+    std::cout << "------------------------------------------------------------------------" << std::endl;
+    bool mismatch = false;
+    for (int v = 0; v < 4; v++) {
+        std::cout << names[v] << (v == 2 ? "\t\t" : "\t") << best[v] << "\t\t" << best[v] * 1e6 / n << "\t\t"
+                  << (best[v] > 0.0 ? best[0] / best[v] : 0.0) << "x" << std::endl;
+        mismatch = mismatch || visited[v] != n;
+    }
+    std::cout << "(capacidad final de la RingQueue sin reserva: " << max_frontier << " elementos)" << std::endl;
+    
+    // breadthFirstSearch (RingQueue sin reserva) de esquina a esquina
+    SearchAlgorithms search(&graph);
+    auto start_time = std::chrono::high_resolution_clock::now();
+    SearchResult result = search.breadthFirstSearch(graph.getNodeId(0), graph.getNodeId(n - 1));
+    auto end_time = std::chrono::high_resolution_clock::now();
+    std::cout << "\nbreadthFirstSearch esquina a esquina: "
+              << std::chrono::duration<double, std::milli>(end_time - start_time).count() << " ms, "
+              << result.nodes_explored << " nodos explorados" << std::endl;
+    if (mismatch || !result.path_found) {
+        std::cout << "ADVERTENCIA: algún BFS no recorrió toda la cuadrícula" << std::endl;
+    }
+}
@@ -0,0 +1,126 @@
+#include "../include/query_executor.h"
+
+// Constructores
+QueryExecutor::QueryExecutor(const Graph* graph, int num_threads)
+    : graph(graph), compact_graph(nullptr), workers(nullptr), num_threads(0),
+      queries(nullptr), results(nullptr), batch_id(0), running_workers(0), stopping(false) {
+    start(num_threads);
+}
+
+QueryExecutor::QueryExecutor(const CompactGraph* compact_graph, int num_threads)
+    : graph(nullptr), compact_graph(compact_graph), workers(nullptr), num_threads(0),
+      queries(nullptr), results(nullptr), batch_id(0), running_workers(0), stopping(false) {
+    start(num_threads);
+}
+
+// Crear los hilos; cada uno con su propio SearchAlgorithms
+void QueryExecutor::start(int thread_count) {
+    num_threads = thread_count > 0 ? thread_count : 1;
+    workers = new Worker[num_threads];
+    for (int w = 0; w < num_threads; w++) {
+        workers[w].next = 0;
+        workers[w].end = 0;
+        workers[w].search = compact_graph ? new SearchAlgorithms(compact_graph) : new SearchAlgorithms(graph);
+    }
+    for (int w = 0; w < num_threads; w++) {
+        workers[w].thread = std::thread(&QueryExecutor::workerLoop, this, w);
+    }
+}
+
+// Destructor
+QueryExecutor::~QueryExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    batch_ready.notify_all();
+    for (int w = 0; w < num_threads; w++) {
+        workers[w].thread.join();
+        delete workers[w].search;
+    }
+    delete[] workers;
+}
+
+void QueryExecutor::setLandmarks(const Landmarks* landmarks) {
+    for (int w = 0; w < num_threads; w++) {
+        workers[w].search->setLandmarks(landmarks);
+    }
+}
+
+// Ejecutar un lote
+void QueryExecutor::run(const DynamicArray<RouteQuery>& batch, DynamicArray<SearchResult>& output) {
+    int n = batch.getSize();
+    output.clear();
+    output.resize(n);
+    if (n == 0) {
+        return;
+    }
+
+    // Bloque contiguo inicial de cada hilo
+    for (int w = 0; w < num_threads; w++) {
+        workers[w].next = static_cast<int>(static_cast<long long>(n) * w / num_threads);
+        workers[w].end = static_cast<int>(static_cast<long long>(n) * (w + 1) / num_threads);
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    queries = &batch;
+    results = &output;
+    running_workers = num_threads;
+    batch_id++;
+    batch_ready.notify_all();
+    batch_finished.wait(lock, [this]() { return running_workers == 0; });
+    queries = nullptr;
+    results = nullptr;
+}
+
+// Bucle de cada hilo: esperar un lote nuevo, procesarlo y avisar
+void QueryExecutor::workerLoop(int worker) {
+    unsigned int seen_batch = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            batch_ready.wait(lock, [this, seen_batch]() { return stopping || batch_id != seen_batch; });
+            if (stopping) {
+                return;
+            }
+            seen_batch = batch_id;
+        }
+
+        processBatch(worker);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--running_workers == 0) {
+            batch_finished.notify_one();
+        }
+    }
+}
+
+// Primero el bloque propio y luego, en orden, los de los demás hilos
+void QueryExecutor::processBatch(int worker) {
+    SearchAlgorithms& search = *workers[worker].search;
+    for (int k = 0; k < num_threads; k++) {
+        Worker& victim = workers[(worker + k) % num_threads];
+        for (int i = victim.next++; i < victim.end; i = victim.next++) {
+            (*results)[i] = execute(search, (*queries)[i]);
+        }
+    }
+}
+
+SearchResult QueryExecutor::execute(SearchAlgorithms& search, const RouteQuery& query) {
+    switch (query.algorithm) {
+        case QUERY_BFS:                    return search.breadthFirstSearch(query.start, query.goal);
+        case QUERY_DFS:                    return search.depthFirstSearch(query.start, query.goal);
+        case QUERY_DIJKSTRA:               return search.dijkstra(query.start, query.goal);
+        case QUERY_BEST_FIRST:             return search.bestFirstSearch(query.start, query.goal);
+        case QUERY_ASTAR:                  return search.aStar(query.start, query.goal);
+        case QUERY_BIDIRECTIONAL_DIJKSTRA: return search.bidirectionalDijkstra(query.start, query.goal);
+        case QUERY_BIDIRECTIONAL_ASTAR:    return search.bidirectionalAStar(query.start, query.goal);
+        case QUERY_ALT:                    return search.altSearch(query.start, query.goal);
+    }
+    return SearchResult();
+}
+
+// Información
+int QueryExecutor::getThreadCount() const {
+    return num_threads;
+}
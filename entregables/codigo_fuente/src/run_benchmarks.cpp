@@ -0,0 +1,103 @@
+#include "../include/performance_analyzer.h"
+#include <iostream>
+#include <string>
+
+void showUsage() {
+    std::cout << "Uso: ./run_benchmarks <benchmark>" << std::endl;
+    std::cout << "Benchmarks disponibles:" << std::endl;
+    std::cout << "  lookup    Búsqueda de nodos por ID (10K a 2M nodos)" << std::endl;
+    std::cout << "  csr       Graph vs CompactGraph en cuadrícula 1414x1414" << std::endl;
+    std::cout << "  heap      Aridad 2/4/8 del heap indexado (cuadrícula y ciudad)" << std::endl;
+    std::cout << "  workspace Consultas cortas con workspace nuevo vs reutilizado" << std::endl;
+    std::cout << "  alt       A* euclidiano vs ALT (k = 4, 8, 16) en grafo tipo ciudad" << std::endl;
+    std::cout << "  ch        Contraction Hierarchies vs Dijkstra y A* en cuadrícula 300x300" << std::endl;
+    std::cout << "  mmap      Carga del binario clásico vs CSR proyectado (cuadrícula 1000x1000)" << std::endl;
+    std::cout << "  spatial   Generación de grafos tipo ciudad y sintéticos (10K a 2M nodos)" << std::endl;
+    std::cout << "  nearest   Nodo más cercano a una coordenada: lineal vs k-d tree (2M nodos)" << std::endl;
+    std::cout << "  csv       Carga CSV anterior vs tokenizador sobre memoria (cuadrícula 1000x1000)" << std::endl;
+    std::cout << "  csvpar    Carga CSV paralela con 1 a 16 hilos (cuadrícula 1000x1000)" << std::endl;
+    std::cout << "  matrix    Matriz de distancias 200x200: por par vs uno-a-muchos (200K nodos)" << std::endl;
+    std::cout << "  executor  Lote de 500 consultas con QueryExecutor, 1 a 16 hilos (200K nodos)" << std::endl;
+    std::cout << "  delta     SSSP con delta-stepping vs Dijkstra (cuadrícula 1000x1000, aleatorio, ciudad)" << std::endl;
+    std::cout << "  isochrone Isócronas repetidas de radio pequeño, workspace nuevo vs reutilizado (1M nodos)" << std::endl;
+    std::cout << "  jps       A* vs Jump Point Search en la cuadrícula 1414x1414, abierta y con obstáculos" << std::endl;
+    std::cout << "  implicit  Cuadrícula 1414x1414 materializada vs implícita: memoria y búsquedas" << std::endl;
+    std::cout << "  generic   GraphSearch: listas enlazadas vs CSR inline, heurística y heap (200K nodos)" << std::endl;
+    std::cout << "  reorder   Reordenamiento de nodos (Hilbert, BFS, RCM): tiempo por nodo asentado (500K nodos)" << std::endl;
+    std::cout << "  pool      Listas y cola de BFS con new por nodo vs NodePool (cuadrícula 1414x1414)" << std::endl;
+    std::cout << "  ring      BFS de 2M nodos: cola enlazada vs buffer circular (RingQueue)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "=== SISTEMA DE NAVEGACIÓN - BENCHMARKS ===" << std::endl;
+    std::cout << "Proyecto Final - Algoritmos y Estructura de Datos" << std::endl;
+    
+    if (argc < 2) {
+        showUsage();
+        return 1;
+    }
+    
+    std::string benchmark = argv[1];
+    PerformanceAnalyzer analyzer;
+    
+    if (benchmark == "lookup") {
+        DynamicArray<int> sizes;
+        sizes.push_back(10000);
+        sizes.push_back(100000);
+        sizes.push_back(500000);
+        sizes.push_back(1000000);
+        sizes.push_back(2000000);
+        analyzer.benchmarkNodeLookup(sizes);
+    } else if (benchmark == "csr") {
+        analyzer.benchmarkCompactGraph(1414);
+    } else if (benchmark == "heap") {
+        analyzer.benchmarkHeapArity(1000, 20000);
+    } else if (benchmark == "workspace") {
+        analyzer.benchmarkWorkspaceReuse(1414);
+    } else if (benchmark == "alt") {
+        analyzer.benchmarkLandmarks(20000);
+    } else if (benchmark == "ch") {
+        analyzer.benchmarkContractionHierarchy(300);
+    } else if (benchmark == "mmap") {
+        analyzer.benchmarkMappedGraph(1000);
+    } else if (benchmark == "spatial") {
+        DynamicArray<int> sizes;
+        sizes.push_back(10000);
+        sizes.push_back(100000);
+        sizes.push_back(500000);
+        sizes.push_back(2000000);
+        analyzer.benchmarkSpatialGeneration(sizes);
+    } else if (benchmark == "nearest") {
+        analyzer.benchmarkNearestNode(2000000);
+    } else if (benchmark == "csv") {
+        analyzer.benchmarkCSVLoading(1000);
+    } else if (benchmark == "csvpar") {
+        analyzer.benchmarkParallelCSVLoading(1000);
+    } else if (benchmark == "matrix") {
+        analyzer.benchmarkDistanceMatrix(200000, 200);
+    } else if (benchmark == "executor") {
+        analyzer.benchmarkQueryExecutor(200000, 500);
+    } else if (benchmark == "delta") {
+        analyzer.benchmarkDeltaStepping(1000, 20000, 500000);
+    } else if (benchmark == "isochrone") {
+        analyzer.benchmarkIsochrones(1000);
+    } else if (benchmark == "jps") {
+        analyzer.benchmarkJumpPointSearch(1414);
+    } else if (benchmark == "implicit") {
+        analyzer.benchmarkImplicitGrid(1414);
+    } else if (benchmark == "generic") {
+        analyzer.benchmarkTemplatedSearch(200000);
+    } else if (benchmark == "reorder") {
+        analyzer.benchmarkNodeReordering(500000);
+    } else if (benchmark == "pool") {
+        analyzer.benchmarkNodePool(1414);
+    } else if (benchmark == "ring") {
+        analyzer.benchmarkRingQueue(1414);
+    } else {
+        std::cout << "Benchmark desconocido: " << benchmark << std::endl;
+        showUsage();
+        return 1;
+    }
+    
+    return 0;
+}
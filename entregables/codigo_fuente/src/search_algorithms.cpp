@@ -1,10 +1,19 @@
 #include "../include/search_algorithms.h"
+#include "../include/graph_search.h"
+#include "../include/parallel_for.h"
 #include <iostream>
 #include <cmath>
 #include <limits>
 
-// Constructor
-SearchAlgorithms::SearchAlgorithms(const Graph* graph) : graph(graph) {}
+// Constructores
+SearchAlgorithms::SearchAlgorithms(const Graph* graph)
+    : graph(graph), compact_graph(nullptr), grid_graph(nullptr), landmarks(nullptr) {}
+
+SearchAlgorithms::SearchAlgorithms(const CompactGraph* compact_graph)
+    : graph(nullptr), compact_graph(compact_graph), grid_graph(nullptr), landmarks(nullptr) {}
+
+SearchAlgorithms::SearchAlgorithms(const ImplicitGridGraph* grid_graph)
+    : graph(nullptr), compact_graph(nullptr), grid_graph(grid_graph), landmarks(nullptr) {}
 
 // Función auxiliar para calcular distancia euclidiana
 double SearchAlgorithms::calculateDistance(const Node* node1, const Node* node2) const {
@@ -15,6 +24,15 @@ double SearchAlgorithms::calculateDistance(const Node* node1, const Node* node2)
     return std::sqrt(dx * dx + dy * dy);
 }
 
+// Invertir un camino (de meta a origen) sin copiarlo a otro array
+static void reverseInPlace(DynamicArray<int>& path) {
+    for (int i = 0, j = path.getSize() - 1; i < j; i++, j--) {
+        int tmp = path[i];
+        path[i] = path[j];
+        path[j] = tmp;
+    }
+}
+
 // Función auxiliar para reconstruir el camino
 DynamicArray<int> SearchAlgorithms::reconstructPath(const DynamicArray<int>& parent, int start, int goal) const {
     DynamicArray<int> path;
@@ -26,70 +44,195 @@ DynamicArray<int> SearchAlgorithms::reconstructPath(const DynamicArray<int>& par
         current = parent[current];
     }
     
-    // Invertir el camino
-    DynamicArray<int> reversed_path;
-    for (int i = path.getSize() - 1; i >= 0; i--) {
-        reversed_path.push_back(path[i]);
+    // Invertir el camino en el mismo array
+    reverseInPlace(path);
+    return path;
+}
+
+// Reconstruir el camino a partir de los padres guardados en el workspace
+DynamicArray<int> SearchAlgorithms::reconstructPath(const SearchWorkspace& ws, int start, int goal) const {
+    DynamicArray<int> path;
+    int current = goal;
+    
+    while (current != -1) {
+        path.push_back(current);
+        if (current == start) break;
+        current = ws.getParent(current);
     }
     
-    return reversed_path;
+    reverseInPlace(path);
+    return path;
 }
 
-// Depth First Search
+// Traducir un camino en índices internos de Graph a IDs externos
+DynamicArray<int> SearchAlgorithms::toNodeIds(const DynamicArray<int>& indices) const {
+    DynamicArray<int> ids(indices.getSize() > 0 ? indices.getSize() : 1);
+    for (int i = 0; i < indices.getSize(); i++) {
+        ids.push_back(graph->getNodeId(indices[i]));
+    }
+    return ids;
+}
+
+// Versiones sin workspace explícito: reutilizan el de esta instancia
 SearchResult SearchAlgorithms::depthFirstSearch(int start, int goal) {
+    return depthFirstSearch(start, goal, workspace);
+}
+
+SearchResult SearchAlgorithms::breadthFirstSearch(int start, int goal) {
+    return breadthFirstSearch(start, goal, workspace);
+}
+
+SearchResult SearchAlgorithms::dijkstra(int start, int goal) {
+    return dijkstra(start, goal, workspace);
+}
+
+SearchResult SearchAlgorithms::bestFirstSearch(int start, int goal) {
+    return bestFirstSearch(start, goal, workspace);
+}
+
+SearchResult SearchAlgorithms::aStar(int start, int goal) {
+    return aStar(start, goal, workspace);
+}
+
+// ===== Algoritmos básicos =====
+// Los cinco están escritos una sola vez en GraphSearch (graph_search.h);
+// aquí solo se elige la instancia según la representación del grafo. Todas
+// indexan el workspace por índice interno (en Graph, el asignado al
+// insertar cada nodo).
+
+SearchResult SearchAlgorithms::depthFirstSearch(int start, int goal, SearchWorkspace& ws) {
+    if (compact_graph) {
+        return GraphSearch<CompactGraph>(compact_graph).depthFirstSearch(start, goal, ws);
+    }
+    if (grid_graph) {
+        return GraphSearch<ImplicitGridGraph>(grid_graph).depthFirstSearch(start, goal, ws);
+    }
+    GraphAdjacencyView view(graph);
+    return GraphSearch<GraphAdjacencyView>(&view).depthFirstSearch(start, goal, ws);
+}
+
+SearchResult SearchAlgorithms::breadthFirstSearch(int start, int goal, SearchWorkspace& ws) {
+    if (compact_graph) {
+        return GraphSearch<CompactGraph>(compact_graph).breadthFirstSearch(start, goal, ws);
+    }
+    if (grid_graph) {
+        return GraphSearch<ImplicitGridGraph>(grid_graph).breadthFirstSearch(start, goal, ws);
+    }
+    GraphAdjacencyView view(graph);
+    return GraphSearch<GraphAdjacencyView>(&view).breadthFirstSearch(start, goal, ws);
+}
+
+// Dijkstra con heap indexado: cada nodo aparece a lo sumo una vez en la
+// cola y las mejoras de distancia se aplican con decreaseKey
+SearchResult SearchAlgorithms::dijkstra(int start, int goal, SearchWorkspace& ws) {
+    if (compact_graph) {
+        return GraphSearch<CompactGraph>(compact_graph).dijkstra(start, goal, ws);
+    }
+    if (grid_graph) {
+        return GraphSearch<ImplicitGridGraph>(grid_graph).dijkstra(start, goal, ws);
+    }
+    GraphAdjacencyView view(graph);
+    return GraphSearch<GraphAdjacencyView>(&view).dijkstra(start, goal, ws);
+}
+
+// Best First Search (Greedy)
+SearchResult SearchAlgorithms::bestFirstSearch(int start, int goal, SearchWorkspace& ws) {
+    if (compact_graph) {
+        return GraphSearch<CompactGraph>(compact_graph).bestFirstSearch(start, goal, ws);
+    }
+    if (grid_graph) {
+        return GraphSearch<ImplicitGridGraph>(grid_graph).bestFirstSearch(start, goal, ws);
+    }
+    GraphAdjacencyView view(graph);
+    return GraphSearch<GraphAdjacencyView>(&view).bestFirstSearch(start, goal, ws);
+}
+
+// A* con heap indexado: si se encuentra un mejor g_score para un nodo que
+// ya está en la cola se aplica decreaseKey; si ya había sido extraído
+// (heurística inconsistente) se reinserta
+SearchResult SearchAlgorithms::aStar(int start, int goal, SearchWorkspace& ws) {
+    if (compact_graph) {
+        return GraphSearch<CompactGraph>(compact_graph).aStar(start, goal, ws);
+    }
+    if (grid_graph) {
+        return GraphSearch<ImplicitGridGraph>(grid_graph).aStar(start, goal, ws);
+    }
+    GraphAdjacencyView view(graph);
+    return GraphSearch<GraphAdjacencyView>(&view).aStar(start, goal, ws);
+}
+
+// ===== ALT (A*, Landmarks, desigualdad triangular) =====
+// Igual que A*, pero h(v) es la cota de los landmarks. Como esa cota es
+// consistente, un nodo extraído de la cola no vuelve a mejorar.
+
+void SearchAlgorithms::setLandmarks(const Landmarks* landmarks) {
+    this->landmarks = landmarks;
+}
+
+SearchResult SearchAlgorithms::altSearch(int start, int goal) {
+    return altSearch(start, goal, workspace);
+}
+
+SearchResult SearchAlgorithms::altSearch(int start, int goal, SearchWorkspace& ws) {
+    if (compact_graph) {
+        return compactAltSearch(start, goal, ws);
+    }
+    if (grid_graph) {
+        return SearchResult();
+    }
+    
     auto start_time = std::chrono::high_resolution_clock::now();
     SearchResult result;
     
-    if (!graph->hasNode(start) || !graph->hasNode(goal)) {
+    // Los landmarks deben corresponder a este grafo
+    if (!landmarks || landmarks->getNodeCount() != graph->getNodeCount()) {
         return result;
     }
     
-    DynamicArray<bool> visited(graph->getNodeCount());
-    DynamicArray<int> parent(graph->getNodeCount());
-    DynamicArray<int> stack;
-    
-    // Inicializar arrays
-    for (int i = 0; i < graph->getNodeCount(); i++) {
-        visited.push_back(false);
-        parent.push_back(-1);
+    // Workspace y cota de los landmarks se indexan por índice interno
+    int start_index = graph->getNodeIndex(start);
+    int goal_index = graph->getNodeIndex(goal);
+    if (start_index == -1 || goal_index == -1) {
+        return result;
     }
     
-    stack.push_back(start);
+    ws.prepare(graph->getNodeCount());
+    SearchHeap& open_set = ws.getHeap();
+    
+    ws.setDistance(start_index, 0.0);
+    open_set.push(start_index, landmarks->lowerBound(start_index, goal_index));
+    
     int nodes_explored = 0;
     
-    while (!stack.isEmpty()) {
-        int current = stack[stack.getSize() - 1];
-        stack.pop_back();
-        
-        if (visited[current]) continue;
-        
-        visited[current] = true;
+    while (!open_set.isEmpty()) {
+        int current = open_set.top();
+        open_set.pop();
+        ws.setVisited(current);
         nodes_explored++;
         
-        if (current == goal) {
-            result.path = reconstructPath(parent, start, goal);
+        if (current == goal_index) {
+            result.path = toNodeIds(reconstructPath(ws, start_index, goal_index));
             result.path_found = true;
+            result.total_distance = ws.getDistance(goal_index);
             break;
         }
         
-        const LinkedList<Edge>& adjacencies = graph->getAdjacencies(current);
+        double g_current = ws.getDistance(current);
+        const EdgeList& adjacencies = graph->getAdjacenciesAt(current);
         for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
-            int neighbor = (*it).getDestination();
-            if (!visited[neighbor]) {
-                parent[neighbor] = current;
-                stack.push_back(neighbor);
+            int neighbor = (*it).getDestinationIndex();
+            double tentative_g = g_current + (*it).getWeight();
+            
+            if (!ws.isVisited(neighbor) && tentative_g < ws.getDistance(neighbor)) {
+                ws.setParent(neighbor, current);
+                ws.setDistance(neighbor, tentative_g);
+                
+                double f = tentative_g + landmarks->lowerBound(neighbor, goal_index);
+                open_set.pushOrDecrease(neighbor, f);
             }
         }
     }
     
-    // Calcular distancia total si se encontró un camino
-    if (result.path_found) {
-        result.total_distance = 0.0;
-        for (int i = 0; i < result.path.getSize() - 1; i++) {
-            result.total_distance += graph->getEdgeWeight(result.path[i], result.path[i + 1]);
-        }
-    }
-    
     result.nodes_explored = nodes_explored;
     auto end_time = std::chrono::high_resolution_clock::now();
     result.time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
@@ -97,57 +240,119 @@ SearchResult SearchAlgorithms::depthFirstSearch(int start, int goal) {
     return result;
 }
 
-// Breadth First Search
-SearchResult SearchAlgorithms::breadthFirstSearch(int start, int goal) {
+// ===== Búsquedas bidireccionales =====
+// Dos búsquedas simultáneas: una desde 'start' sobre las aristas salientes y
+// otra desde 'goal' sobre las entrantes. 'best' guarda el mejor camino
+// completo visto al relajar una arista hacia un nodo ya alcanzado por el otro
+// lado; la búsqueda termina cuando la suma de los mínimos de ambas colas ya
+// no puede mejorarlo.
+//
+// En A* se usa el potencial promedio pf(v) = (h(v, goal) - h(start, v)) / 2
+// hacia adelante y -pf(v) hacia atrás. Con él ambos lados ven los mismos
+// costos reducidos, así que el criterio de parada sigue siendo válido (con
+// el potencial de A* clásico en cada lado no lo sería). Si la heurística es
+// consistente los costos reducidos son no negativos.
+
+double SearchAlgorithms::averagePotential(const Node* node, const Node* start_node,
+                                          const Node* goal_node) const {
+    return 0.5 * (calculateDistance(node, goal_node) - calculateDistance(start_node, node));
+}
+
+SearchResult SearchAlgorithms::bidirectionalSearch(int start, int goal, SearchWorkspace& forward_ws,
+                                                   SearchWorkspace& backward_ws, bool use_potential) {
     auto start_time = std::chrono::high_resolution_clock::now();
     SearchResult result;
     
-    if (!graph->hasNode(start) || !graph->hasNode(goal)) {
+    // El lado inverso necesita las aristas entrantes, que solo mantiene Graph
+    if (!graph) {
         return result;
     }
     
-    DynamicArray<bool> visited(graph->getNodeCount());
-    DynamicArray<int> parent(graph->getNodeCount());
-    Queue<int> queue;
+    int start_index = graph->getNodeIndex(start);
+    int goal_index = graph->getNodeIndex(goal);
+    if (start_index == -1 || goal_index == -1) {
+        return result;
+    }
     
-    // Inicializar arrays
-    for (int i = 0; i < graph->getNodeCount(); i++) {
-        visited.push_back(false);
-        parent.push_back(-1);
+    const double INF = std::numeric_limits<double>::infinity();
+    const Node* start_node = &graph->getNodeAt(start_index);
+    const Node* goal_node = &graph->getNodeAt(goal_index);
+    
+    forward_ws.prepare(graph->getNodeCount());
+    backward_ws.prepare(graph->getNodeCount());
+    SearchHeap& forward_heap = forward_ws.getHeap();
+    SearchHeap& backward_heap = backward_ws.getHeap();
+    
+    forward_ws.setDistance(start_index, 0.0);
+    backward_ws.setDistance(goal_index, 0.0);
+    double start_potential = use_potential ? averagePotential(start_node, start_node, goal_node) : 0.0;
+    double goal_potential = use_potential ? averagePotential(goal_node, start_node, goal_node) : 0.0;
+    forward_heap.push(start_index, start_potential);
+    backward_heap.push(goal_index, -goal_potential);
+    
+    double best = INF;
+    int meeting = -1;
+    if (start_index == goal_index) {
+        best = 0.0;
+        meeting = start_index;
     }
     
-    queue.enqueue(start);
-    visited[start] = true;
     int nodes_explored = 0;
     
-    while (!queue.isEmpty()) {
-        int current = queue.front();
-        queue.dequeue();
-        nodes_explored++;
-        
-        if (current == goal) {
-            result.path = reconstructPath(parent, start, goal);
-            result.path_found = true;
+    while (!forward_heap.isEmpty() && !backward_heap.isEmpty()) {
+        if (forward_heap.topPriority() + backward_heap.topPriority() >= best) {
             break;
         }
         
-        const LinkedList<Edge>& adjacencies = graph->getAdjacencies(current);
-        for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
-            int neighbor = (*it).getDestination();
-            if (!visited[neighbor]) {
-                visited[neighbor] = true;
-                parent[neighbor] = current;
-                queue.enqueue(neighbor);
+        // Expandir el lado con la frontera más pequeña
+        bool forward = forward_heap.getSize() <= backward_heap.getSize();
+        SearchWorkspace& ws = forward ? forward_ws : backward_ws;
+        SearchWorkspace& other_ws = forward ? backward_ws : forward_ws;
+        SearchHeap& heap = ws.getHeap();
+        
+        int u = heap.top();
+        heap.pop();
+        nodes_explored++;
+        
+        double distance_u = ws.getDistance(u);
+        const EdgeList& edges = forward ? graph->getAdjacenciesAt(u) : graph->getIncomingEdgesAt(u);
+        for (auto it = edges.begin(); it != edges.end(); ++it) {
+            int v = forward ? (*it).getDestinationIndex() : (*it).getSourceIndex();
+            double tentative = distance_u + (*it).getWeight();
+            
+            if (tentative < ws.getDistance(v)) {
+                ws.setDistance(v, tentative);
+                ws.setParent(v, u);
+                
+                double key = tentative;
+                if (use_potential) {
+                    double potential = averagePotential(&graph->getNodeAt(v), start_node, goal_node);
+                    key += forward ? potential : -potential;
+                }
+                heap.pushOrDecrease(v, key);
+                
+                // ¿El otro lado ya alcanzó v? Entonces hay un camino completo
+                double other_distance = other_ws.getDistance(v);
+                if (tentative + other_distance < best) {
+                    best = tentative + other_distance;
+                    meeting = v;
+                }
             }
         }
     }
     
-    // Calcular distancia total si se encontró un camino
-    if (result.path_found) {
-        result.total_distance = 0.0;
-        for (int i = 0; i < result.path.getSize() - 1; i++) {
-            result.total_distance += graph->getEdgeWeight(result.path[i], result.path[i + 1]);
+    if (meeting != -1) {
+        // start -> meeting con los padres del lado directo; meeting -> goal
+        // siguiendo los padres del lado inverso (apuntan hacia 'goal')
+        DynamicArray<int> index_path = reconstructPath(forward_ws, start_index, meeting);
+        int current = meeting;
+        while (current != goal_index) {
+            current = backward_ws.getParent(current);
+            index_path.push_back(current);
         }
+        result.path = toNodeIds(index_path);
+        result.path_found = true;
+        result.total_distance = best;
     }
     
     result.nodes_explored = nodes_explored;
@@ -157,28 +362,51 @@ SearchResult SearchAlgorithms::breadthFirstSearch(int start, int goal) {
     return result;
 }
 
-// Dijkstra
-SearchResult SearchAlgorithms::dijkstra(int start, int goal) {
+SearchResult SearchAlgorithms::bidirectionalDijkstra(int start, int goal) {
+    return bidirectionalSearch(start, goal, workspace, reverse_workspace, false);
+}
+
+SearchResult SearchAlgorithms::bidirectionalAStar(int start, int goal) {
+    return bidirectionalSearch(start, goal, workspace, reverse_workspace, true);
+}
+
+SearchResult SearchAlgorithms::bidirectionalDijkstra(int start, int goal, SearchWorkspace& forward_ws,
+                                                     SearchWorkspace& backward_ws) {
+    return bidirectionalSearch(start, goal, forward_ws, backward_ws, false);
+}
+
+SearchResult SearchAlgorithms::bidirectionalAStar(int start, int goal, SearchWorkspace& forward_ws,
+                                                  SearchWorkspace& backward_ws) {
+    return bidirectionalSearch(start, goal, forward_ws, backward_ws, true);
+}
+
+// Dijkstra de referencia con selección lineal del mínimo (O(V^2))
+SearchResult SearchAlgorithms::dijkstraLinearScan(int start, int goal) {
     auto start_time = std::chrono::high_resolution_clock::now();
     SearchResult result;
     
-    if (!graph->hasNode(start) || !graph->hasNode(goal)) {
+    // La referencia solo opera sobre Graph
+    if (!graph) {
+        return result;
+    }
+    
+    int start_index = graph->getNodeIndex(start);
+    int goal_index = graph->getNodeIndex(goal);
+    if (start_index == -1 || goal_index == -1) {
         return result;
     }
     
     const double INF = std::numeric_limits<double>::infinity();
-    DynamicArray<double> distance(graph->getNodeCount());
-    DynamicArray<int> parent(graph->getNodeCount());
-    DynamicArray<bool> visited(graph->getNodeCount());
+    DynamicArray<double> distance(0);
+    DynamicArray<int> parent(0);
+    DynamicArray<bool> visited(0);
     
     // Inicializar arrays
-    for (int i = 0; i < graph->getNodeCount(); i++) {
-        distance.push_back(INF);
-        parent.push_back(-1);
-        visited.push_back(false);
-    }
+    distance.resize(graph->getNodeCount(), INF);
+    parent.resize(graph->getNodeCount(), -1);
+    visited.resize(graph->getNodeCount(), false);
     
-    distance[start] = 0.0;
+    distance[start_index] = 0.0;
     int nodes_explored = 0;
     
     for (int count = 0; count < graph->getNodeCount(); count++) {
@@ -198,17 +426,17 @@ SearchResult SearchAlgorithms::dijkstra(int start, int goal) {
         visited[u] = true;
         nodes_explored++;
         
-        if (u == goal) {
-            result.path = reconstructPath(parent, start, goal);
+        if (u == goal_index) {
+            result.path = toNodeIds(reconstructPath(parent, start_index, goal_index));
             result.path_found = true;
-            result.total_distance = distance[goal];
+            result.total_distance = distance[goal_index];
             break;
         }
         
         // Relajar aristas adyacentes
-        const LinkedList<Edge>& adjacencies = graph->getAdjacencies(u);
+        const EdgeList& adjacencies = graph->getAdjacenciesAt(u);
         for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
-            int v = (*it).getDestination();
+            int v = (*it).getDestinationIndex();
             double weight = (*it).getWeight();
             
             if (!visited[v] && distance[u] + weight < distance[v]) {
@@ -225,137 +453,407 @@ SearchResult SearchAlgorithms::dijkstra(int start, int goal) {
     return result;
 }
 
-// Best First Search (Greedy)
-SearchResult SearchAlgorithms::bestFirstSearch(int start, int goal) {
-    auto start_time = std::chrono::high_resolution_clock::now();
-    SearchResult result;
+// ===== Consultas por coordenadas =====
+// Origen y destino se ajustan al nodo más cercano con un k-d tree: el de
+// Graph, o uno propio sobre las coordenadas del CSR construido en el
+// primer ajuste. En la cuadrícula implícita basta con redondear.
+
+int SearchAlgorithms::snapToNode(double x, double y) {
+    if (grid_graph) {
+        return grid_graph->findNearestNode(x, y);
+    }
+    if (!compact_graph) {
+        return graph->findNearestNode(x, y);
+    }
     
-    if (!graph->hasNode(start) || !graph->hasNode(goal)) {
+    if (compact_spatial_index.getSize() != compact_graph->getNodeCount()) {
+        int n = compact_graph->getNodeCount();
+        DynamicArray<double> xs(n > 0 ? n : 1);
+        DynamicArray<double> ys(n > 0 ? n : 1);
+        for (int i = 0; i < n; i++) {
+            xs.push_back(compact_graph->getX(i));
+            ys.push_back(compact_graph->getY(i));
+        }
+        compact_spatial_index.build(xs, ys);
+    }
+    int index = compact_spatial_index.nearest(x, y);
+    return index != -1 ? compact_graph->getNodeId(index) : -1;
+}
+
+SearchResult SearchAlgorithms::routeFromCoordinates(double start_x, double start_y,
+                                                    double goal_x, double goal_y) {
+    return routeFromCoordinates(start_x, start_y, goal_x, goal_y, workspace);
+}
+
+SearchResult SearchAlgorithms::routeFromCoordinates(double start_x, double start_y,
+                                                    double goal_x, double goal_y,
+                                                    SearchWorkspace& ws) {
+    int start = snapToNode(start_x, start_y);
+    int goal = snapToNode(goal_x, goal_y);
+    if (start == -1 || goal == -1) {
+        return SearchResult();
+    }
+    return aStar(start, goal, ws);
+}
+
+// ===== Árbol de caminos mínimos e isócronas =====
+// El padre de cada nodo se guarda en el workspace como la posición del
+// padre en el árbol (ya asentado), así el resultado no necesita arrays de
+// tamaño V.
+
+DynamicArray<int> ShortestPathTree::pathTo(int position) const {
+    DynamicArray<int> path;
+    for (int k = position; k != -1; k = parents[k]) {
+        path.push_back(nodes[k]);
+    }
+    reverseInPlace(path);
+    return path;
+}
+
+void SearchAlgorithms::growShortestPathTree(int source, double max_cost, SearchWorkspace& ws,
+                                            ShortestPathTree& tree) {
+    tree.source = -1;
+    tree.max_cost = max_cost;
+    
+    if (grid_graph) {
+        return;
+    }
+    int source_index = compact_graph ? compact_graph->getNodeIndex(source) : graph->getNodeIndex(source);
+    ws.prepare(compact_graph ? compact_graph->getNodeCount() : graph->getNodeCount());
+    if (source_index == -1 || max_cost < 0.0) {
+        return;
+    }
+    tree.source = source;
+    
+    SearchHeap& pq = ws.getHeap();
+    ws.setDistance(source_index, 0.0);
+    ws.setParent(source_index, -1);
+    pq.push(source_index, 0.0);
+    
+    while (!pq.isEmpty()) {
+        int u = pq.top();
+        double du = ws.getDistance(u);
+        if (du > max_cost) {
+            break;
+        }
+        pq.pop();
+        ws.setVisited(u);
+        
+        int position = tree.nodes.getSize();
+        tree.nodes.push_back(compact_graph ? compact_graph->getNodeId(u) : graph->getNodeId(u));
+        tree.distances.push_back(du);
+        tree.parents.push_back(ws.getParent(u));
+        
+        if (compact_graph) {
+            int end = compact_graph->edgesEnd(u);
+            for (int e = compact_graph->edgesBegin(u); e < end; e++) {
+                int v = compact_graph->getTarget(e);
+                double new_distance = du + compact_graph->getWeight(e);
+                if (!ws.isVisited(v) && new_distance < ws.getDistance(v)) {
+                    ws.setDistance(v, new_distance);
+                    ws.setParent(v, position);
+                    pq.pushOrDecrease(v, new_distance);
+                }
+            }
+        } else {
+            const EdgeList& adjacencies = graph->getAdjacenciesAt(u);
+            for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
+                int v = (*it).getDestinationIndex();
+                double new_distance = du + (*it).getWeight();
+                if (!ws.isVisited(v) && new_distance < ws.getDistance(v)) {
+                    ws.setDistance(v, new_distance);
+                    ws.setParent(v, position);
+                    pq.pushOrDecrease(v, new_distance);
+                }
+            }
+        }
+    }
+}
+
+ShortestPathTree SearchAlgorithms::shortestPathTree(int source, double max_cost) {
+    return shortestPathTree(source, max_cost, workspace);
+}
+
+ShortestPathTree SearchAlgorithms::shortestPathTree(int source, double max_cost, SearchWorkspace& ws) {
+    ShortestPathTree tree;
+    growShortestPathTree(source, max_cost, ws, tree);
+    return tree;
+}
+
+DynamicArray<Isochrone> SearchAlgorithms::isochrones(int source, const DynamicArray<double>& cost_limits) {
+    return isochrones(source, cost_limits, workspace);
+}
+
+DynamicArray<Isochrone> SearchAlgorithms::isochrones(int source, const DynamicArray<double>& cost_limits,
+                                                     SearchWorkspace& ws) {
+    int bands = cost_limits.getSize();
+    DynamicArray<Isochrone> result(bands > 0 ? bands : 1);
+    for (int b = 0; b < bands; b++) {
+        Isochrone isochrone;
+        isochrone.max_cost = cost_limits[b];
+        result.push_back(isochrone);
+    }
+    if (bands == 0) {
         return result;
     }
     
-    const Node* goal_node = graph->getNode(goal);
-    DynamicArray<bool> visited(graph->getNodeCount());
-    DynamicArray<int> parent(graph->getNodeCount());
-    PriorityQueue<AStarNode> pq;
+    double largest = cost_limits[0];
+    for (int b = 1; b < bands; b++) {
+        if (cost_limits[b] > largest) largest = cost_limits[b];
+    }
+    ShortestPathTree tree;
+    growShortestPathTree(source, largest, ws, tree);
     
-    // Inicializar arrays
-    for (int i = 0; i < graph->getNodeCount(); i++) {
-        visited.push_back(false);
-        parent.push_back(-1);
+    // Un nodo es borde de la zona b si tiene una arista hacia un nodo no
+    // asentado (su distancia supera el mayor límite) o asentado con
+    // distancia mayor que cost_limits[b]. Basta la mayor distancia entre
+    // sus vecinos: es borde de todas las zonas con límite menor que ella
+    const double INF = std::numeric_limits<double>::infinity();
+    for (int k = 0; k < tree.getSize(); k++) {
+        int u = compact_graph ? compact_graph->getNodeIndex(tree.nodes[k]) : graph->getNodeIndex(tree.nodes[k]);
+        double farthest = 0.0;
+        if (compact_graph) {
+            int end = compact_graph->edgesEnd(u);
+            for (int e = compact_graph->edgesBegin(u); e < end && farthest < INF; e++) {
+                int v = compact_graph->getTarget(e);
+                double dv = ws.isVisited(v) ? ws.getDistance(v) : INF;
+                if (dv > farthest) farthest = dv;
+            }
+        } else {
+            const EdgeList& adjacencies = graph->getAdjacenciesAt(u);
+            for (auto it = adjacencies.begin(); it != adjacencies.end() && farthest < INF; ++it) {
+                int v = (*it).getDestinationIndex();
+                double dv = ws.isVisited(v) ? ws.getDistance(v) : INF;
+                if (dv > farthest) farthest = dv;
+            }
+        }
+        
+        for (int b = 0; b < bands; b++) {
+            if (tree.distances[k] > cost_limits[b]) {
+                continue;
+            }
+            result[b].reachable_count++;
+            if (farthest > cost_limits[b]) {
+                result[b].boundary_nodes.push_back(tree.nodes[k]);
+            }
+        }
+    }
+    return result;
+}
+
+// ===== Matriz de distancias =====
+// Cada fila es un Dijkstra uno-a-muchos. is_target marca (por índice
+// interno) los destinos válidos; cuando se asentaron todos, sus
+// distancias ya son definitivas y la búsqueda termina. Los destinos que no
+// se alcanzan quedan en infinito.
+
+DistanceMatrix SearchAlgorithms::distanceMatrix(const DynamicArray<int>& sources,
+                                                const DynamicArray<int>& targets, int num_threads) {
+    DistanceMatrix matrix;
+    matrix.rows = sources.getSize();
+    matrix.cols = targets.getSize();
+    int cells = matrix.rows * matrix.cols;
+    matrix.distances = DynamicArray<double>(0);
+    matrix.distances.resize(cells, std::numeric_limits<double>::infinity());
+    if (cells == 0 || grid_graph) {
+        return matrix;
     }
     
-    const Node* start_node = graph->getNode(start);
-    double h = calculateDistance(start_node, goal_node);
-    pq.push(AStarNode(start, 0.0, h, -1));
+    // Destinos en índices internos, -1 si no existen; los repetidos se
+    // cuentan una sola vez
+    int node_count = compact_graph ? compact_graph->getNodeCount() : graph->getNodeCount();
+    DynamicArray<int> target_indices(matrix.cols);
+    DynamicArray<char> is_target(0);
+    is_target.resize(node_count, 0);
+    int distinct_targets = 0;
+    for (int j = 0; j < matrix.cols; j++) {
+        int index = compact_graph ? compact_graph->getNodeIndex(targets[j]) : graph->getNodeIndex(targets[j]);
+        target_indices.push_back(index);
+        if (index != -1 && !is_target[index]) {
+            is_target[index] = 1;
+            distinct_targets++;
+        }
+    }
+    
+    if (num_threads > matrix.rows) num_threads = matrix.rows;
+    if (num_threads < 1) num_threads = 1;
+    if (matrix_workspaces.getSize() < num_threads - 1) {
+        // Los workspaces existentes se mueven al crecer, no se copian
+        matrix_workspaces.resize(num_threads - 1);
+    }
     
+    // El hilo t calcula las filas t, t + hilos, ...; cada fila escribe solo
+    // sus propias celdas
+    DynamicArray<int> explored(0);
+    explored.resize(num_threads, 0);
+    double* cells_data = matrix.distances.begin();
+    parallelFor(num_threads, num_threads, [&](int t) {
+        SearchWorkspace& ws = t == 0 ? workspace : matrix_workspaces[t - 1];
+        for (int i = t; i < matrix.rows; i += num_threads) {
+            double* row = cells_data + static_cast<long long>(i) * matrix.cols;
+            explored[t] += compact_graph
+                ? compactMatrixRow(sources[i], target_indices, is_target, distinct_targets, ws, row)
+                : matrixRow(sources[i], target_indices, is_target, distinct_targets, ws, row);
+        }
+    });
+    for (int t = 0; t < num_threads; t++) {
+        matrix.nodes_explored += explored[t];
+    }
+    return matrix;
+}
+
+int SearchAlgorithms::matrixRow(int source, const DynamicArray<int>& targets, const DynamicArray<char>& is_target,
+                                int distinct_targets, SearchWorkspace& ws, double* row) const {
+    int source_index = graph->getNodeIndex(source);
+    if (source_index == -1 || distinct_targets == 0) {
+        return 0;
+    }
+    
+    ws.prepare(graph->getNodeCount());
+    SearchHeap& pq = ws.getHeap();
+    ws.setDistance(source_index, 0.0);
+    pq.push(source_index, 0.0);
     int nodes_explored = 0;
+    int remaining = distinct_targets;
     
     while (!pq.isEmpty()) {
-        AStarNode current = pq.top();
+        int u = pq.top();
         pq.pop();
-        
-        if (visited[current.node_id]) continue;
-        
-        visited[current.node_id] = true;
-        parent[current.node_id] = current.parent;
+        ws.setVisited(u);
         nodes_explored++;
-        
-        if (current.node_id == goal) {
-            result.path = reconstructPath(parent, start, goal);
-            result.path_found = true;
+        if (is_target[u] && --remaining == 0) {
             break;
         }
         
-        const LinkedList<Edge>& adjacencies = graph->getAdjacencies(current.node_id);
+        const EdgeList& adjacencies = graph->getAdjacenciesAt(u);
         for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
-            int neighbor = (*it).getDestination();
-            if (!visited[neighbor]) {
-                const Node* neighbor_node = graph->getNode(neighbor);
-                double h_neighbor = calculateDistance(neighbor_node, goal_node);
-                pq.push(AStarNode(neighbor, 0.0, h_neighbor, current.node_id));
+            int v = (*it).getDestinationIndex();
+            double new_distance = ws.getDistance(u) + (*it).getWeight();
+            if (!ws.isVisited(v) && new_distance < ws.getDistance(v)) {
+                ws.setDistance(v, new_distance);
+                pq.pushOrDecrease(v, new_distance);
             }
         }
     }
     
-    // Calcular distancia total si se encontró un camino
-    if (result.path_found) {
-        result.total_distance = 0.0;
-        for (int i = 0; i < result.path.getSize() - 1; i++) {
-            result.total_distance += graph->getEdgeWeight(result.path[i], result.path[i + 1]);
+    for (int j = 0; j < targets.getSize(); j++) {
+        if (targets[j] != -1 && ws.isVisited(targets[j])) {
+            row[j] = ws.getDistance(targets[j]);
         }
     }
+    return nodes_explored;
+}
+
+int SearchAlgorithms::compactMatrixRow(int source, const DynamicArray<int>& targets,
+                                       const DynamicArray<char>& is_target, int distinct_targets,
+                                       SearchWorkspace& ws, double* row) const {
+    int source_index = compact_graph->getNodeIndex(source);
+    if (source_index == -1 || distinct_targets == 0) {
+        return 0;
+    }
     
-    result.nodes_explored = nodes_explored;
-    auto end_time = std::chrono::high_resolution_clock::now();
-    result.time_taken = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    ws.prepare(compact_graph->getNodeCount());
+    SearchHeap& pq = ws.getHeap();
+    ws.setDistance(source_index, 0.0);
+    pq.push(source_index, 0.0);
+    int nodes_explored = 0;
+    int remaining = distinct_targets;
     
-    return result;
+    while (!pq.isEmpty()) {
+        int u = pq.top();
+        pq.pop();
+        ws.setVisited(u);
+        nodes_explored++;
+        if (is_target[u] && --remaining == 0) {
+            break;
+        }
+        
+        int end = compact_graph->edgesEnd(u);
+        for (int e = compact_graph->edgesBegin(u); e < end; e++) {
+            int v = compact_graph->getTarget(e);
+            double new_distance = ws.getDistance(u) + compact_graph->getWeight(e);
+            if (!ws.isVisited(v) && new_distance < ws.getDistance(v)) {
+                ws.setDistance(v, new_distance);
+                pq.pushOrDecrease(v, new_distance);
+            }
+        }
+    }
+    
+    for (int j = 0; j < targets.getSize(); j++) {
+        if (targets[j] != -1 && ws.isVisited(targets[j])) {
+            row[j] = ws.getDistance(targets[j]);
+        }
+    }
+    return nodes_explored;
 }
 
-// A* Search
-SearchResult SearchAlgorithms::aStar(int start, int goal) {
+// ===== ALT sobre CompactGraph (CSR) =====
+// Mismo comportamiento que la versión sobre Graph, pero los arrays se
+// indexan por índice interno y los vecinos se recorren de forma contigua.
+// 'start' y 'goal' son IDs externos; el camino retornado también.
+
+void SearchAlgorithms::finishCompactResult(SearchResult& result, const SearchWorkspace& ws,
+                                           int start_index, int goal_index, bool sum_edge_weights) const {
+    DynamicArray<int> index_path = reconstructPath(ws, start_index, goal_index);
+    
+    result.path_found = true;
+    result.path.clear();
+    for (int i = 0; i < index_path.getSize(); i++) {
+        result.path.push_back(compact_graph->getNodeId(index_path[i]));
+    }
+    
+    if (sum_edge_weights) {
+        result.total_distance = 0.0;
+        for (int i = 0; i < index_path.getSize() - 1; i++) {
+            result.total_distance += compact_graph->getEdgeWeight(index_path[i], index_path[i + 1]);
+        }
+    }
+}
+
+SearchResult SearchAlgorithms::compactAltSearch(int start, int goal, SearchWorkspace& ws) {
     auto start_time = std::chrono::high_resolution_clock::now();
     SearchResult result;
     
-    if (!graph->hasNode(start) || !graph->hasNode(goal)) {
+    if (!landmarks || landmarks->getNodeCount() != compact_graph->getNodeCount()) {
         return result;
     }
     
-    const Node* goal_node = graph->getNode(goal);
-    const double INF = std::numeric_limits<double>::infinity();
-    
-    DynamicArray<double> g_score(graph->getNodeCount());
-    DynamicArray<int> parent(graph->getNodeCount());
-    DynamicArray<bool> in_open_set(graph->getNodeCount());
-    PriorityQueue<AStarNode> open_set;
-    
-    // Inicializar arrays
-    for (int i = 0; i < graph->getNodeCount(); i++) {
-        g_score.push_back(INF);
-        parent.push_back(-1);
-        in_open_set.push_back(false);
+    int start_index = compact_graph->getNodeIndex(start);
+    int goal_index = compact_graph->getNodeIndex(goal);
+    if (start_index == -1 || goal_index == -1) {
+        return result;
     }
     
-    g_score[start] = 0.0;
-    const Node* start_node = graph->getNode(start);
-    double h = calculateDistance(start_node, goal_node);
-    open_set.push(AStarNode(start, 0.0, h, -1));
-    in_open_set[start] = true;
+    ws.prepare(compact_graph->getNodeCount());
+    SearchHeap& open_set = ws.getHeap();
+    
+    ws.setDistance(start_index, 0.0);
+    open_set.push(start_index, landmarks->lowerBound(start_index, goal_index));
     
     int nodes_explored = 0;
     
     while (!open_set.isEmpty()) {
-        AStarNode current = open_set.top();
+        int current = open_set.top();
         open_set.pop();
-        in_open_set[current.node_id] = false;
-        
+        ws.setVisited(current);
         nodes_explored++;
         
-        if (current.node_id == goal) {
-            parent[current.node_id] = current.parent;
-            result.path = reconstructPath(parent, start, goal);
-            result.path_found = true;
-            result.total_distance = g_score[goal];
+        if (current == goal_index) {
+            finishCompactResult(result, ws, start_index, goal_index, false);
+            result.total_distance = ws.getDistance(goal_index);
             break;
         }
         
-        const LinkedList<Edge>& adjacencies = graph->getAdjacencies(current.node_id);
-        for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
-            int neighbor = (*it).getDestination();
-            double weight = (*it).getWeight();
-            double tentative_g = g_score[current.node_id] + weight;
+        double g_current = ws.getDistance(current);
+        int end = compact_graph->edgesEnd(current);
+        for (int e = compact_graph->edgesBegin(current); e < end; e++) {
+            int neighbor = compact_graph->getTarget(e);
+            double tentative_g = g_current + compact_graph->getWeight(e);
             
-            if (tentative_g < g_score[neighbor]) {
-                parent[neighbor] = current.node_id;
-                g_score[neighbor] = tentative_g;
-                
-                if (!in_open_set[neighbor]) {
-                    const Node* neighbor_node = graph->getNode(neighbor);
-                    double h_neighbor = calculateDistance(neighbor_node, goal_node);
-                    open_set.push(AStarNode(neighbor, tentative_g, h_neighbor, current.node_id));
-                    in_open_set[neighbor] = true;
-                }
+            if (!ws.isVisited(neighbor) && tentative_g < ws.getDistance(neighbor)) {
+                ws.setParent(neighbor, current);
+                ws.setDistance(neighbor, tentative_g);
+                open_set.pushOrDecrease(neighbor, tentative_g + landmarks->lowerBound(neighbor, goal_index));
             }
         }
     }
@@ -377,6 +875,8 @@ void SearchAlgorithms::compareAlgorithms(int start, int goal) {
     SearchResult dijkstra_result = dijkstra(start, goal);
     SearchResult best_first = bestFirstSearch(start, goal);
     SearchResult a_star = aStar(start, goal);
+    SearchResult bi_dijkstra = bidirectionalDijkstra(start, goal);
+    SearchResult bi_astar = bidirectionalAStar(start, goal);
     
     std::cout << "\nResultados:" << std::endl;
     std::cout << "Algoritmo\t\tCamino\t\tDistancia\tNodos\tTiempo(ms)" << std::endl;
@@ -395,5 +895,13 @@ void SearchAlgorithms::compareAlgorithms(int start, int goal) {
     std::cout << "A*\t\t\t" << (a_star.path_found ? "Sí" : "No") << "\t\t" 
               << a_star.total_distance << "\t\t" << a_star.nodes_explored << "\t" 
               << a_star.time_taken.count() << std::endl;
+    if (graph) {
+        std::cout << "Dijkstra bidir.\t\t" << (bi_dijkstra.path_found ? "Sí" : "No") << "\t\t" 
+                  << bi_dijkstra.total_distance << "\t\t" << bi_dijkstra.nodes_explored << "\t" 
+                  << bi_dijkstra.time_taken.count() << std::endl;
+        std::cout << "A* bidir.\t\t" << (bi_astar.path_found ? "Sí" : "No") << "\t\t" 
+                  << bi_astar.total_distance << "\t\t" << bi_astar.nodes_explored << "\t" 
+                  << bi_astar.time_taken.count() << std::endl;
+    }
 }
 
@@ -0,0 +1,241 @@
+#include "../include/spatial_grid.h"
+#include <cmath>
+
+// Constructor
+SpatialGrid::SpatialGrid() : min_x(0.0), min_y(0.0), cell_size(1.0), columns(1), rows(1) {
+    cell_offsets.push_back(0);
+    cell_offsets.push_back(0);
+}
+
+// Funciones auxiliares: celda de una coordenada, recortada a la cuadrícula
+int SpatialGrid::columnFor(double x) const {
+    double column = std::floor((x - min_x) / cell_size);
+    if (column < 0.0) return 0;
+    if (column > columns - 1) return columns - 1;
+    return static_cast<int>(column);
+}
+
+int SpatialGrid::rowFor(double y) const {
+    double row = std::floor((y - min_y) / cell_size);
+    if (row < 0.0) return 0;
+    if (row > rows - 1) return rows - 1;
+    return static_cast<int>(row);
+}
+
+// Ajustar columnas y filas al tamaño de celda actual (false si excede el límite)
+bool SpatialGrid::fitCells(double width, double height, long long max_cells) {
+    double column_count = std::floor(width / cell_size) + 1.0;
+    double row_count = std::floor(height / cell_size) + 1.0;
+    if (column_count * row_count > static_cast<double>(max_cells)) {
+        return false;
+    }
+    columns = static_cast<int>(column_count);
+    rows = static_cast<int>(row_count);
+    return true;
+}
+
+// Celda de cada punto y conteo por celda (cell_offsets[c + 1] = conteo de c)
+void SpatialGrid::countCells(DynamicArray<int>& cell_of) {
+    int cell_count = columns * rows;
+    cell_offsets = DynamicArray<int>(cell_count + 1);
+    for (int c = 0; c <= cell_count; c++) {
+        cell_offsets.push_back(0);
+    }
+    cell_of.clear();
+    for (int i = 0; i < xs.getSize(); i++) {
+        int cell = rowFor(ys[i]) * columns + columnFor(xs[i]);
+        cell_of.push_back(cell);
+        cell_offsets[cell + 1]++;
+    }
+}
+
+// Construir sobre las posiciones de 'nodes'
+void SpatialGrid::build(const DynamicArray<Node>& nodes, double requested_cell_size) {
+    int n = nodes.getSize();
+    xs = DynamicArray<double>(n > 0 ? n : 1);
+    ys = DynamicArray<double>(n > 0 ? n : 1);
+
+    double max_x = 0.0, max_y = 0.0;
+    min_x = 0.0;
+    min_y = 0.0;
+    for (int i = 0; i < n; i++) {
+        double x = nodes[i].getX();
+        double y = nodes[i].getY();
+        xs.push_back(x);
+        ys.push_back(y);
+        if (i == 0 || x < min_x) min_x = x;
+        if (i == 0 || y < min_y) min_y = y;
+        if (i == 0 || x > max_x) max_x = x;
+        if (i == 0 || y > max_y) max_y = y;
+    }
+
+    double width = max_x - min_x;
+    double height = max_y - min_y;
+    bool automatic = requested_cell_size <= 0.0;
+    cell_size = requested_cell_size;
+    if (automatic && n > 0) {
+        // ~1 punto por celda si estuvieran distribuidos uniformemente
+        cell_size = std::sqrt(width * height / n);
+        if (cell_size <= 0.0) {
+            cell_size = (width > height ? width : height) / n;
+        }
+    }
+    if (cell_size <= 0.0) {
+        cell_size = 1.0;
+    }
+
+    // Limitar el número de celdas a O(n) (rectángulos muy alargados o
+    // tamaños de celda pedidos demasiado pequeños)
+    long long max_cells = 4LL * n + 16;
+    while (!fitCells(width, height, max_cells)) {
+        cell_size *= 2.0;
+    }
+    DynamicArray<int> cell_of(n > 0 ? n : 1);
+    countCells(cell_of);
+
+    // Con puntos agrupados, la ocupación que ve un punto típico (suma de
+    // cuadrados de los conteos / n) es mucho mayor que el promedio: se
+    // reducen las celdas mientras el límite de celdas lo permita
+    while (automatic && n > 0) {
+        double seen_occupancy = 0.0;
+        for (int c = 0; c < columns * rows; c++) {
+            double count = cell_offsets[c + 1];
+            seen_occupancy += count * count;
+        }
+        seen_occupancy /= n;
+        if (seen_occupancy <= TARGET_OCCUPANCY) break;
+
+        // Se deshace si excede el límite o no separa nada (puntos repetidos)
+        int previous_cells = columns * rows;
+        cell_size /= 2.0;
+        if (!fitCells(width, height, max_cells) || columns * rows == previous_cells) {
+            cell_size *= 2.0;
+            fitCells(width, height, max_cells);
+            countCells(cell_of);
+            break;
+        }
+        countCells(cell_of);
+    }
+
+    // Suma prefija y reparto de los índices
+    int cell_count = columns * rows;
+    for (int c = 0; c < cell_count; c++) {
+        cell_offsets[c + 1] += cell_offsets[c];
+    }
+
+    cell_items = DynamicArray<int>(n > 0 ? n : 1);
+    for (int i = 0; i < n; i++) {
+        cell_items.push_back(0);
+    }
+    DynamicArray<int> next(cell_count);
+    for (int c = 0; c < cell_count; c++) {
+        next.push_back(cell_offsets[c]);
+    }
+    for (int i = 0; i < n; i++) {
+        cell_items[next[cell_of[i]]++] = i;
+    }
+
+    // Las coordenadas se reordenan por celda: recorrer una celda lee memoria
+    // contigua en lugar de saltar por todo el array de puntos
+    DynamicArray<double> cell_xs(n > 0 ? n : 1);
+    DynamicArray<double> cell_ys(n > 0 ? n : 1);
+    for (int p = 0; p < n; p++) {
+        cell_xs.push_back(xs[cell_items[p]]);
+        cell_ys.push_back(ys[cell_items[p]]);
+    }
+    xs = cell_xs;
+    ys = cell_ys;
+}
+
+// Los k puntos más cercanos a (x, y) a distancia <= max_distance
+int SpatialGrid::kNearest(double x, double y, int k, double max_distance, int exclude,
+                          DynamicArray<std::pair<double, int>>& neighbors) const {
+    neighbors.clear();
+    if (k <= 0 || xs.getSize() == 0) {
+        return 0;
+    }
+
+    // Durante la búsqueda 'neighbors' guarda distancias al cuadrado (mismo
+    // orden, sin raíces); se convierten al final
+    int center_column = columnFor(x);
+    int center_row = rowFor(y);
+    int max_ring = columns > rows ? columns : rows;
+    double limit = max_distance * max_distance;   // Se reduce al k-ésimo encontrado
+
+    for (int ring = 0; ring <= max_ring; ring++) {
+        // Distancia mínima a cualquier celda del anillo: la del punto al borde
+        // del bloque de anillos ya recorridos (si el punto está fuera de la
+        // cuadrícula, proyectarlo sobre el rectángulo no aumenta distancias)
+        if (ring > 0) {
+            double left = x - (min_x + (center_column - ring + 1) * cell_size);
+            double right = (min_x + (center_column + ring) * cell_size) - x;
+            double bottom = y - (min_y + (center_row - ring + 1) * cell_size);
+            double top = (min_y + (center_row + ring) * cell_size) - y;
+            double gap = left;
+            if (right < gap) gap = right;
+            if (bottom < gap) gap = bottom;
+            if (top < gap) gap = top;
+            if (gap > 0.0 && gap * gap > limit) break;
+        }
+
+        int row_begin = center_row - ring < 0 ? 0 : center_row - ring;
+        int row_end = center_row + ring > rows - 1 ? rows - 1 : center_row + ring;
+        for (int row = row_begin; row <= row_end; row++) {
+            bool full_row = row == center_row - ring || row == center_row + ring;
+            int step = full_row || ring == 0 ? 1 : 2 * ring;
+            for (int column = center_column - ring; column <= center_column + ring; column += step) {
+                if (column < 0 || column >= columns) continue;
+
+                // Omitir celdas completas más lejanas que el límite actual
+                double cell_x = min_x + column * cell_size;
+                double cell_y = min_y + row * cell_size;
+                double dx = x < cell_x ? cell_x - x : (x > cell_x + cell_size ? x - cell_x - cell_size : 0.0);
+                double dy = y < cell_y ? cell_y - y : (y > cell_y + cell_size ? y - cell_y - cell_size : 0.0);
+                if (dx * dx + dy * dy > limit) continue;
+
+                int cell = row * columns + column;
+                for (int p = cell_offsets[cell]; p < cell_offsets[cell + 1]; p++) {
+                    double px = xs[p] - x;
+                    double py = ys[p] - y;
+                    double squared = px * px + py * py;
+                    if (squared > limit || cell_items[p] == exclude) continue;
+
+                    // Inserción ordenada en la lista de los k mejores
+                    std::pair<double, int> candidate(squared, cell_items[p]);
+                    if (neighbors.getSize() == k) {
+                        if (!(candidate < neighbors[k - 1])) continue;
+                        neighbors[k - 1] = candidate;
+                    } else {
+                        neighbors.push_back(candidate);
+                    }
+                    for (int j = neighbors.getSize() - 1; j > 0 && neighbors[j] < neighbors[j - 1]; j--) {
+                        std::pair<double, int> temp = neighbors[j];
+                        neighbors[j] = neighbors[j - 1];
+                        neighbors[j - 1] = temp;
+                    }
+                    if (neighbors.getSize() == k) {
+                        limit = neighbors[k - 1].first;
+                    }
+                }
+            }
+        }
+    }
+
+    for (int j = 0; j < neighbors.getSize(); j++) {
+        neighbors[j].first = std::sqrt(neighbors[j].first);
+    }
+    return neighbors.getSize();
+}
+
+// Información
+int SpatialGrid::getItemCount() const {
+    return xs.getSize();
+}
+
+int SpatialGrid::getCellCount() const {
+    return columns * rows;
+}
+
+double SpatialGrid::getCellSize() const {
+    return cell_size;
+}
@@ -1,8 +1,18 @@
 #include "../include/test_suite.h"
 #include "../include/map_loader.h"
 #include "../include/performance_analyzer.h"
+#include "../include/query_executor.h"
+#include "../include/delta_stepping.h"
+#include "../include/jump_point_search.h"
+#include "../include/graph_search.h"
+#include "../include/node_reordering.h"
+#include "../include/ring_queue.h"
 #include <iostream>
+#include <fstream>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
 
 // Constructor
 TestSuite::TestSuite() : tests_passed(0), tests_failed(0), total_tests(0) {}
@@ -35,6 +45,20 @@ void TestSuite::print_test_result(const std::string& test_name, bool passed) {
     std::cout << "[" << (passed ? "PASS" : "FAIL") << "] " << test_name << std::endl;
 }
 
+// Buscar un archivo de datos_prueba desde los directorios de ejecución habituales
+std::string TestSuite::findTestDataFile(const std::string& filename) const {
+    const char* prefixes[] = {"datos_prueba/", "../datos_prueba/", "../../datos_prueba/",
+                              "entregables/datos_prueba/", ""};
+    for (int i = 0; i < 5; i++) {
+        std::string path = std::string(prefixes[i]) + filename;
+        std::ifstream file(path.c_str(), std::ios::binary);
+        if (file.is_open()) {
+            return path;
+        }
+    }
+    return "";
+}
+
 // Método principal de testing
 void TestSuite::runAllTests() {
     std::cout << "=== EJECUTANDO SUITE DE PRUEBAS ===" << std::endl;
@@ -44,17 +68,41 @@ void TestSuite::runAllTests() {
     testDynamicArray();
     testLinkedList();
     testQueue();
+    testRingQueue();
     testPriorityQueue();
+    testIndexedPriorityQueue();
+    testHashIndex();
     testGraphBasicOperations();
     testGraphConnectivity();
     testGraphEdgeWeights();
+    testCompactGraph();
+    testMappedCompactGraph();
     testSearchAlgorithmsSmallGraph();
     testSearchAlgorithmsDisconnectedGraph();
     testSearchAlgorithmsOptimality();
+    testDijkstraHeapMatchesLinearScan();
+    testSearchWorkspaceReuse();
+    testBidirectionalSearch();
+    testLandmarksAlt();
+    testContractionHierarchy();
+    testDistanceMatrix();
+    testQueryExecutor();
+    testDeltaStepping();
+    testShortestPathTree();
+    testJumpPointSearch();
+    testImplicitGridGraph();
+    testGraphSearchPolicies();
+    testSparseNodeIds();
+    testNodeReordering();
+    testNodePool();
     testLargeGraphGeneration();
+    testSpatialGrid();
+    testKdTree();
     testGraphSaveLoad();
     testEdgeCases();
     testDataValidation();
+    testCSVLoading();
+    testParallelCSVLoading();
     
     printSummary();
 }
@@ -90,6 +138,40 @@ void TestSuite::testDynamicArray() {
     arr.clear();
     assert_true(arr.isEmpty(), "Array vacío después de clear");
     assert_equals(0, arr.getSize(), "Tamaño 0 después de clear");
+    
+    // reserve y resize: una sola reserva, relleno con el valor dado
+    DynamicArray<int> filled(0);
+    filled.reserve(100);
+    assert_true(filled.getCapacity() == 100 && filled.isEmpty(), "reserve no construye elementos");
+    filled.resize(50, 7);
+    filled.resize(60, -1);
+    assert_true(filled.getSize() == 60 && filled[49] == 7 && filled[50] == -1 && filled.getCapacity() == 100,
+                "resize rellena las posiciones nuevas");
+    filled.resize(10);
+    assert_equals(10, filled.getSize(), "resize reduce el tamaño");
+    
+    // Elementos con memoria propia (std::string en Node)
+    DynamicArray<Node> nodes(2);
+    nodes.emplace_back(1, "Uno", 1.0, 2.0);
+    nodes.emplace_back(2, "Dos");
+    nodes.emplace_back(3, "Tres");
+    nodes.push_back(nodes[0]); // Referencia al propio array mientras crece
+    assert_true(nodes.getSize() == 4 && nodes[2].getName() == "Tres" && nodes[3].getName() == "Uno" &&
+                nodes[3].getY() == 2.0, "emplace_back y push_back al crecer");
+    DynamicArray<Node> copy(nodes);
+    copy[0].setName("Cambiado");
+    assert_true(nodes[0].getName() == "Uno", "La copia es independiente");
+    DynamicArray<Node> moved(std::move(copy));
+    assert_true(moved.getSize() == 4 && copy.getSize() == 0 && moved[0].getName() == "Cambiado",
+                "El movimiento toma los elementos sin copiarlos");
+    copy.push_back(Node(5, "Cinco"));
+    assert_true(copy.getSize() == 1 && copy[0].getId() == 5, "Un array movido se puede reutilizar");
+    moved = std::move(nodes);
+    assert_true(moved.getSize() == 4 && moved[0].getName() == "Uno", "Asignación por movimiento");
+    moved.pop_back();
+    moved.clear();
+    moved.emplace_back(9, "Nueve");
+    assert_true(moved.getSize() == 1 && moved[0].getName() == "Nueve", "clear conserva el bloque para reutilizarlo");
 }
 
 void TestSuite::testLinkedList() {
@@ -153,6 +235,59 @@ void TestSuite::testQueue() {
     assert_true(queue.isEmpty(), "Cola vacía después de dequeue todos");
 }
 
+void TestSuite::testRingQueue() {
+    std::cout << "\n--- Tests de RingQueue ---" << std::endl;
+    
+    RingQueue<int> queue(4);
+    assert_true(queue.isEmpty(), "RingQueue inicialmente vacía");
+    assert_equals(4, queue.getCapacity(), "RingQueue: capacidad inicial");
+    
+    // El frente avanza por el buffer y los índices dan la vuelta
+    for (int i = 0; i < 3; i++) {
+        queue.enqueue(i);
+    }
+    queue.dequeue();
+    queue.dequeue();
+    queue.enqueue(3);
+    queue.enqueue(4);
+    queue.enqueue(5);
+    assert_equals(4, queue.getCapacity(), "RingQueue: reutiliza las posiciones liberadas");
+    assert_equals(2, queue.front(), "RingQueue: frente tras dar la vuelta");
+    assert_equals(5, queue.rear(), "RingQueue: último tras dar la vuelta");
+    
+    // Crecer con el contenido envuelto conserva el orden FIFO
+    for (int i = 6; i < 20; i++) {
+        queue.enqueue(i);
+    }
+    assert_equals(32, queue.getCapacity(), "RingQueue: la capacidad crece en potencias de 2");
+    RingQueue<int> copy(queue);
+    bool fifo = true;
+    for (int expected = 2; expected < 20; expected++) {
+        fifo = fifo && queue.front() == expected;
+        queue.dequeue();
+    }
+    assert_true(fifo && queue.isEmpty(), "RingQueue: orden FIFO al crecer");
+    assert_true(copy.getSize() == 18 && copy.front() == 2 && copy.rear() == 19, "RingQueue: copia");
+    
+    RingQueue<int> reserved;
+    reserved.reserve(1000);
+    assert_equals(1024, reserved.getCapacity(), "RingQueue: reserve redondea a potencia de 2");
+    for (int i = 0; i < 1000; i++) {
+        reserved.enqueue(i);
+    }
+    assert_equals(1024, reserved.getCapacity(), "RingQueue: sin redimensionar dentro de lo reservado");
+    reserved.clear();
+    assert_true(reserved.isEmpty() && reserved.getCapacity() == 1024, "RingQueue: clear conserva la capacidad");
+    
+    bool thrown = false;
+    try {
+        reserved.front();
+    } catch (const char*) {
+        thrown = true;
+    }
+    assert_true(thrown, "RingQueue: front en cola vacía lanza excepción");
+}
+
 void TestSuite::testPriorityQueue() {
     std::cout << "\n--- Tests de PriorityQueue ---" << std::endl;
     
@@ -176,6 +311,120 @@ void TestSuite::testPriorityQueue() {
     assert_equals(20, pq.top(), "Siguiente elemento con menor prioridad");
 }
 
+void TestSuite::testIndexedPriorityQueue() {
+    std::cout << "\n--- Tests de IndexedPriorityQueue ---" << std::endl;
+    
+    IndexedPriorityQueue<double, 4> pq(10);
+    
+    // Test de cola vacía
+    assert_true(pq.isEmpty(), "Cola indexada inicialmente vacía");
+    assert_false(pq.contains(3), "Índice 3 no está en la cola");
+    
+    // Test de inserción
+    pq.push(3, 30.0);
+    pq.push(7, 10.0);
+    pq.push(1, 20.0);
+    pq.push(9, 40.0);
+    
+    assert_equals(4, pq.getSize(), "Tamaño después de push");
+    assert_equals(7, pq.top(), "Índice con menor prioridad al tope");
+    assert_true(pq.contains(9), "Índice 9 está en la cola");
+    assert_equals(40.0, pq.priorityOf(9), "Prioridad de índice 9");
+    
+    // Test de decreaseKey
+    pq.decreaseKey(9, 5.0);
+    assert_equals(9, pq.top(), "decreaseKey lleva el índice al tope");
+    assert_false(pq.pushOrDecrease(1, 25.0), "pushOrDecrease ignora prioridades mayores");
+    assert_true(pq.pushOrDecrease(1, 1.0), "pushOrDecrease aplica prioridades menores");
+    assert_equals(1, pq.top(), "Nuevo mínimo tras pushOrDecrease");
+    
+    // Test de extracción en orden
+    pq.pop();
+    pq.pop();
+    assert_equals(7, pq.top(), "Extracción en orden de prioridad");
+    assert_false(pq.contains(1), "Índice extraído ya no está en la cola");
+    
+    // Test de changePriority (aumentar la prioridad del mínimo lo hunde)
+    pq.changePriority(7, 35.0);
+    assert_equals(3, pq.top(), "changePriority hacia arriba reordena el heap");
+    pq.changePriority(7, 0.5);
+    assert_equals(7, pq.top(), "changePriority hacia abajo reordena el heap");
+    
+    // Test de ordenamiento con aridades 2 y 8
+    IndexedPriorityQueue<double, 2> binary_heap(100);
+    IndexedPriorityQueue<double, 8> octal_heap(100);
+    for (int i = 0; i < 100; i++) {
+        double priority = (i * 37) % 100;
+        binary_heap.push(i, priority);
+        octal_heap.push(i, priority);
+    }
+    bool ordered = true;
+    double last = -1.0;
+    while (!binary_heap.isEmpty()) {
+        double current = binary_heap.topPriority();
+        if (current < last || current != octal_heap.topPriority()) ordered = false;
+        last = current;
+        binary_heap.pop();
+        octal_heap.pop();
+    }
+    assert_true(ordered, "Heaps de aridad 2 y 8 extraen en el mismo orden");
+    
+    // Test de limpieza
+    pq.clear();
+    assert_true(pq.isEmpty(), "Cola indexada vacía después de clear");
+    assert_false(pq.contains(3), "clear elimina los índices restantes");
+}
+
+void TestSuite::testHashIndex() {
+    std::cout << "\n--- Tests de HashIndex ---" << std::endl;
+    
+    HashIndex index;
+    
+    // Test de tabla vacía
+    assert_true(index.isEmpty(), "Índice inicialmente vacío");
+    assert_equals(-1, index.find(42), "Clave inexistente retorna -1");
+    
+    // Test de inserción con rehash (más claves que la capacidad inicial)
+    for (int i = 0; i < 1000; i++) {
+        index.insert(i * 7, i);
+    }
+    assert_equals(1000, index.getSize(), "1000 claves insertadas");
+    assert_equals(500, index.find(3500), "Búsqueda tras rehash");
+    assert_false(index.contains(3501), "Clave no insertada no existe");
+    
+    // Test de claves negativas y actualización
+    index.insert(-5, 77);
+    assert_equals(77, index.find(-5), "Clave negativa soportada");
+    index.insert(-5, 78);
+    assert_equals(78, index.find(-5), "Actualizar valor de clave existente");
+    assert_equals(1001, index.getSize(), "Actualizar no incrementa tamaño");
+    
+    // Test de limpieza
+    index.clear();
+    assert_true(index.isEmpty(), "Índice vacío después de clear");
+    assert_equals(-1, index.find(0), "Claves eliminadas después de clear");
+    
+    // Test de grafo con IDs dispersos
+    Graph graph;
+    graph.addNode(Node(1000, "A", 0, 0));
+    graph.addNode(Node(5, "B", 1, 1));
+    graph.addNode(Node(99999, "C", 2, 2));
+    graph.addEdge(99999, 1000, 3.0);
+    
+    assert_true(graph.getNode(5) != nullptr && graph.getNode(5)->getName() == "B", "getNode con ID disperso");
+    assert_equals(3.0, graph.getEdgeWeight(99999, 1000), "Peso de arista con IDs dispersos");
+    
+    // Test del ID reservado: addNode lo rechaza en lugar de lanzar
+    assert_false(graph.addNode(Node(INT_MIN, "Reservado", 3, 3)), "addNode rechaza el ID INT_MIN");
+    assert_equals(3, graph.getNodeCount(), "ID reservado no agrega nodo");
+    assert_false(graph.hasNode(INT_MIN), "ID reservado no existe en el grafo");
+    assert_true(graph.addNode(Node(INT_MIN + 1, "D", 4, 4)), "ID INT_MIN + 1 aceptado");
+    assert_true(graph.addNode(Node(INT_MAX, "E", 5, 5)), "ID INT_MAX aceptado");
+    assert_true(graph.hasNode(INT_MIN + 1) && graph.hasNode(INT_MAX), "IDs extremos indexados");
+    graph.clear();
+    assert_false(graph.hasNode(1000), "Índice del grafo limpiado con clear");
+}
+
 // Tests de grafo
 void TestSuite::testGraphBasicOperations() {
     std::cout << "\n--- Tests de Operaciones Básicas de Grafo ---" << std::endl;
@@ -269,6 +518,132 @@ void TestSuite::testGraphEdgeWeights() {
     assert_equals(3, result.path.getSize(), "Camino tiene 3 nodos");
 }
 
+void TestSuite::testCompactGraph() {
+    std::cout << "\n--- Tests de CompactGraph (CSR) ---" << std::endl;
+    
+    Graph graph;
+    MapLoader::createArequipaMap(graph);
+    CompactGraph compact(graph);
+    
+    // Test de estructura
+    assert_equals(graph.getNodeCount(), compact.getNodeCount(), "CSR conserva número de nodos");
+    assert_equals(graph.getEdgeCount(), compact.getEdgeCount(), "CSR conserva número de aristas");
+    assert_true(compact.hasNode(14), "CSR contiene nodo 14");
+    assert_false(compact.hasNode(15), "CSR no contiene nodo 15");
+    
+    int plaza = compact.getNodeIndex(0);
+    int unsa = compact.getNodeIndex(1);
+    assert_equals(0, compact.getNodeId(plaza), "Traducción índice -> ID");
+    assert_equals(2.2, compact.getEdgeWeight(plaza, unsa), "Peso de arista en CSR");
+    assert_equals(graph.getAdjacencies(0).getSize(),
+                  compact.edgesEnd(plaza) - compact.edgesBegin(plaza), "Grado de salida en CSR");
+    
+    // Los cinco algoritmos deben comportarse igual sobre Graph y sobre CSR
+    SearchAlgorithms search(&graph);
+    SearchAlgorithms compact_search(&compact);
+    
+    int start = 4, goal = 5; // Terminal -> Aeropuerto
+    SearchResult graph_results[5] = {
+        search.depthFirstSearch(start, goal), search.breadthFirstSearch(start, goal),
+        search.dijkstra(start, goal), search.bestFirstSearch(start, goal), search.aStar(start, goal)
+    };
+    SearchResult compact_results[5] = {
+        compact_search.depthFirstSearch(start, goal), compact_search.breadthFirstSearch(start, goal),
+        compact_search.dijkstra(start, goal), compact_search.bestFirstSearch(start, goal),
+        compact_search.aStar(start, goal)
+    };
+    const char* names[5] = {"DFS", "BFS", "Dijkstra", "Best First", "A*"};
+    
+    for (int i = 0; i < 5; i++) {
+        bool same_path = graph_results[i].path.getSize() == compact_results[i].path.getSize();
+        for (int j = 0; same_path && j < graph_results[i].path.getSize(); j++) {
+            same_path = graph_results[i].path[j] == compact_results[i].path[j];
+        }
+        assert_true(compact_results[i].path_found && same_path,
+                    std::string(names[i]) + " sobre CSR retorna el mismo camino");
+        assert_equals(graph_results[i].total_distance, compact_results[i].total_distance,
+                      std::string(names[i]) + " sobre CSR retorna la misma distancia");
+    }
+    
+    // Test de nodo inexistente
+    SearchResult missing = compact_search.breadthFirstSearch(0, 999);
+    assert_false(missing.path_found, "CSR: no hay camino a nodo inexistente");
+}
+
+// Tests del formato binario proyectable de CompactGraph
+void TestSuite::testMappedCompactGraph() {
+    std::cout << "\n--- Tests de CompactGraph Proyectado (mmap) ---" << std::endl;
+    
+    Graph graph;
+    MapLoader::createArequipaMap(graph);
+    CompactGraph compact(graph);
+    
+    std::string filename = "test_graph.csr";
+    assert_true(compact.saveToBinary(filename), "CSR guardado en formato binario");
+    
+    CompactGraph mapped;
+    assert_true(mapped.mapFromBinary(filename), "CSR proyectado desde archivo");
+    assert_true(mapped.isMapped() && !compact.isMapped(), "Solo el grafo abierto está proyectado");
+    assert_equals(compact.getNodeCount(), mapped.getNodeCount(), "Proyectado conserva número de nodos");
+    assert_equals(compact.getEdgeCount(), mapped.getEdgeCount(), "Proyectado conserva número de aristas");
+    
+    bool same_nodes = true;
+    const DynamicArray<Node>& nodes = graph.getAllNodes();
+    for (int i = 0; i < nodes.getSize(); i++) {
+        int index = mapped.getNodeIndex(nodes[i].getId());
+        same_nodes = same_nodes && index == i && mapped.getName(index) == nodes[i].getName() &&
+                     mapped.getX(index) == nodes[i].getX() && mapped.getY(index) == nodes[i].getY();
+    }
+    assert_true(same_nodes, "IDs, nombres y coordenadas leídos del archivo");
+    assert_false(mapped.hasNode(999), "Índice hash proyectado: nodo inexistente");
+    
+    SearchAlgorithms compact_search(&compact);
+    SearchAlgorithms mapped_search(&mapped);
+    SearchResult expected = compact_search.dijkstra(4, 5);
+    SearchResult actual = mapped_search.dijkstra(4, 5);
+    assert_true(actual.path_found && actual.path.getSize() == expected.path.getSize(),
+                "Dijkstra sobre el archivo proyectado encuentra el mismo camino");
+    assert_equals(expected.total_distance, actual.total_distance, "Misma distancia sobre el archivo proyectado");
+    
+    // Copiar un grafo proyectado vuelve a proyectar el mismo archivo
+    CompactGraph copy(mapped);
+    assert_true(copy.isMapped(), "La copia de un grafo proyectado también está proyectada");
+    assert_equals(mapped.getEdgeWeight(0, 1), copy.getEdgeWeight(0, 1), "La copia lee los mismos pesos");
+    
+    // Reconstruir desde un Graph vuelve al almacenamiento propio
+    copy.build(graph);
+    assert_false(copy.isMapped(), "build libera la proyección");
+    assert_equals(compact.getEdgeCount(), copy.getEdgeCount(), "build tras proyectar conserva aristas");
+    
+    // Archivos inválidos
+    std::string classic = "test_graph_classic.bin";
+    LargeGraphGenerator::saveGraphToBinary(graph, classic);
+    CompactGraph rejected;
+    assert_false(rejected.mapFromBinary(classic), "Rechaza el formato binario clásico");
+    std::remove(classic.c_str());
+    
+    std::string truncated = "test_graph_truncated.csr";
+    {
+        std::ifstream in(filename, std::ios::binary);
+        std::ofstream out(truncated, std::ios::binary);
+        char buffer[200];
+        in.read(buffer, sizeof(buffer));
+        out.write(buffer, in.gcount());
+    }
+    assert_false(rejected.mapFromBinary(truncated), "Rechaza un archivo truncado");
+    std::remove(truncated.c_str());
+    
+    {
+        std::fstream patch(filename, std::ios::binary | std::ios::in | std::ios::out);
+        unsigned int future_version = 99;
+        patch.seekp(4);
+        patch.write(reinterpret_cast<const char*>(&future_version), sizeof(future_version));
+    }
+    assert_false(rejected.mapFromBinary(filename), "Rechaza una versión de formato desconocida");
+    assert_false(rejected.isMapped(), "Un archivo rechazado no queda proyectado");
+    std::remove(filename.c_str());
+}
+
 // Tests de algoritmos de búsqueda
 void TestSuite::testSearchAlgorithmsSmallGraph() {
     std::cout << "\n--- Tests de Algoritmos en Grafo Pequeño ---" << std::endl;
@@ -359,6 +734,1577 @@ void TestSuite::testSearchAlgorithmsOptimality() {
     assert_true(astar.total_distance <= 3.0, "A* encuentra camino razonablemente bueno");
 }
 
+void TestSuite::testDijkstraHeapMatchesLinearScan() {
+    std::cout << "\n--- Tests de Dijkstra con Heap vs Selección Lineal ---" << std::endl;
+    
+    const char* files[] = {"grid_10k.dat", "city_5k.dat"};
+    
+    for (int f = 0; f < 2; f++) {
+        std::string path = findTestDataFile(files[f]);
+        assert_true(!path.empty(), std::string("Archivo de prueba encontrado: ") + files[f]);
+        if (path.empty()) continue;
+        
+        Graph graph;
+        LargeGraphGenerator::loadGraphFromBinary(graph, path);
+        SearchAlgorithms search(&graph);
+        
+        int n = graph.getNodeCount();
+        
+        // Pares de prueba: el primero puede ser inalcanzable; en los demás el
+        // destino se obtiene con un recorrido pseudoaleatorio (semilla fija)
+        // desde el origen, de modo que siempre existe un camino
+        int pairs[5][2] = {{0, n - 1}, {n / 4, -1}, {n / 2, -1}, {3 * n / 4, -1}, {n - 1, -1}};
+        unsigned int seed = 12345;
+        for (int p = 1; p < 5; p++) {
+            int current = pairs[p][0];
+            for (int step = 0; step < 500; step++) {
+                DynamicArray<int> neighbors = graph.getNeighbors(current);
+                if (neighbors.isEmpty()) break;
+                seed = seed * 1103515245u + 12345u;
+                current = neighbors[(seed >> 16) % neighbors.getSize()];
+            }
+            pairs[p][1] = current;
+        }
+        
+        for (int p = 0; p < 5; p++) {
+            int start = pairs[p][0];
+            int goal = pairs[p][1];
+            SearchResult heap_result = search.dijkstra(start, goal);
+            SearchResult scan_result = search.dijkstraLinearScan(start, goal);
+            
+            std::string label = std::string(files[f]) + " " + std::to_string(start) + "->" + std::to_string(goal);
+            assert_true(heap_result.path_found == scan_result.path_found, label + ": misma alcanzabilidad");
+            assert_equals(scan_result.total_distance, heap_result.total_distance, label + ": misma distancia");
+        }
+    }
+}
+
+void TestSuite::testSearchWorkspaceReuse() {
+    std::cout << "\n--- Tests de SearchWorkspace ---" << std::endl;
+    
+    // Test del reinicio por generación
+    SearchWorkspace ws(4);
+    ws.prepare(4);
+    ws.setDistance(2, 7.5);
+    ws.setParent(2, 1);
+    ws.setVisited(2);
+    assert_equals(7.5, ws.getDistance(2), "Workspace guarda distancia");
+    assert_equals(1, ws.getParent(2), "Workspace guarda padre");
+    
+    unsigned int generation = ws.getGeneration();
+    ws.prepare(4);
+    assert_equals((int)(generation + 1), (int)ws.getGeneration(), "prepare avanza la generación");
+    assert_true(ws.getDistance(2) == std::numeric_limits<double>::infinity(), "Distancia se reinicia sin recorrer el array");
+    assert_equals(-1, ws.getParent(2), "Padre se reinicia");
+    assert_false(ws.isVisited(2), "Visitado se reinicia");
+    
+    ws.prepare(10);
+    assert_equals(10, ws.getCapacity(), "Workspace crece bajo demanda");
+    assert_equals(-1, ws.getParent(9), "Slots nuevos nacen sin padre");
+    
+    // Un mismo workspace, intercalado entre grafos de distinto tamaño, debe
+    // producir los mismos resultados que una instancia nueva por consulta
+    Graph city;
+    MapLoader::createArequipaMap(city);
+    CompactGraph compact(city);
+    Graph line;
+    for (int i = 0; i < 3; i++) {
+        line.addNode(Node(i, "L" + std::to_string(i), i, 0));
+        if (i > 0) {
+            line.addEdge(i - 1, i, 1.0);
+        }
+    }
+    
+    SearchWorkspace shared;
+    SearchAlgorithms city_search(&city);
+    SearchAlgorithms compact_search(&compact);
+    SearchAlgorithms line_search(&line);
+    
+    bool all_match = true;
+    for (int round = 0; round < 3; round++) {
+        for (int start = 0; start < city.getNodeCount(); start += 3) {
+            int goal = city.getNodeCount() - 1 - start;
+            SearchResult fresh = SearchAlgorithms(&city).dijkstra(start, goal);
+            SearchResult fresh_astar = SearchAlgorithms(&city).aStar(start, goal);
+            SearchResult reused = city_search.dijkstra(start, goal, shared);
+            SearchResult reused_csr = compact_search.aStar(start, goal, shared);
+            all_match = all_match && fresh.path_found == reused.path_found &&
+                        fresh.path.getSize() == reused.path.getSize() &&
+                        std::abs(fresh.total_distance - reused.total_distance) < 1e-9 &&
+                        reused_csr.path_found == fresh_astar.path_found &&
+                        std::abs(fresh_astar.total_distance - reused_csr.total_distance) < 1e-9;
+            
+            SearchResult small = line_search.breadthFirstSearch(2, 0, shared);
+            all_match = all_match && !small.path_found;
+        }
+    }
+    assert_true(all_match, "Workspace reutilizado da los mismos resultados que uno nuevo");
+    
+    SearchResult dfs = line_search.depthFirstSearch(0, 2, shared);
+    assert_true(dfs.path_found && dfs.path.getSize() == 3, "DFS con workspace reutilizado");
+}
+
+void TestSuite::testBidirectionalSearch() {
+    std::cout << "\n--- Tests de Búsqueda Bidireccional ---" << std::endl;
+    
+    // Grafo dirigido: el lado inverso debe usar las aristas entrantes
+    Graph directed;
+    directed.addNode(Node(0, "Start", 0, 0));
+    directed.addNode(Node(1, "Mid1", 1, 0));
+    directed.addNode(Node(2, "Mid2", 0, 1));
+    directed.addNode(Node(3, "Goal", 1, 1));
+    directed.addEdge(0, 3, 10.0);
+    directed.addEdge(0, 1, 1.0);
+    directed.addEdge(1, 3, 1.0);
+    directed.addEdge(0, 2, 1.5);
+    directed.addEdge(2, 3, 1.5);
+    
+    assert_equals(3, directed.getIncomingEdges(3).getSize(), "Aristas entrantes registradas");
+    assert_equals(0, directed.getIncomingEdges(0).getSize(), "Nodo sin aristas entrantes");
+    
+    SearchAlgorithms small_search(&directed);
+    SearchResult bi = small_search.bidirectionalDijkstra(0, 3);
+    assert_true(bi.path_found, "Dijkstra bidireccional encuentra camino");
+    assert_equals(2.0, bi.total_distance, "Dijkstra bidireccional es óptimo");
+    assert_equals(3, bi.path.getSize(), "Camino bidireccional 0 -> 1 -> 3");
+    assert_true(bi.path.getSize() == 3 && bi.path[0] == 0 && bi.path[1] == 1 && bi.path[2] == 3,
+                "Camino bidireccional unido en el orden correcto");
+    
+    SearchResult reverse = small_search.bidirectionalDijkstra(3, 0);
+    assert_false(reverse.path_found, "Sin camino en contra del sentido de las aristas");
+    
+    SearchResult same = small_search.bidirectionalAStar(2, 2);
+    assert_true(same.path_found && same.path.getSize() == 1, "Origen igual a destino");
+    
+    // En la cuadrícula (pesos euclidianos, heurística consistente) ambas
+    // variantes deben coincidir con Dijkstra y explorar menos nodos que él
+    std::string path = findTestDataFile("grid_10k.dat");
+    assert_true(!path.empty(), "Archivo de prueba encontrado: grid_10k.dat");
+    if (path.empty()) return;
+    
+    Graph grid;
+    LargeGraphGenerator::loadGraphFromBinary(grid, path);
+    SearchAlgorithms search(&grid);
+    
+    int n = grid.getNodeCount();
+    int pairs[4][2] = {{0, n - 1}, {n / 3, 2 * n / 3}, {n - 1, 17}, {n / 2, n / 2 + 5}};
+    bool same_distance = true;
+    long long dijkstra_nodes = 0, bi_dijkstra_nodes = 0, astar_nodes = 0, bi_astar_nodes = 0;
+    
+    for (int p = 0; p < 4; p++) {
+        SearchResult reference = search.dijkstra(pairs[p][0], pairs[p][1]);
+        SearchResult astar = search.aStar(pairs[p][0], pairs[p][1]);
+        SearchResult bi_dijkstra = search.bidirectionalDijkstra(pairs[p][0], pairs[p][1]);
+        SearchResult bi_astar = search.bidirectionalAStar(pairs[p][0], pairs[p][1]);
+        
+        same_distance = same_distance && reference.path_found && bi_dijkstra.path_found && bi_astar.path_found &&
+                        std::abs(reference.total_distance - bi_dijkstra.total_distance) < 1e-6 &&
+                        std::abs(reference.total_distance - bi_astar.total_distance) < 1e-6;
+        
+        // El camino unido debe ser continuo y sumar la distancia reportada
+        double sum = 0.0;
+        for (int i = 0; i + 1 < bi_astar.path.getSize(); i++) {
+            sum += grid.getEdgeWeight(bi_astar.path[i], bi_astar.path[i + 1]);
+        }
+        same_distance = same_distance && std::abs(sum - bi_astar.total_distance) < 1e-6;
+        
+        dijkstra_nodes += reference.nodes_explored;
+        bi_dijkstra_nodes += bi_dijkstra.nodes_explored;
+        astar_nodes += astar.nodes_explored;
+        bi_astar_nodes += bi_astar.nodes_explored;
+    }
+    
+    assert_true(same_distance, "Bidireccionales obtienen la distancia de Dijkstra en cuadrícula");
+    assert_true(bi_dijkstra_nodes < dijkstra_nodes, "Dijkstra bidireccional explora menos nodos");
+    assert_true(bi_astar_nodes < dijkstra_nodes, "A* bidireccional explora menos nodos que Dijkstra");
+    std::cout << "Nodos explorados: Dijkstra=" << dijkstra_nodes << ", bidir=" << bi_dijkstra_nodes
+              << ", A*=" << astar_nodes << ", A* bidir=" << bi_astar_nodes << std::endl;
+}
+
+void TestSuite::testLandmarksAlt() {
+    std::cout << "\n--- Tests de ALT (Landmarks) ---" << std::endl;
+    
+    // Grafo dirigido sin coordenadas: la heurística euclidiana no sirve, la
+    // de landmarks sí, y d(u, v) != d(v, u)
+    Graph directed;
+    for (int i = 0; i < 6; i++) {
+        directed.addNode(Node(i, "N" + std::to_string(i), 0, 0));
+    }
+    directed.addEdge(0, 1, 2.0);
+    directed.addEdge(1, 2, 2.0);
+    directed.addEdge(2, 3, 2.0);
+    directed.addEdge(3, 4, 2.0);
+    directed.addEdge(4, 5, 2.0);
+    directed.addEdge(5, 0, 1.0);
+    directed.addEdge(0, 3, 7.0);
+    
+    Landmarks small;
+    small.build(directed, 2, LANDMARKS_FARTHEST);
+    assert_equals(2, small.getLandmarkCount(), "Se eligen k landmarks");
+    assert_true(small.getLandmarkNode(0) != small.getLandmarkNode(1), "Landmarks distintos");
+    
+    SearchAlgorithms small_search(&directed);
+    small_search.setLandmarks(&small);
+    bool admissible = true, optimal = true;
+    for (int s = 0; s < 6; s++) {
+        for (int t = 0; t < 6; t++) {
+            SearchResult reference = small_search.dijkstra(s, t);
+            SearchResult alt = small_search.altSearch(s, t);
+            admissible = admissible && small.lowerBound(s, t) <= reference.total_distance + 1e-9;
+            optimal = optimal && alt.path_found == reference.path_found &&
+                      std::abs(alt.total_distance - reference.total_distance) < 1e-9;
+        }
+    }
+    assert_true(admissible, "Cota de landmarks admisible en grafo dirigido");
+    assert_true(optimal, "ALT óptimo en grafo dirigido");
+    
+    SearchAlgorithms no_landmarks(&directed);
+    assert_false(no_landmarks.altSearch(0, 4).path_found, "ALT sin landmarks no retorna camino");
+    
+    // Cuadrícula: ALT debe coincidir con Dijkstra y explorar menos nodos
+    std::string path = findTestDataFile("grid_10k.dat");
+    assert_true(!path.empty(), "Archivo de prueba encontrado: grid_10k.dat");
+    if (path.empty()) return;
+    
+    Graph grid;
+    LargeGraphGenerator::loadGraphFromBinary(grid, path);
+    CompactGraph compact(grid);
+    int n = grid.getNodeCount();
+    
+    LandmarkSelection selections[2] = {LANDMARKS_FARTHEST, LANDMARKS_AVOID};
+    const char* names[2] = {"farthest", "avoid"};
+    for (int sel = 0; sel < 2; sel++) {
+        Landmarks landmarks;
+        landmarks.build(compact, 8, selections[sel]);
+        
+        SearchAlgorithms search(&grid);
+        SearchAlgorithms compact_search(&compact);
+        search.setLandmarks(&landmarks);
+        compact_search.setLandmarks(&landmarks);
+        
+        bool same = true;
+        long long dijkstra_nodes = 0, alt_nodes = 0;
+        unsigned int seed = 99;
+        for (int q = 0; q < 10; q++) {
+            seed = seed * 1103515245u + 12345u;
+            int start = (seed >> 8) % n;
+            seed = seed * 1103515245u + 12345u;
+            int goal = (seed >> 8) % n;
+            
+            SearchResult reference = search.dijkstra(start, goal);
+            SearchResult alt = search.altSearch(start, goal);
+            SearchResult compact_alt = compact_search.altSearch(start, goal);
+            same = same && alt.path_found && compact_alt.path_found &&
+                   std::abs(alt.total_distance - reference.total_distance) < 1e-6 &&
+                   std::abs(compact_alt.total_distance - reference.total_distance) < 1e-6 &&
+                   landmarks.lowerBound(start, goal) <= reference.total_distance + 1e-6;
+            dijkstra_nodes += reference.nodes_explored;
+            alt_nodes += alt.nodes_explored;
+        }
+        assert_true(same, std::string("ALT ") + names[sel] + " coincide con Dijkstra en cuadrícula");
+        assert_true(alt_nodes < dijkstra_nodes, std::string("ALT ") + names[sel] + " explora menos nodos que Dijkstra");
+    }
+    
+    // Persistencia junto al archivo del grafo
+    Landmarks original;
+    original.build(compact, 4, LANDMARKS_AVOID);
+    std::string filename = Landmarks::landmarkFileFor("test_landmarks.dat");
+    assert_true(original.saveToBinary(filename), "Landmarks guardados");
+    
+    Landmarks loaded;
+    assert_true(loaded.loadFromBinary(filename, n), "Landmarks cargados");
+    assert_equals(original.getLandmarkCount(), loaded.getLandmarkCount(), "Mismo número de landmarks");
+    assert_equals(original.lowerBound(5, n - 7), loaded.lowerBound(5, n - 7), "Misma cota tras cargar");
+    
+    Landmarks mismatched;
+    assert_false(mismatched.loadFromBinary(filename, n + 1), "Rechaza landmarks de otro grafo");
+    std::remove(filename.c_str());
+}
+
+// Tests de Contraction Hierarchies
+void TestSuite::testContractionHierarchy() {
+    std::cout << "\n--- Tests de Contraction Hierarchies ---" << std::endl;
+    
+    // Peso mínimo de la arista u -> v del grafo original (-1 si no existe)
+    auto edgeWeight = [](const Graph& graph, int u, int v) {
+        double best = -1.0;
+        const EdgeList& adjacencies = graph.getAdjacencies(u);
+        for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
+            if ((*it).getDestination() == v && (best < 0 || (*it).getWeight() < best)) {
+                best = (*it).getWeight();
+            }
+        }
+        return best;
+    };
+    
+    // Camino continuo sobre aristas originales cuya suma es la distancia
+    auto validPath = [&edgeWeight](const Graph& graph, const SearchResult& result) {
+        if (!result.path_found) return false;
+        double total = 0.0;
+        for (int i = 0; i + 1 < result.path.getSize(); i++) {
+            double weight = edgeWeight(graph, result.path[i], result.path[i + 1]);
+            if (weight < 0) return false;
+            total += weight;
+        }
+        return std::abs(total - result.total_distance) < 1e-6;
+    };
+    
+    // Grafo dirigido pequeño con un atajo obligatorio por el nodo central
+    Graph directed;
+    for (int i = 0; i < 6; i++) {
+        directed.addNode(Node(i, "N" + std::to_string(i), 0, 0));
+    }
+    directed.addEdge(0, 1, 2.0);
+    directed.addEdge(1, 2, 2.0);
+    directed.addEdge(2, 3, 2.0);
+    directed.addEdge(3, 4, 2.0);
+    directed.addEdge(4, 5, 2.0);
+    directed.addEdge(5, 0, 1.0);
+    directed.addEdge(0, 3, 7.0);
+    
+    ContractionHierarchy small;
+    small.build(directed);
+    assert_equals(6, small.getNodeCount(), "CH contiene todos los nodos");
+    
+    SearchAlgorithms small_search(&directed);
+    bool same = true, valid = true;
+    for (int s = 0; s < 6; s++) {
+        for (int t = 0; t < 6; t++) {
+            SearchResult reference = small_search.dijkstra(s, t);
+            SearchResult ch = small.query(s, t);
+            same = same && ch.path_found == reference.path_found &&
+                   std::abs(ch.total_distance - reference.total_distance) < 1e-9;
+            valid = valid && validPath(directed, ch);
+        }
+    }
+    assert_true(same, "CH coincide con Dijkstra en grafo dirigido");
+    assert_true(valid, "Caminos de CH desempaquetados a aristas originales");
+    
+    Graph disconnected;
+    disconnected.addNode(Node(1, "A", 0, 0));
+    disconnected.addNode(Node(2, "B", 1, 0));
+    disconnected.addNode(Node(3, "C", 2, 0));
+    disconnected.addEdge(1, 2, 1.0);
+    ContractionHierarchy disconnected_ch;
+    disconnected_ch.build(disconnected);
+    assert_false(disconnected_ch.query(1, 3).path_found, "CH sin camino entre componentes");
+    assert_false(disconnected_ch.query(1, 99).path_found, "CH con nodo inexistente");
+    
+    // Cuadrícula: mismas distancias que Dijkstra con menos nodos explorados
+    std::string path = findTestDataFile("grid_10k.dat");
+    assert_true(!path.empty(), "Archivo de prueba encontrado: grid_10k.dat");
+    if (path.empty()) return;
+    
+    Graph grid;
+    LargeGraphGenerator::loadGraphFromBinary(grid, path);
+    int n = grid.getNodeCount();
+    
+    ContractionHierarchy hierarchy;
+    hierarchy.build(grid);
+    assert_true(hierarchy.getShortcutCount() > 0, "CH agrega atajos en cuadrícula");
+    
+    SearchAlgorithms search(&grid);
+    same = true;
+    valid = true;
+    long long dijkstra_nodes = 0, ch_nodes = 0;
+    unsigned int seed = 7;
+    for (int q = 0; q < 10; q++) {
+        seed = seed * 1103515245u + 12345u;
+        int start = (seed >> 8) % n;
+        seed = seed * 1103515245u + 12345u;
+        int goal = (seed >> 8) % n;
+        
+        SearchResult reference = search.dijkstra(start, goal);
+        SearchResult ch = hierarchy.query(start, goal);
+        same = same && ch.path_found && std::abs(ch.total_distance - reference.total_distance) < 1e-6;
+        valid = valid && validPath(grid, ch);
+        dijkstra_nodes += reference.nodes_explored;
+        ch_nodes += ch.nodes_explored;
+    }
+    assert_true(same, "CH coincide con Dijkstra en cuadrícula");
+    assert_true(valid, "Caminos de CH válidos en cuadrícula");
+    assert_true(ch_nodes < dijkstra_nodes, "CH explora menos nodos que Dijkstra");
+    
+    // Persistencia junto al archivo del grafo
+    std::string filename = ContractionHierarchy::hierarchyFileFor("test_ch.dat");
+    assert_true(hierarchy.saveToBinary(filename), "Jerarquía guardada");
+    
+    ContractionHierarchy loaded;
+    assert_true(loaded.loadFromBinary(filename), "Jerarquía cargada");
+    assert_equals(hierarchy.getEdgeCount(), loaded.getEdgeCount(), "Mismo número de aristas tras cargar");
+    SearchResult before = hierarchy.query(3, n - 5);
+    SearchResult after = loaded.query(3, n - 5);
+    assert_true(after.path_found && std::abs(before.total_distance - after.total_distance) < 1e-9,
+                "Misma distancia tras cargar");
+    std::remove(filename.c_str());
+    
+    ContractionHierarchy invalid;
+    assert_false(invalid.loadFromBinary(path), "Rechaza archivos que no son de CH");
+}
+
+// Tests de la matriz de distancias (uno-a-muchos por origen)
+void TestSuite::testDistanceMatrix() {
+    std::cout << "\n--- Tests de Matriz de Distancias ---" << std::endl;
+    
+    const double INF = std::numeric_limits<double>::infinity();
+    Graph graph;
+    LargeGraphGenerator::generateCityLikeGraph(graph, 800, 4);
+    int isolated = graph.getNodeCount();
+    graph.addNode(Node(isolated, "Aislado", 0, 0));
+    CompactGraph compact(graph);
+    
+    // Orígenes y destinos al azar, con repetidos, el propio origen, un nodo
+    // inalcanzable y un ID inexistente
+    DynamicArray<int> sources;
+    DynamicArray<int> targets;
+    std::srand(7);
+    for (int i = 0; i < 10; i++) {
+        sources.push_back(std::rand() % isolated);
+    }
+    sources.push_back(-5);
+    for (int j = 0; j < 12; j++) {
+        targets.push_back(std::rand() % isolated);
+    }
+    targets.push_back(targets[3]);
+    targets.push_back(sources[0]);
+    targets.push_back(isolated);
+    targets.push_back(123456);
+    
+    // Referencia: un Dijkstra por par
+    SearchAlgorithms reference(&graph);
+    DynamicArray<double> expected;
+    for (int i = 0; i < sources.getSize(); i++) {
+        for (int j = 0; j < targets.getSize(); j++) {
+            SearchResult r = reference.dijkstra(sources[i], targets[j]);
+            expected.push_back(r.path_found ? r.total_distance : INF);
+        }
+    }
+    
+    SearchAlgorithms on_graph(&graph);
+    SearchAlgorithms on_compact(&compact);
+    DistanceMatrix single = on_graph.distanceMatrix(sources, targets);
+    assert_true(single.rows == sources.getSize() && single.cols == targets.getSize() &&
+                single.distances.getSize() == single.rows * single.cols,
+                "Matriz: dimensiones origen x destino");
+    
+    const int thread_counts[] = {1, 3, 8};
+    bool graph_matches = true;
+    bool compact_matches = true;
+    for (int t = 0; t < 3; t++) {
+        DistanceMatrix m = on_graph.distanceMatrix(sources, targets, thread_counts[t]);
+        DistanceMatrix c = on_compact.distanceMatrix(sources, targets, thread_counts[t]);
+        for (int k = 0; k < expected.getSize(); k++) {
+            graph_matches = graph_matches && m.distances[k] == expected[k];
+            compact_matches = compact_matches && c.distances[k] == expected[k];
+        }
+    }
+    assert_true(graph_matches, "Matriz: coincide con Dijkstra por par (Graph, 1/3/8 hilos)");
+    assert_true(compact_matches, "Matriz: coincide con Dijkstra por par (CSR, 1/3/8 hilos)");
+    assert_equals(0.0, single.at(0, 13), "Matriz: distancia de un origen a sí mismo");
+    assert_true(single.at(0, 14) == INF && single.at(0, 15) == INF && single.at(10, 0) == INF,
+                "Matriz: infinito para inalcanzables e IDs inexistentes");
+    
+    // La búsqueda de una fila se detiene al asentar todos sus destinos
+    DynamicArray<int> one_source;
+    DynamicArray<int> same_target;
+    one_source.push_back(sources[0]);
+    same_target.push_back(sources[0]);
+    DistanceMatrix trivial = on_compact.distanceMatrix(one_source, same_target);
+    assert_equals(1, trivial.nodes_explored, "Matriz: parada temprana al asentar los destinos");
+    
+    DistanceMatrix empty = on_graph.distanceMatrix(DynamicArray<int>(), targets, 4);
+    assert_true(empty.rows == 0 && empty.distances.getSize() == 0, "Matriz: sin orígenes");
+}
+
+// Tests del ejecutor de lotes de consultas con varios hilos
+void TestSuite::testQueryExecutor() {
+    std::cout << "\n--- Tests de QueryExecutor ---" << std::endl;
+    
+    Graph graph;
+    LargeGraphGenerator::generateCityLikeGraph(graph, 1000, 4);
+    CompactGraph compact(graph);
+    Landmarks landmarks;
+    Landmarks compact_landmarks;
+    landmarks.build(graph, 4);
+    compact_landmarks.build(compact, 4);
+    
+    // Lote mixto con IDs inexistentes y origen = destino
+    const QueryAlgorithm graph_algorithms[] = {QUERY_BFS, QUERY_DFS, QUERY_DIJKSTRA, QUERY_BEST_FIRST,
+                                               QUERY_ASTAR, QUERY_BIDIRECTIONAL_DIJKSTRA,
+                                               QUERY_BIDIRECTIONAL_ASTAR, QUERY_ALT};
+    DynamicArray<RouteQuery> queries;
+    std::srand(11);
+    for (int q = 0; q < 200; q++) {
+        queries.push_back(RouteQuery(std::rand() % 1000, std::rand() % 1000, graph_algorithms[q % 8]));
+    }
+    queries.push_back(RouteQuery(-1, 5, QUERY_DIJKSTRA));
+    queries.push_back(RouteQuery(42, 42, QUERY_ASTAR));
+    
+    // Referencia secuencial con una sola instancia
+    SearchAlgorithms reference(&graph);
+    reference.setLandmarks(&landmarks);
+    DynamicArray<SearchResult> expected;
+    for (int q = 0; q < queries.getSize(); q++) {
+        const RouteQuery& query = queries[q];
+        switch (query.algorithm) {
+            case QUERY_BFS: expected.push_back(reference.breadthFirstSearch(query.start, query.goal)); break;
+            case QUERY_DFS: expected.push_back(reference.depthFirstSearch(query.start, query.goal)); break;
+            case QUERY_DIJKSTRA: expected.push_back(reference.dijkstra(query.start, query.goal)); break;
+            case QUERY_BEST_FIRST: expected.push_back(reference.bestFirstSearch(query.start, query.goal)); break;
+            case QUERY_ASTAR: expected.push_back(reference.aStar(query.start, query.goal)); break;
+            case QUERY_BIDIRECTIONAL_DIJKSTRA:
+                expected.push_back(reference.bidirectionalDijkstra(query.start, query.goal)); break;
+            case QUERY_BIDIRECTIONAL_ASTAR:
+                expected.push_back(reference.bidirectionalAStar(query.start, query.goal)); break;
+            case QUERY_ALT: expected.push_back(reference.altSearch(query.start, query.goal)); break;
+        }
+    }
+    
+    auto sameResult = [](const SearchResult& a, const SearchResult& b) {
+        if (a.path_found != b.path_found || a.total_distance != b.total_distance ||
+            a.nodes_explored != b.nodes_explored || a.path.getSize() != b.path.getSize()) {
+            return false;
+        }
+        for (int i = 0; i < a.path.getSize(); i++) {
+            if (a.path[i] != b.path[i]) return false;
+        }
+        return true;
+    };
+    
+    const int thread_counts[] = {1, 3, 8};
+    bool same_as_sequential = true;
+    for (int t = 0; t < 3; t++) {
+        QueryExecutor executor(&graph, thread_counts[t]);
+        executor.setLandmarks(&landmarks);
+        // Dos lotes seguidos con el mismo grupo de hilos
+        for (int round = 0; round < 2; round++) {
+            DynamicArray<SearchResult> results;
+            executor.run(queries, results);
+            same_as_sequential = same_as_sequential && results.getSize() == expected.getSize();
+            for (int q = 0; same_as_sequential && q < expected.getSize(); q++) {
+                same_as_sequential = sameResult(results[q], expected[q]);
+            }
+        }
+    }
+    assert_true(same_as_sequential, "QueryExecutor: mismos resultados y orden que la ejecución secuencial");
+    
+    // Sobre el CSR (sin bidireccionales)
+    DynamicArray<RouteQuery> compact_queries;
+    for (int q = 0; q < 100; q++) {
+        compact_queries.push_back(RouteQuery(std::rand() % 1000, std::rand() % 1000,
+                                             q % 2 == 0 ? QUERY_DIJKSTRA : QUERY_ALT));
+    }
+    SearchAlgorithms compact_reference(&compact);
+    compact_reference.setLandmarks(&compact_landmarks);
+    QueryExecutor compact_executor(&compact, 4);
+    compact_executor.setLandmarks(&compact_landmarks);
+    DynamicArray<SearchResult> compact_results;
+    compact_executor.run(compact_queries, compact_results);
+    bool compact_matches = compact_results.getSize() == compact_queries.getSize();
+    for (int q = 0; compact_matches && q < compact_queries.getSize(); q++) {
+        SearchResult r = q % 2 == 0 ? compact_reference.dijkstra(compact_queries[q].start, compact_queries[q].goal)
+                                    : compact_reference.altSearch(compact_queries[q].start, compact_queries[q].goal);
+        compact_matches = sameResult(compact_results[q], r);
+    }
+    assert_true(compact_matches, "QueryExecutor: resultados correctos sobre CompactGraph");
+    
+    DynamicArray<SearchResult> empty_results;
+    compact_executor.run(DynamicArray<RouteQuery>(), empty_results);
+    assert_equals(0, empty_results.getSize(), "QueryExecutor: lote vacío");
+    assert_equals(4, compact_executor.getThreadCount(), "QueryExecutor: número de hilos");
+    
+    // Consultas sobre IDs inexistentes no encuentran camino
+    assert_false(expected[200].path_found, "QueryExecutor: origen inexistente sin camino");
+}
+
+// Tests de delta-stepping contra Dijkstra secuencial
+void TestSuite::testDeltaStepping() {
+    std::cout << "\n--- Tests de Delta-Stepping ---" << std::endl;
+    
+    const double INF = std::numeric_limits<double>::infinity();
+    
+    // Dijkstra uno-a-todos de referencia sobre el CSR
+    auto referenceDistances = [INF](const CompactGraph& graph, int source_index) {
+        int n = graph.getNodeCount();
+        DynamicArray<double> distance(n);
+        DynamicArray<bool> done(n);
+        for (int i = 0; i < n; i++) {
+            distance.push_back(INF);
+            done.push_back(false);
+        }
+        IndexedPriorityQueue<double, 4> pq(n);
+        distance[source_index] = 0.0;
+        pq.push(source_index, 0.0);
+        while (!pq.isEmpty()) {
+            int u = pq.top();
+            pq.pop();
+            done[u] = true;
+            for (int e = graph.edgesBegin(u); e < graph.edgesEnd(u); e++) {
+                int v = graph.getTarget(e);
+                double candidate = distance[u] + graph.getWeight(e);
+                if (!done[v] && candidate < distance[v]) {
+                    distance[v] = candidate;
+                    pq.pushOrDecrease(v, candidate);
+                }
+            }
+        }
+        return distance;
+    };
+    
+    // Grafo con pesos muy dispares (aristas livianas y pesadas) y una
+    // componente inalcanzable
+    Graph mixed;
+    std::srand(3);
+    for (int i = 0; i < 600; i++) {
+        mixed.addNode(Node(i, "M" + std::to_string(i), std::rand() % 100, std::rand() % 100));
+    }
+    for (int i = 0; i < 550; i++) {
+        for (int k = 0; k < 4; k++) {
+            int j = std::rand() % 550;
+            double weight = (std::rand() % 10 == 0) ? 50.0 + std::rand() % 200 : 0.5 + (std::rand() % 100) / 20.0;
+            mixed.addEdge(i, j, weight);
+        }
+    }
+    for (int i = 550; i < 599; i++) {
+        mixed.addEdge(i, i + 1, 1.0);
+    }
+    
+    Graph grid;
+    LargeGraphGenerator::generateGridGraph(grid, 40, 40);
+    Graph city;
+    LargeGraphGenerator::generateCityLikeGraph(city, 1500, 4);
+    
+    CompactGraph graphs[3] = {CompactGraph(mixed), CompactGraph(grid), CompactGraph(city)};
+    const int thread_counts[] = {1, 2, 3, 8};
+    bool distances_match = true;
+    bool parents_valid = true;
+    bool independent_of_threads = true;
+    
+    for (int g = 0; g < 3; g++) {
+        const CompactGraph& graph = graphs[g];
+        int source = graph.getNodeId(7);
+        DynamicArray<double> expected = referenceDistances(graph, 7);
+        double auto_delta = DeltaStepping::autoDelta(graph);
+        const double deltas[] = {auto_delta, auto_delta * 0.1, auto_delta * 10.0};
+        
+        for (int d = 0; d < 3; d++) {
+            DynamicArray<double> first_distances;
+            DynamicArray<int> first_parents;
+            for (int t = 0; t < 4; t++) {
+                DeltaStepping sssp(&graph);
+                sssp.setDelta(deltas[d]);
+                DynamicArray<double> distances;
+                DynamicArray<int> parents;
+                sssp.run(source, distances, parents, thread_counts[t]);
+                
+                for (int v = 0; v < graph.getNodeCount(); v++) {
+                    distances_match = distances_match && distances[v] == expected[v];
+                    int p = parents[v];
+                    if (v == 7 || distances[v] == INF) {
+                        parents_valid = parents_valid && p == -1;
+                        continue;
+                    }
+                    bool tight = false;
+                    for (int e = p >= 0 ? graph.edgesBegin(p) : 0; p >= 0 && e < graph.edgesEnd(p); e++) {
+                        tight = tight || (graph.getTarget(e) == v && distances[p] + graph.getWeight(e) == distances[v]);
+                    }
+                    parents_valid = parents_valid && tight;
+                }
+                if (t == 0) {
+                    first_distances = distances;
+                    first_parents = parents;
+                } else {
+                    for (int v = 0; v < graph.getNodeCount(); v++) {
+                        independent_of_threads = independent_of_threads &&
+                            distances[v] == first_distances[v] && parents[v] == first_parents[v];
+                    }
+                }
+            }
+        }
+    }
+    assert_true(distances_match, "Delta-stepping: distancias idénticas a Dijkstra (3 grafos, 3 deltas)");
+    assert_true(parents_valid, "Delta-stepping: cada padre es un predecesor en un camino mínimo");
+    assert_true(independent_of_threads, "Delta-stepping: resultado independiente del número de hilos");
+    assert_equals(1.0, DeltaStepping::autoDelta(graphs[1]), "Delta-stepping: delta automático en cuadrícula unitaria");
+    
+    // Un delta diminuto se ensancha: las cubetas quedan acotadas y el
+    // índice de cubeta no desborda
+    DeltaStepping tiny(&graphs[0]);
+    tiny.setDelta(1e-300);
+    DynamicArray<double> tiny_distances;
+    DynamicArray<int> tiny_parents;
+    tiny.run(graphs[0].getNodeId(7), tiny_distances, tiny_parents, 2);
+    DynamicArray<double> tiny_expected = referenceDistances(graphs[0], 7);
+    bool tiny_match = true;
+    for (int v = 0; v < graphs[0].getNodeCount(); v++) {
+        tiny_match = tiny_match && tiny_distances[v] == tiny_expected[v];
+    }
+    assert_true(tiny_match, "Delta-stepping: delta diminuto da las distancias de Dijkstra");
+    assert_true(tiny.getLastDelta() > 1e-300, "Delta-stepping: delta diminuto se ensancha");
+    
+    // Arista pesada cuyo destino, por redondeo, cae en la cubeta actual:
+    // 0.5 + 0.10000000000000002 = 0.6 y 0.6 / 0.1 < 6. El nodo 2 debe
+    // procesarse igual para alcanzar al 3
+    Graph rounding;
+    for (int i = 0; i < 4; i++) {
+        rounding.addNode(Node(i, "R" + std::to_string(i), i, 0));
+    }
+    rounding.addEdge(0, 1, 0.5);
+    rounding.addEdge(1, 2, 0.10000000000000002);
+    rounding.addEdge(2, 3, 1.0);
+    CompactGraph rounding_compact(rounding);
+    DeltaStepping rounding_sssp(&rounding_compact);
+    rounding_sssp.setDelta(0.1);
+    DynamicArray<double> rounding_distances;
+    DynamicArray<int> rounding_parents;
+    rounding_sssp.run(0, rounding_distances, rounding_parents, 1);
+    assert_true(rounding_distances[rounding_compact.getNodeIndex(3)] ==
+                    0.5 + 0.10000000000000002 + 1.0,
+                "Delta-stepping: arista pesada redondeada a la cubeta actual no pierde nodos");
+    
+    DeltaStepping invalid(&graphs[0]);
+    DynamicArray<double> distances;
+    DynamicArray<int> parents;
+    assert_false(invalid.run(-42, distances, parents, 2), "Delta-stepping: origen inexistente");
+    assert_true(distances.getSize() == graphs[0].getNodeCount() && distances[0] == INF,
+                "Delta-stepping: sin origen todas las distancias son infinitas");
+}
+
+// Tests del árbol de caminos mínimos acotado y las isócronas
+void TestSuite::testShortestPathTree() {
+    std::cout << "\n--- Tests de Árbol de Caminos Mínimos e Isócronas ---" << std::endl;
+    
+    const double INF = std::numeric_limits<double>::infinity();
+    Graph city;
+    LargeGraphGenerator::generateCityLikeGraph(city, 1200, 3);
+    CompactGraph compact(city);
+    int source = 17;
+    
+    // Distancias completas de referencia (delta-stepping ya validado)
+    DeltaStepping reference(&compact);
+    DynamicArray<double> all_distances;
+    DynamicArray<int> all_parents;
+    reference.run(source, all_distances, all_parents);
+    double farthest = 0.0;
+    for (int i = 0; i < all_distances.getSize(); i++) {
+        if (all_distances[i] != INF && all_distances[i] > farthest) farthest = all_distances[i];
+    }
+    
+    SearchAlgorithms on_graph(&city);
+    SearchAlgorithms on_compact(&compact);
+    const double fractions[] = {0.0, 0.1, 0.5, 2.0};
+    bool trees_correct = true;
+    bool same_on_both = true;
+    for (int f = 0; f < 4; f++) {
+        double max_cost = farthest * fractions[f];
+        ShortestPathTree tree = on_graph.shortestPathTree(source, max_cost);
+        ShortestPathTree compact_tree = on_compact.shortestPathTree(source, max_cost);
+        
+        int expected_count = 0;
+        for (int i = 0; i < all_distances.getSize(); i++) {
+            if (all_distances[i] <= max_cost) expected_count++;
+        }
+        trees_correct = trees_correct && tree.getSize() == expected_count && tree.nodes[0] == source &&
+                        tree.parents[0] == -1;
+        for (int k = 1; trees_correct && k < tree.getSize(); k++) {
+            int node = tree.nodes[k];
+            int parent = tree.parents[k];
+            trees_correct = tree.distances[k] == all_distances[compact.getNodeIndex(node)] &&
+                            tree.distances[k] >= tree.distances[k - 1] && parent >= 0 && parent < k &&
+                            tree.distances[parent] + city.getEdgeWeight(tree.nodes[parent], node) == tree.distances[k];
+        }
+        same_on_both = same_on_both && compact_tree.getSize() == tree.getSize();
+        for (int k = 0; same_on_both && k < tree.getSize(); k++) {
+            same_on_both = compact_tree.nodes[k] == tree.nodes[k] && compact_tree.distances[k] == tree.distances[k] &&
+                           compact_tree.parents[k] == tree.parents[k];
+        }
+    }
+    assert_true(trees_correct, "Árbol acotado: nodos, distancias y padres correctos para varios radios");
+    assert_true(same_on_both, "Árbol acotado: igual sobre Graph y CompactGraph");
+    
+    ShortestPathTree half = on_compact.shortestPathTree(source, farthest * 0.5);
+    DynamicArray<int> path = half.pathTo(half.getSize() - 1);
+    SearchResult direct = on_graph.dijkstra(source, half.nodes[half.getSize() - 1]);
+    assert_true(path.getSize() > 0 && path[0] == source && path[path.getSize() - 1] == half.nodes[half.getSize() - 1] &&
+                direct.total_distance == half.distances[half.getSize() - 1],
+                "Árbol acotado: pathTo reconstruye un camino mínimo");
+    
+    // Isócronas: borde por fuerza bruta sobre las distancias completas
+    DynamicArray<double> limits;
+    limits.push_back(farthest * 0.1);
+    limits.push_back(farthest * 0.3);
+    limits.push_back(farthest * 0.6);
+    SearchWorkspace ws;
+    DynamicArray<Isochrone> bands = on_compact.isochrones(source, limits, ws);
+    bool boundaries_correct = bands.getSize() == 3;
+    for (int b = 0; boundaries_correct && b < 3; b++) {
+        int reachable = 0;
+        DynamicArray<int> expected_boundary;
+        ShortestPathTree zone = on_compact.shortestPathTree(source, limits[b]);
+        for (int k = 0; k < zone.getSize(); k++) {
+            reachable++;
+            int u = compact.getNodeIndex(zone.nodes[k]);
+            bool leaves = false;
+            for (int e = compact.edgesBegin(u); e < compact.edgesEnd(u); e++) {
+                leaves = leaves || all_distances[compact.getTarget(e)] > limits[b];
+            }
+            if (leaves) expected_boundary.push_back(zone.nodes[k]);
+        }
+        boundaries_correct = bands[b].reachable_count == reachable &&
+                             bands[b].boundary_nodes.getSize() == expected_boundary.getSize() &&
+                             bands[b].boundary_nodes.getSize() > 0;
+        for (int k = 0; boundaries_correct && k < expected_boundary.getSize(); k++) {
+            boundaries_correct = bands[b].boundary_nodes[k] == expected_boundary[k];
+        }
+    }
+    assert_true(boundaries_correct, "Isócronas: nodos de borde por banda de costo");
+    
+    // Reutilizar el workspace: el mismo resultado y sin crecer
+    int capacity = ws.getCapacity();
+    DynamicArray<Isochrone> again = on_compact.isochrones(source, limits, ws);
+    bool repeated = again.getSize() == 3;
+    for (int b = 0; repeated && b < 3; b++) {
+        repeated = again[b].reachable_count == bands[b].reachable_count &&
+                   again[b].boundary_nodes.getSize() == bands[b].boundary_nodes.getSize();
+    }
+    assert_true(repeated && ws.getCapacity() == capacity, "Isócronas: consultas repetidas con el mismo workspace");
+    
+    assert_equals(0, on_graph.shortestPathTree(-3, 10.0).getSize(), "Árbol acotado: origen inexistente");
+    assert_equals(1, on_graph.shortestPathTree(source, 0.0).getSize(), "Árbol acotado: radio cero");
+}
+
+void TestSuite::testJumpPointSearch() {
+    std::cout << "\n--- Tests de Jump Point Search ---" << std::endl;
+    
+    // Cuadrícula con ~25% de celdas bloqueadas, dada como grafo
+    const int width = 60;
+    const int height = 45;
+    std::srand(4242);
+    DynamicArray<char> blocked(width * height);
+    for (int i = 0; i < width * height; i++) {
+        blocked.push_back(std::rand() % 4 == 0 ? 1 : 0);
+    }
+    Graph grid;
+    LargeGraphGenerator::generateGridGraph(grid, width, height, 2.5, &blocked);
+    
+    JumpPointSearch detected;
+    assert_true(detected.detectFrom(grid) && detected.getWidth() == width && detected.getHeight() == height &&
+                detected.getCellCost() == 2.5, "JPS: detecta la cuadrícula generada");
+    bool same_blocked = true;
+    for (int i = 0; i < width * height; i++) {
+        // Las celdas libres rodeadas de obstáculos tampoco tienen aristas
+        same_blocked = same_blocked && (!blocked[i] || detected.isBlocked(i));
+    }
+    assert_true(same_blocked, "JPS: celdas bloqueadas detectadas");
+    
+    // La misma cuadrícula descrita directamente, sin grafo
+    JumpPointSearch told(width, height, 2.5);
+    for (int i = 0; i < width * height; i++) {
+        if (detected.isBlocked(i)) told.setBlocked(i);
+    }
+    
+    SearchAlgorithms search(&grid);
+    bool distances_match = true;
+    bool paths_valid = true;
+    bool fewer_expanded = true;
+    int compared = 0;
+    for (int q = 0; q < 200; q++) {
+        int start = std::rand() % (width * height);
+        int goal = std::rand() % (width * height);
+        if (detected.isBlocked(start) || detected.isBlocked(goal)) continue;
+        compared++;
+        SearchResult expected = search.dijkstra(start, goal);
+        SearchResult jps = detected.findPath(start, goal);
+        SearchResult jps_told = told.findPath(start, goal);
+        distances_match = distances_match && jps.path_found == expected.path_found &&
+                          jps_told.path_found == expected.path_found;
+        if (!expected.path_found) continue;
+        distances_match = distances_match && std::abs(jps.total_distance - expected.total_distance) < 1e-9 &&
+                          jps_told.total_distance == jps.total_distance;
+        
+        // Camino celda a celda entre vecinas libres, con el costo informado
+        paths_valid = paths_valid && jps.path.getSize() > 0 && jps.path[0] == start &&
+                      jps.path[jps.path.getSize() - 1] == goal &&
+                      std::abs((jps.path.getSize() - 1) * 2.5 - jps.total_distance) < 1e-9;
+        for (int k = 1; paths_valid && k < jps.path.getSize(); k++) {
+            paths_valid = grid.hasEdge(jps.path[k - 1], jps.path[k]);
+        }
+        fewer_expanded = fewer_expanded && jps.nodes_explored <= expected.nodes_explored;
+    }
+    assert_true(compared > 100 && distances_match, "JPS: mismas distancias que Dijkstra con obstáculos");
+    assert_true(paths_valid, "JPS: caminos completos celda a celda");
+    assert_true(fewer_expanded, "JPS: expande menos nodos que Dijkstra");
+    
+    // Cuadrícula abierta: pocos puntos de salto frente a A*
+    Graph open_grid;
+    LargeGraphGenerator::generateGridGraph(open_grid, 120, 120);
+    JumpPointSearch open_jps;
+    open_jps.detectFrom(open_grid);
+    SearchAlgorithms open_search(&open_grid);
+    SearchResult astar = open_search.aStar(5, 120 * 117 + 110);
+    SearchResult open_result = open_jps.findPath(5, 120 * 117 + 110);
+    assert_true(open_result.path_found && open_result.total_distance == astar.total_distance &&
+                open_result.nodes_explored * 10 < astar.nodes_explored,
+                "JPS: cuadrícula abierta con muchos menos nodos expandidos que A*");
+    
+    // Casos borde
+    assert_true(open_jps.findPath(77, 77).path_found && open_jps.findPath(77, 77).path.getSize() == 1,
+                "JPS: origen igual a destino");
+    JumpPointSearch walled(5, 5);
+    for (int y = 0; y < 5; y++) walled.setBlocked(y * 5 + 2);
+    assert_false(walled.findPath(0, 4).path_found, "JPS: sin camino a través de una pared");
+    assert_false(walled.findPath(2, 4).path_found, "JPS: origen bloqueado");
+    Graph city;
+    LargeGraphGenerator::generateCityLikeGraph(city, 300, 3);
+    JumpPointSearch not_grid(3, 3);
+    assert_false(not_grid.detectFrom(city), "JPS: rechaza un grafo que no es cuadrícula");
+    assert_equals(9, not_grid.getCellCount(), "JPS: la detección fallida no cambia la cuadrícula");
+}
+
+void TestSuite::testImplicitGridGraph() {
+    std::cout << "\n--- Tests de Cuadrícula Implícita (ImplicitGridGraph) ---" << std::endl;
+    
+    // La misma cuadrícula con obstáculos, materializada y como ImplicitGridGraph
+    const int width = 40;
+    const int height = 30;
+    std::srand(777);
+    DynamicArray<char> blocked(width * height);
+    ImplicitGridGraph grid(width, height, 1.5);
+    for (int i = 0; i < width * height; i++) {
+        blocked.push_back(std::rand() % 5 == 0 ? 1 : 0);
+        if (blocked[i]) grid.setBlocked(i);
+    }
+    Graph materialized;
+    LargeGraphGenerator::generateGridGraph(materialized, width, height, 1.5, &blocked);
+    
+    assert_equals(materialized.getNodeCount(), grid.getNodeCount(), "Cuadrícula implícita: cantidad de nodos");
+    assert_equals(materialized.getEdgeCount(), grid.getEdgeCount(), "Cuadrícula implícita: cantidad de aristas");
+    bool same_structure = true;
+    for (int i = 0; same_structure && i < grid.getNodeCount(); i++) {
+        const Node* node = materialized.getNode(i);
+        same_structure = node->getX() == grid.getX(i) && node->getY() == grid.getY(i);
+        int degree = 0;
+        for (auto arc : grid.neighbors(i)) {
+            same_structure = same_structure && materialized.getEdgeWeight(i, arc.target) == arc.weight;
+            degree++;
+        }
+        same_structure = same_structure && degree == materialized.getAdjacencies(i).getSize();
+    }
+    assert_true(same_structure, "Cuadrícula implícita: coordenadas, vecinos y pesos como generateGridGraph");
+    
+    // Los cinco algoritmos sobre ambas representaciones
+    SearchAlgorithms on_graph(&materialized);
+    SearchAlgorithms on_grid(&grid);
+    bool optimal_match = true;
+    bool paths_valid = true;
+    for (int q = 0; q < 60; q++) {
+        int start = std::rand() % grid.getNodeCount();
+        int goal = std::rand() % grid.getNodeCount();
+        SearchResult results[5] = {on_grid.depthFirstSearch(start, goal), on_grid.breadthFirstSearch(start, goal),
+                                   on_grid.dijkstra(start, goal), on_grid.bestFirstSearch(start, goal),
+                                   on_grid.aStar(start, goal)};
+        SearchResult expected = on_graph.dijkstra(start, goal);
+        optimal_match = optimal_match && results[1].total_distance == expected.total_distance &&
+                        results[2].total_distance == expected.total_distance &&
+                        std::abs(results[4].total_distance - expected.total_distance) < 1e-9;
+        for (int a = 0; a < 5; a++) {
+            const SearchResult& r = results[a];
+            paths_valid = paths_valid && r.path_found == expected.path_found;
+            if (!r.path_found) continue;
+            paths_valid = paths_valid && r.path[0] == start && r.path[r.path.getSize() - 1] == goal;
+            for (int k = 1; paths_valid && k < r.path.getSize(); k++) {
+                paths_valid = materialized.hasEdge(r.path[k - 1], r.path[k]);
+            }
+        }
+    }
+    assert_true(optimal_match, "Cuadrícula implícita: BFS, Dijkstra y A* con la distancia mínima");
+    assert_true(paths_valid, "Cuadrícula implícita: los cinco algoritmos dan caminos válidos");
+    
+    // GraphSearch sobre CSR se comporta igual que SearchAlgorithms
+    CompactGraph compact(materialized);
+    SearchAlgorithms on_compact(&compact);
+    GraphSearch<CompactGraph> generic(&compact);
+    SearchWorkspace ws;
+    bool identical = true;
+    for (int q = 0; identical && q < 20; q++) {
+        int start = std::rand() % grid.getNodeCount();
+        int goal = std::rand() % grid.getNodeCount();
+        SearchResult pairs[5][2] = {
+            {on_compact.depthFirstSearch(start, goal), generic.depthFirstSearch(start, goal, ws)},
+            {on_compact.breadthFirstSearch(start, goal), generic.breadthFirstSearch(start, goal, ws)},
+            {on_compact.dijkstra(start, goal), generic.dijkstra(start, goal, ws)},
+            {on_compact.bestFirstSearch(start, goal), generic.bestFirstSearch(start, goal, ws)},
+            {on_compact.aStar(start, goal), generic.aStar(start, goal, ws)}};
+        for (int a = 0; identical && a < 5; a++) {
+            identical = pairs[a][0].path_found == pairs[a][1].path_found &&
+                        pairs[a][0].nodes_explored == pairs[a][1].nodes_explored &&
+                        pairs[a][0].total_distance == pairs[a][1].total_distance &&
+                        pairs[a][0].path.getSize() == pairs[a][1].path.getSize();
+        }
+    }
+    assert_true(identical, "GraphSearch<CompactGraph>: mismos resultados que SearchAlgorithms sobre CSR");
+    
+    // Coordenadas, memoria y casos borde
+    assert_equals(2 * width + 3, on_grid.snapToNode(4.7, 2.9), "Cuadrícula implícita: ajuste a la celda más cercana");
+    assert_equals(width * height - 1, grid.findNearestNode(1e6, 1e6), "Cuadrícula implícita: ajuste fuera del borde");
+    assert_equals(width * height - 1, grid.findNearestNode(1e300, 1e300), "Cuadrícula implícita: coordenada enorme se acota");
+    assert_equals(0, grid.findNearestNode(-1e300, -1e300), "Cuadrícula implícita: coordenada enorme negativa se acota");
+    assert_equals(width - 1, grid.findNearestNode(1e300, -1e300), "Cuadrícula implícita: ejes acotados por separado");
+    assert_true(grid.getMemoryUsage() < sizeof(ImplicitGridGraph) + width * height / 8 + 64,
+                "Cuadrícula implícita: solo el conjunto de bits de bloqueos");
+    assert_false(on_grid.dijkstra(-1, 5).path_found, "Cuadrícula implícita: nodo inexistente");
+    ImplicitGridGraph open_grid(1414, 1414);
+    SearchAlgorithms on_open(&open_grid);
+    SearchResult corner = on_open.aStar(0, 1414 * 1414 - 1);
+    assert_true(corner.path_found && corner.total_distance == 2 * 1413.0 && open_grid.getMemoryUsage() < 1024,
+                "Cuadrícula implícita: 2M celdas sin materializar nodos");
+}
+
+// Tests de las políticas de GraphSearch
+void TestSuite::testGraphSearchPolicies() {
+    std::cout << "\n--- Tests de Políticas de GraphSearch ---" << std::endl;
+    
+    // Cuadrícula con obstáculos: Manhattan es admisible y consistente
+    const int width = 30;
+    const int height = 30;
+    std::srand(4242);
+    DynamicArray<char> blocked(width * height);
+    for (int i = 0; i < width * height; i++) {
+        blocked.push_back(std::rand() % 6 == 0 ? 1 : 0);
+    }
+    Graph grid;
+    LargeGraphGenerator::generateGridGraph(grid, width, height, 2.0, &blocked);
+    CompactGraph compact(grid);
+    GraphAdjacencyView view(&grid);
+    
+    GraphSearch<CompactGraph> reference(&compact);
+    GraphSearch<CompactGraph, ManhattanHeuristic> manhattan(&compact);
+    GraphSearch<CompactGraph, ZeroHeuristic> zero(&compact);
+    GraphSearch<CompactGraph, EuclideanHeuristic, IndexedHeapQueue<2> > binary(&compact);
+    GraphSearch<CompactGraph, EuclideanHeuristic, IndexedHeapQueue<8> > octal(&compact);
+    GraphSearch<GraphAdjacencyView> on_lists(&view);
+    
+    SearchWorkspace ws;
+    bool heuristics_agree = true;
+    bool zero_is_dijkstra = true;
+    bool queues_agree = true;
+    bool views_agree = true;
+    for (int q = 0; q < 60; q++) {
+        int start = std::rand() % (width * height);
+        int goal = std::rand() % (width * height);
+        SearchResult dijkstra = reference.dijkstra(start, goal, ws);
+        SearchResult astar = reference.aStar(start, goal, ws);
+        SearchResult astar_manhattan = manhattan.aStar(start, goal, ws);
+        SearchResult astar_zero = zero.aStar(start, goal, ws);
+        heuristics_agree = heuristics_agree &&
+                           astar.path_found == dijkstra.path_found &&
+                           astar_manhattan.path_found == dijkstra.path_found &&
+                           std::abs(astar.total_distance - dijkstra.total_distance) < 1e-9 &&
+                           std::abs(astar_manhattan.total_distance - dijkstra.total_distance) < 1e-9;
+        zero_is_dijkstra = zero_is_dijkstra &&
+                           astar_zero.total_distance == dijkstra.total_distance &&
+                           astar_zero.nodes_explored == dijkstra.nodes_explored;
+        
+        SearchResult dijkstra_binary = binary.dijkstra(start, goal, ws);
+        SearchResult astar_octal = octal.aStar(start, goal, ws);
+        queues_agree = queues_agree &&
+                       dijkstra_binary.path_found == dijkstra.path_found &&
+                       std::abs(dijkstra_binary.total_distance - dijkstra.total_distance) < 1e-9 &&
+                       std::abs(astar_octal.total_distance - astar.total_distance) < 1e-9;
+        
+        SearchResult lists_dijkstra = on_lists.dijkstra(start, goal, ws);
+        SearchResult lists_bfs = on_lists.breadthFirstSearch(start, goal, ws);
+        SearchResult compact_bfs = reference.breadthFirstSearch(start, goal, ws);
+        views_agree = views_agree &&
+                      lists_dijkstra.path_found == dijkstra.path_found &&
+                      lists_dijkstra.nodes_explored == dijkstra.nodes_explored &&
+                      lists_dijkstra.total_distance == dijkstra.total_distance &&
+                      lists_bfs.path.getSize() == compact_bfs.path.getSize();
+    }
+    assert_true(heuristics_agree, "GraphSearch: A* Manhattan y euclidiano dan la distancia de Dijkstra");
+    assert_true(zero_is_dijkstra, "GraphSearch: A* con heurística nula equivale a Dijkstra");
+    assert_true(queues_agree, "GraphSearch: heaps de aridad 2 y 8 dan las mismas distancias");
+    assert_true(views_agree, "GraphSearch: GraphAdjacencyView y CompactGraph coinciden");
+    
+    assert_false(on_lists.dijkstra(-5, 3, ws).path_found, "GraphAdjacencyView: nodo inexistente");
+    assert_equals(-1, view.getNodeIndex(width * height), "GraphAdjacencyView: índice de ID inexistente");
+}
+
+// Tests de IDs externos dispersos (índices internos densos)
+void TestSuite::testSparseNodeIds() {
+    std::cout << "\n--- Tests de IDs Dispersos ---" << std::endl;
+    
+    // La misma cuadrícula (con pesos no uniformes para que haya un único
+    // camino mínimo) con IDs 0..n-1 y con IDs grandes y dispersos,
+    // insertados en orden inverso: índice interno != celda != ID
+    const int side = 15;
+    const int n = side * side;
+    Graph grid;
+    LargeGraphGenerator::generateGridGraph(grid, side, side, 1.0);
+    Graph dense;
+    Graph sparse;
+    DynamicArray<int> sparse_id(n);
+    for (int i = 0; i < n; i++) {
+        dense.addNode(*grid.getNode(i));
+        sparse_id.push_back(1000003 + 7919 * i);
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        const Node* node = grid.getNode(i);
+        sparse.addNode(Node(sparse_id[i], node->getName(), node->getX(), node->getY()));
+    }
+    for (int i = 0; i < n; i++) {
+        const EdgeList& edges = grid.getAdjacencies(i);
+        for (auto it = edges.begin(); it != edges.end(); ++it) {
+            double weight = (*it).getWeight() * (1.0 + (i % 3) * 0.25);
+            dense.addEdge(i, (*it).getDestination(), weight);
+            sparse.addEdge(sparse_id[i], sparse_id[(*it).getDestination()], weight);
+        }
+    }
+    
+    // Traducción entre IDs e índices
+    assert_equals(n - 1, sparse.getNodeIndex(sparse_id[0]), "IDs dispersos: índice interno por orden de inserción");
+    assert_equals(sparse_id[n - 1], sparse.getNodeId(0), "IDs dispersos: ID a partir del índice");
+    assert_equals(-1, sparse.getNodeId(n), "IDs dispersos: índice fuera de rango");
+    const Edge& first_edge = sparse.getAdjacenciesAt(0).front();
+    assert_equals(sparse.getNodeIndex(first_edge.getDestination()), first_edge.getDestinationIndex(),
+                  "IDs dispersos: la arista guarda el índice del destino");
+    
+    // Todos los algoritmos dan las mismas distancias sobre ambos grafos
+    SearchAlgorithms on_dense(&dense);
+    SearchAlgorithms on_sparse(&sparse);
+    CompactGraph sparse_compact(sparse);
+    SearchAlgorithms on_sparse_compact(&sparse_compact);
+    Landmarks dense_landmarks;
+    Landmarks sparse_landmarks;
+    dense_landmarks.build(dense, 3, LANDMARKS_FARTHEST);
+    sparse_landmarks.build(sparse, 3, LANDMARKS_FARTHEST);
+    on_dense.setLandmarks(&dense_landmarks);
+    on_sparse.setLandmarks(&sparse_landmarks);
+    
+    std::srand(2024);
+    bool same_distances = true;
+    bool paths_in_ids = true;
+    for (int q = 0; q < 30; q++) {
+        int a = std::rand() % n;
+        int b = std::rand() % n;
+        double expected = on_dense.dijkstra(a, b).total_distance;
+        SearchResult results[8] = {
+            on_sparse.dijkstra(sparse_id[a], sparse_id[b]),
+            on_sparse.aStar(sparse_id[a], sparse_id[b]),
+            on_sparse.altSearch(sparse_id[a], sparse_id[b]),
+            on_sparse.bidirectionalDijkstra(sparse_id[a], sparse_id[b]),
+            on_sparse.bidirectionalAStar(sparse_id[a], sparse_id[b]),
+            on_sparse.dijkstraLinearScan(sparse_id[a], sparse_id[b]),
+            on_sparse_compact.dijkstra(sparse_id[a], sparse_id[b]),
+            on_sparse.breadthFirstSearch(sparse_id[a], sparse_id[b])};
+        for (int r = 0; r < 8; r++) {
+            if (r < 7) {
+                same_distances = same_distances && results[r].path_found &&
+                                 std::abs(results[r].total_distance - expected) < 1e-9;
+            }
+            const DynamicArray<int>& path = results[r].path;
+            paths_in_ids = paths_in_ids && path.getSize() > 0 &&
+                           path[0] == sparse_id[a] && path[path.getSize() - 1] == sparse_id[b];
+            for (int k = 0; paths_in_ids && k + 1 < path.getSize(); k++) {
+                paths_in_ids = sparse.hasEdge(path[k], path[k + 1]);
+            }
+        }
+    }
+    assert_true(same_distances, "IDs dispersos: mismas distancias que con IDs 0..n-1");
+    assert_true(paths_in_ids, "IDs dispersos: los caminos son aristas entre IDs externos");
+    
+    ShortestPathTree dense_tree = on_dense.shortestPathTree(0, 6.0);
+    ShortestPathTree sparse_tree = on_sparse.shortestPathTree(sparse_id[0], 6.0);
+    assert_equals(dense_tree.getSize(), sparse_tree.getSize(), "IDs dispersos: árbol de caminos mínimos");
+    assert_equals(sparse_id[0], sparse_tree.nodes[0], "IDs dispersos: el árbol guarda IDs");
+    
+    DynamicArray<int> sources;
+    DynamicArray<int> targets;
+    sources.push_back(sparse_id[3]);
+    sources.push_back(sparse_id[n - 1]);
+    targets.push_back(sparse_id[40]);
+    targets.push_back(424242);
+    DistanceMatrix matrix = on_sparse.distanceMatrix(sources, targets);
+    assert_true(std::abs(matrix.at(0, 0) - on_dense.dijkstra(3, 40).total_distance) < 1e-9 &&
+                std::abs(matrix.at(1, 0) - on_dense.dijkstra(n - 1, 40).total_distance) < 1e-9 &&
+                matrix.at(0, 1) == std::numeric_limits<double>::infinity(),
+                "IDs dispersos: matriz de distancias");
+    
+    // Guardar y cargar conserva IDs y aristas
+    std::string filename = "test_sparse_ids.bin";
+    LargeGraphGenerator::saveGraphToBinary(sparse, filename);
+    Graph loaded;
+    bool loaded_ok = LargeGraphGenerator::loadGraphFromBinary(loaded, filename);
+    std::remove(filename.c_str());
+    assert_true(loaded_ok && loaded.getNodeCount() == n && loaded.getEdgeCount() == sparse.getEdgeCount(),
+                "IDs dispersos: carga binaria con todas las aristas");
+    bool same_edges = true;
+    for (int i = 0; same_edges && i < n; i++) {
+        const EdgeList& edges = sparse.getAdjacenciesAt(i);
+        for (auto it = edges.begin(); it != edges.end(); ++it) {
+            same_edges = same_edges && loaded.getEdgeWeight((*it).getSource(), (*it).getDestination()) == (*it).getWeight();
+        }
+    }
+    assert_true(same_edges, "IDs dispersos: la carga binaria conserva origen y destino de cada arista");
+    SearchAlgorithms on_loaded(&loaded);
+    assert_true(std::abs(on_loaded.dijkstra(sparse_id[5], sparse_id[200]).total_distance -
+                         on_dense.dijkstra(5, 200).total_distance) < 1e-9,
+                "IDs dispersos: rutas sobre el grafo cargado");
+}
+
+// Tests de reordenamiento de nodos
+void TestSuite::testNodeReordering() {
+    std::cout << "\n--- Tests de Reordenamiento de Nodos ---" << std::endl;
+    
+    // Camino 0-1-...-9 insertado desordenado: BFS y RCM lo dejan contiguo
+    Graph chain;
+    const int scrambled[10] = {7, 2, 9, 0, 5, 3, 8, 1, 6, 4};
+    for (int i = 0; i < 10; i++) {
+        chain.addNode(Node(scrambled[i], "C" + std::to_string(scrambled[i]), scrambled[i], 0.0));
+    }
+    for (int i = 0; i + 1 < 10; i++) {
+        chain.addEdge(i, i + 1, 1.0);
+        chain.addEdge(i + 1, i, 1.0);
+    }
+    Graph chain_bfs;
+    Graph chain_rcm;
+    DynamicArray<int> order;
+    NodeReordering::reorder(chain, ORDER_BFS, chain_bfs, order);
+    NodeReordering::reorder(chain, ORDER_RCM, chain_rcm, order);
+    assert_true(NodeReordering::averageEdgeSpan(chain) > 1.0, "Reordenamiento: el camino desordenado no es contiguo");
+    assert_equals(1.0, NodeReordering::averageEdgeSpan(chain_rcm), "Reordenamiento: RCM deja el camino contiguo");
+    assert_true(NodeReordering::averageEdgeSpan(chain_bfs) < NodeReordering::averageEdgeSpan(chain),
+                "Reordenamiento: BFS acerca los vecinos del camino");
+    int end_index = chain_rcm.getNodeIndex(0);
+    assert_true(end_index == 0 || end_index == 9, "Reordenamiento: RCM empieza en un extremo del camino");
+    
+    // Grafo tipo ciudad: cada estrategia conserva nodos, aristas y
+    // distancias, y acerca los índices de los extremos de cada arista
+    Graph city;
+    LargeGraphGenerator::generateCityLikeGraph(city, 3000, 8);
+    double original_span = NodeReordering::averageEdgeSpan(city);
+    const NodeOrdering orderings[3] = {ORDER_HILBERT, ORDER_BFS, ORDER_RCM};
+    SearchAlgorithms on_city(&city);
+    for (int o = 0; o < 3; o++) {
+        std::string name = NodeReordering::getName(orderings[o]);
+        Graph reordered;
+        NodeReordering::reorder(city, orderings[o], reordered, order);
+        
+        bool same_graph = reordered.getNodeCount() == city.getNodeCount() &&
+                          reordered.getEdgeCount() == city.getEdgeCount();
+        for (int k = 0; same_graph && k < reordered.getNodeCount(); k++) {
+            const Node& node = reordered.getNodeAt(k);
+            const Node& original = city.getNodeAt(order[k]);
+            same_graph = node.getId() == original.getId() && node.getX() == original.getX();
+            const EdgeList& edges = city.getAdjacenciesAt(order[k]);
+            for (auto it = edges.begin(); same_graph && it != edges.end(); ++it) {
+                same_graph = reordered.getEdgeWeight((*it).getSource(), (*it).getDestination()) == (*it).getWeight();
+            }
+        }
+        assert_true(same_graph, "Reordenamiento " + name + ": mismos nodos y aristas");
+        
+        SearchAlgorithms on_reordered(&reordered);
+        CompactGraph compact(reordered);
+        SearchAlgorithms on_compact(&compact);
+        std::srand(99);
+        bool same_distances = true;
+        for (int q = 0; q < 20; q++) {
+            int a = std::rand() % city.getNodeCount();
+            int b = std::rand() % city.getNodeCount();
+            double expected = on_city.dijkstra(a, b).total_distance;
+            same_distances = same_distances && on_reordered.dijkstra(a, b).total_distance == expected &&
+                             on_compact.aStar(a, b).total_distance == expected;
+        }
+        assert_true(same_distances, "Reordenamiento " + name + ": mismas distancias por ID");
+        assert_true(NodeReordering::averageEdgeSpan(reordered) < original_span / 4,
+                    "Reordenamiento " + name + ": aristas entre índices cercanos");
+    }
+    
+    // Permutaciones inválidas
+    DynamicArray<int> invalid;
+    for (int i = 0; i < 10; i++) {
+        invalid.push_back(i == 3 ? 4 : i);
+    }
+    Graph untouched;
+    assert_false(NodeReordering::apply(chain, invalid, untouched), "Reordenamiento: rechaza índices repetidos");
+    assert_equals(0, untouched.getNodeCount(), "Reordenamiento: un orden inválido no modifica el destino");
+    
+    // La permutación se guarda en el formato binario
+    Graph saved;
+    NodeReordering::reorder(chain, ORDER_RCM, saved, order);
+    std::string filename = "test_reordered.bin";
+    LargeGraphGenerator::saveGraphToBinary(saved, filename, &order);
+    Graph loaded;
+    DynamicArray<int> loaded_order;
+    bool loaded_ok = LargeGraphGenerator::loadGraphFromBinary(loaded, filename, &loaded_order);
+    bool same_order = loaded_ok && loaded_order.getSize() == order.getSize();
+    for (int k = 0; same_order && k < order.getSize(); k++) {
+        same_order = loaded_order[k] == order[k] && loaded.getNodeId(k) == saved.getNodeId(k);
+    }
+    assert_true(same_order, "Reordenamiento: la permutación se conserva en el archivo binario");
+    Graph plain_loaded;
+    assert_true(LargeGraphGenerator::loadGraphFromBinary(plain_loaded, filename) &&
+                plain_loaded.getEdgeCount() == saved.getEdgeCount(),
+                "Reordenamiento: el archivo con permutación se lee también sin ella");
+    LargeGraphGenerator::saveGraphToBinary(saved, filename);
+    LargeGraphGenerator::loadGraphFromBinary(loaded, filename, &loaded_order);
+    assert_true(loaded_order.getSize() == 10 && loaded_order[0] == 0 && loaded_order[9] == 9,
+                "Reordenamiento: sin sección de permutación se obtiene la identidad");
+    std::remove(filename.c_str());
+}
+
+void TestSuite::testNodePool() {
+    std::cout << "\n--- Tests del Pool de Nodos ---" << std::endl;
+    
+    // Slots de tamaño fijo, reutilizados desde la lista libre
+    NodePool pool(4);
+    void* first = pool.allocate(24);
+    assert_true(pool.getSlotSize() == 32, "NodePool: el slot se redondea a 16 bytes");
+    pool.deallocate(first, 24);
+    assert_true(pool.allocate(24) == first, "NodePool: un slot liberado se reutiliza");
+    for (int i = 0; i < 4; i++) {
+        pool.allocate(24);
+    }
+    assert_equals(2, pool.getChunkCount(), "NodePool: un bloque nuevo cada 4 slots");
+    assert_true(pool.getAllocationCount() == 6, "NodePool: cuenta los nodos entregados");
+    pool.release();
+    assert_equals(0, pool.getChunkCount(), "NodePool: release devuelve todos los bloques");
+    
+    // LinkedList y Queue sobre un pool compartido
+    NodePool shared(8);
+    LinkedList<int, PoolNodeAllocator> list{PoolNodeAllocator(&shared)};
+    Queue<int, PoolNodeAllocator> queue{PoolNodeAllocator(&shared)};
+    for (int i = 0; i < 20; i++) {
+        list.push_back(i);
+        queue.enqueue(i);
+    }
+    assert_equals(5, shared.getChunkCount(), "NodePool: lista y cola comparten los bloques");
+    LinkedList<int, PoolNodeAllocator> list_copy(list);
+    assert_true(list_copy.getAllocator().getPool() == &shared && list_copy.getSize() == 20 &&
+                list_copy.back() == 19, "NodePool: la copia de una lista usa el mismo pool");
+    bool fifo = true;
+    for (int i = 0; i < 20; i++) {
+        fifo = fifo && queue.front() == i;
+        queue.dequeue();
+    }
+    assert_true(fifo, "NodePool: la cola conserva el orden FIFO");
+    int chunks = shared.getChunkCount();
+    for (int i = 0; i < 20; i++) {
+        queue.enqueue(i);
+    }
+    assert_equals(chunks, shared.getChunkCount(), "NodePool: la cola reutiliza los slots liberados");
+    queue.clear();
+    
+    // Graph: las aristas viven en su pool y clear() las libera en bloque
+    Graph grid;
+    LargeGraphGenerator::generateGridGraph(grid, 30, 30);
+    assert_true(grid.getEdgeMemoryBytes() >= static_cast<size_t>(2 * grid.getEdgeCount()) * sizeof(Edge),
+                "NodePool: las aristas del grafo se reservan en bloques");
+    int corner = grid.getNodeId(0);
+    int far_corner = grid.getNodeId(grid.getNodeCount() - 1);
+    SearchAlgorithms search(&grid);
+    double before = search.dijkstra(corner, far_corner).total_distance;
+    grid.clear();
+    assert_true(grid.getEdgeMemoryBytes() == 0 && grid.getEdgeCount() == 0,
+                "NodePool: clear libera los bloques de aristas");
+    LargeGraphGenerator::generateGridGraph(grid, 30, 30);
+    SearchAlgorithms search_again(&grid);
+    assert_equals(before, search_again.dijkstra(grid.getNodeId(0), grid.getNodeId(grid.getNodeCount() - 1)).total_distance,
+                  "NodePool: el grafo se reconstruye tras clear");
+    SearchResult bfs = search_again.breadthFirstSearch(grid.getNodeId(0), grid.getNodeId(grid.getNodeCount() - 1));
+    assert_true(bfs.path_found && bfs.path.getSize() == 59, "NodePool: BFS con la cola del pool");
+}
+
+// Tests del índice espacial de cuadrícula
+void TestSuite::testSpatialGrid() {
+    std::cout << "\n--- Tests de Índice Espacial (SpatialGrid) ---" << std::endl;
+    
+    // Puntos agrupados (como en generateCityLikeGraph) más algunos aislados
+    DynamicArray<Node> nodes;
+    unsigned int seed = 17;
+    for (int i = 0; i < 2000; i++) {
+        seed = seed * 1103515245u + 12345u;
+        double x = (i % 4) * 200.0 + ((seed >> 8) % 1000) / 20.0;
+        seed = seed * 1103515245u + 12345u;
+        double y = (i % 3) * 300.0 + ((seed >> 8) % 1000) / 20.0;
+        nodes.push_back(Node(i, "", x, y));
+    }
+    nodes.push_back(Node(2000, "", 950.0, 950.0));
+    nodes.push_back(Node(2001, "", 950.0, 950.0)); // Duplicado exacto
+    
+    SpatialGrid grid;
+    grid.build(nodes);
+    assert_equals(nodes.getSize(), grid.getItemCount(), "Índice espacial contiene todos los puntos");
+    assert_true(grid.getCellCount() <= 4 * nodes.getSize() + 16, "Número de celdas O(n)");
+    
+    // Comparar contra fuerza bruta: mismos k vecinos y en el mismo orden
+    double radii[3] = {5.0, 30.0, std::numeric_limits<double>::infinity()};
+    bool same = true;
+    DynamicArray<std::pair<double, int>> neighbors;
+    for (int q = 0; q < 60 && same; q++) {
+        int query = (q * 37) % nodes.getSize();
+        double max_distance = radii[q % 3];
+        grid.kNearest(nodes[query].getX(), nodes[query].getY(), 5, max_distance, query, neighbors);
+        
+        DynamicArray<std::pair<double, int>> expected;
+        for (int i = 0; i < nodes.getSize(); i++) {
+            if (i == query) continue;
+            double dx = nodes[i].getX() - nodes[query].getX();
+            double dy = nodes[i].getY() - nodes[query].getY();
+            double distance = std::sqrt(dx * dx + dy * dy);
+            if (distance <= max_distance) {
+                expected.push_back(std::make_pair(distance, i));
+            }
+        }
+        // Selección de los 5 menores (distancia, índice)
+        int expected_count = expected.getSize() < 5 ? expected.getSize() : 5;
+        for (int a = 0; a < expected_count; a++) {
+            for (int b = a + 1; b < expected.getSize(); b++) {
+                if (expected[b] < expected[a]) {
+                    std::pair<double, int> temp = expected[a];
+                    expected[a] = expected[b];
+                    expected[b] = temp;
+                }
+            }
+        }
+        
+        same = neighbors.getSize() == expected_count;
+        for (int a = 0; same && a < expected_count; a++) {
+            same = neighbors[a].second == expected[a].second;
+        }
+    }
+    assert_true(same, "k vecinos más cercanos coinciden con fuerza bruta");
+    
+    grid.kNearest(950.0, 950.0, 3, 1.0, 2000, neighbors);
+    assert_true(neighbors.getSize() == 1 && neighbors[0].second == 2001, "Excluye el punto consultado y respeta el radio");
+    grid.kNearest(-500.0, -500.0, 1, std::numeric_limits<double>::infinity(), -1, neighbors);
+    assert_equals(1, neighbors.getSize(), "Consulta fuera del rectángulo encuentra el más cercano");
+    
+    // Los generadores conectan con vecinos reales dentro del radio
+    Graph city;
+    LargeGraphGenerator::generateCityLikeGraph(city, 3000, 5);
+    bool within_radius = true, bounded_degree = true;
+    for (int i = 0; i < city.getNodeCount(); i++) {
+        const EdgeList& adjacencies = city.getAdjacencies(i);
+        bounded_degree = bounded_degree && adjacencies.getSize() <= 5;
+        for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
+            within_radius = within_radius && (*it).getWeight() <= 30.0 && (*it).getDestination() != i;
+        }
+    }
+    assert_true(bounded_degree, "Ciudad: a lo sumo 5 conexiones por nodo");
+    assert_true(within_radius, "Ciudad: conexiones dentro de 30 unidades");
+    
+    Graph synthetic;
+    MapLoader::generateSyntheticMap(synthetic, 500, 100.0, 100.0);
+    bool connected_out = true;
+    for (int i = 0; i < synthetic.getNodeCount(); i++) {
+        connected_out = connected_out && synthetic.getAdjacencies(i).getSize() >= 3;
+    }
+    assert_true(connected_out, "Mapa sintético: cada nodo con al menos 3 vecinos");
+}
+
+// Tests del k-d tree y de las consultas por coordenadas
+void TestSuite::testKdTree() {
+    std::cout << "\n--- Tests de k-d tree (búsqueda por coordenadas) ---" << std::endl;
+    
+    KdTree empty;
+    DynamicArray<std::pair<double, int>> neighbors;
+    assert_equals(-1, empty.nearest(0.0, 0.0), "k-d tree vacío no retorna puntos");
+    assert_equals(0, empty.withinRadius(0.0, 0.0, 10.0, neighbors), "Radio en k-d tree vacío");
+    
+    // Puntos agrupados, una columna con x repetida y duplicados exactos
+    DynamicArray<Node> nodes;
+    unsigned int seed = 29;
+    for (int i = 0; i < 3000; i++) {
+        seed = seed * 1103515245u + 12345u;
+        double x = (i % 5) * 150.0 + ((seed >> 8) % 1000) / 25.0;
+        seed = seed * 1103515245u + 12345u;
+        double y = (i % 2) * 400.0 + ((seed >> 8) % 1000) / 25.0;
+        if (i % 7 == 0) x = 333.0;
+        nodes.push_back(Node(i, "", x, y));
+    }
+    nodes.push_back(Node(3000, "", 900.0, 900.0));
+    nodes.push_back(Node(3001, "", 900.0, 900.0));
+    
+    KdTree tree;
+    tree.build(nodes);
+    assert_equals(nodes.getSize(), tree.getSize(), "k-d tree contiene todos los puntos");
+    
+    // Comparar contra fuerza bruta: vecino más cercano, k vecinos y radio
+    bool same_nearest = true, same_k = true, same_radius = true;
+    for (int q = 0; q < 80; q++) {
+        seed = seed * 1103515245u + 12345u;
+        double x = ((seed >> 8) % 10000) / 10.0 - 50.0;
+        seed = seed * 1103515245u + 12345u;
+        double y = ((seed >> 8) % 10000) / 10.0 - 50.0;
+        
+        DynamicArray<std::pair<double, int>> expected;
+        for (int i = 0; i < nodes.getSize(); i++) {
+            double dx = nodes[i].getX() - x;
+            double dy = nodes[i].getY() - y;
+            expected.push_back(std::make_pair(std::sqrt(dx * dx + dy * dy), i));
+        }
+        // Selección de los 6 menores (distancia, índice)
+        for (int a = 0; a < 6; a++) {
+            for (int b = a + 1; b < expected.getSize(); b++) {
+                if (expected[b] < expected[a]) {
+                    std::pair<double, int> temp = expected[a];
+                    expected[a] = expected[b];
+                    expected[b] = temp;
+                }
+            }
+        }
+        
+        same_nearest = same_nearest && tree.nearest(x, y) == expected[0].second;
+        tree.kNearest(x, y, 6, std::numeric_limits<double>::infinity(), neighbors);
+        same_k = same_k && neighbors.getSize() == 6;
+        for (int a = 0; same_k && a < 6; a++) {
+            same_k = neighbors[a].second == expected[a].second;
+        }
+        
+        double radius = 12.0;
+        int inside = 0;
+        for (int i = 0; i < expected.getSize(); i++) {
+            if (expected[i].first <= radius) inside++;
+        }
+        tree.withinRadius(x, y, radius, neighbors);
+        same_radius = same_radius && neighbors.getSize() == inside;
+        for (int a = 0; same_radius && a < neighbors.getSize(); a++) {
+            same_radius = neighbors[a].first <= radius;
+        }
+    }
+    assert_true(same_nearest, "Vecino más cercano coincide con fuerza bruta");
+    assert_true(same_k, "k vecinos más cercanos coinciden con fuerza bruta");
+    assert_true(same_radius, "Consulta por radio coincide con fuerza bruta");
+    
+    tree.kNearest(900.0, 900.0, 5, 1.0, neighbors);
+    assert_true(neighbors.getSize() == 2 && neighbors[0].second == 3000 && neighbors[1].second == 3001,
+                "Duplicados exactos ordenados por índice y radio máximo respetado");
+    
+    // Índice espacial a nivel de Graph (retorna IDs) y ruta por coordenadas
+    Graph grid;
+    LargeGraphGenerator::generateGridGraph(grid, 20, 20);
+    const Node* corner = grid.getNode(grid.findNearestNode(-5.0, -5.0));
+    assert_true(corner && corner->getX() == 0.0 && corner->getY() == 0.0, "Graph: nodo más cercano a un punto externo");
+    DynamicArray<int> node_ids;
+    assert_equals(3, grid.findNodesInRadius(0.0, 0.0, 1.0, node_ids), "Graph: nodos dentro de un radio");
+    grid.findNearestNodes(0.0, 0.0, 2, node_ids);
+    assert_true(node_ids.getSize() == 2 && node_ids[0] == 0, "Graph: k vecinos más cercanos en orden");
+    
+    grid.addNode(Node(1000, "Nuevo", 500.0, 500.0));
+    assert_equals(1000, grid.findNearestNode(480.0, 490.0), "Graph: el índice se reconstruye al agregar nodos");
+    
+    SearchAlgorithms search(&grid);
+    SearchResult by_coordinates = search.routeFromCoordinates(0.2, -0.3, 18.8, 19.4);
+    SearchResult by_ids = search.aStar(grid.findNearestNode(0.2, -0.3), grid.findNearestNode(18.8, 19.4));
+    assert_true(by_coordinates.path_found, "Ruta por coordenadas encontrada");
+    assert_equals(by_ids.total_distance, by_coordinates.total_distance, "Ruta por coordenadas igual a A* entre los nodos ajustados");
+    
+    CompactGraph compact(grid);
+    SearchAlgorithms compact_search(&compact);
+    assert_equals(grid.findNearestNode(7.4, 12.6), compact_search.snapToNode(7.4, 12.6), "Ajuste a nodo sobre CompactGraph");
+}
+
 // Tests de generación de grafos grandes
 void TestSuite::testLargeGraphGeneration() {
     std::cout << "\n--- Tests de Generación de Grafos Grandes ---" << std::endl;
@@ -466,6 +2412,245 @@ void TestSuite::testDataValidation() {
     assert_equals(-1.0, graph.getEdgeWeight(0, 1), "Se permiten pesos negativos");
 }
 
+// Tests de carga de mapas CSV
+void TestSuite::testCSVLoading() {
+    std::cout << "\n--- Tests de Carga CSV ---" << std::endl;
+    
+    std::string nodes_path = "test_map_nodes.csv";
+    std::string edges_path = "test_map_edges.csv";
+    {
+        // Fin de línea CRLF, espacios, notación científica y filas inválidas
+        std::ofstream nodes_out(nodes_path.c_str(), std::ios::binary);
+        nodes_out << "id,name,x,y\r\n"
+                  << "1,Plaza,10.5,-3.25\r\n"
+                  << "2,Mercado, 1e3 ,0.125\r\n"
+                  << "3,Parque,abc,1\r\n"           // línea 4: x no numérico
+                  << "\r\n"                         // línea vacía (se ignora)
+                  << "4,Estadio,7\n"                  // línea 6: falta y
+                  << "1,Repetido,0,0\n"               // línea 7: ID repetido
+                  << "x5,Malo,0,0\n"                  // línea 8: ID no entero
+                  << "5,Puente,0.1,123456789.123456789"; // última línea sin salto
+        std::ofstream edges_out(edges_path.c_str(), std::ios::binary);
+        edges_out << "source,destination,weight\n"
+                  << "1,2,2.5\n"
+                  << "2,1,2.5\n"
+                  << "1,99,1.0\n"                     // línea 4: nodo inexistente
+                  << "2,5\n"                          // línea 5: falta weight
+                  << "5,1,7.5e-1\n";
+    }
+    
+    Graph graph;
+    CSVLoadReport report;
+    assert_true(MapLoader::loadFromCSV(graph, nodes_path, edges_path, &report), "Carga CSV exitosa");
+    assert_equals(3, report.nodes_loaded, "CSV: nodos válidos cargados");
+    assert_equals(3, report.edges_loaded, "CSV: aristas válidas cargadas");
+    assert_equals(6, report.malformed_rows, "CSV: filas mal formadas contadas");
+    assert_true(report.errors.getSize() == 6 &&
+                report.errors[0] == nodes_path + ":4: el campo x no es numérico" &&
+                report.errors[1] == nodes_path + ":6: falta el campo y" &&
+                report.errors[2] == nodes_path + ":7: ID de nodo repetido" &&
+                report.errors[3] == nodes_path + ":8: el campo id no es un entero válido" &&
+                report.errors[4] == edges_path + ":4: la arista referencia un nodo inexistente" &&
+                report.errors[5] == edges_path + ":5: falta el campo weight",
+                "CSV: errores informados con archivo y número de línea");
+    
+    const Node* plaza = graph.getNode(1);
+    const Node* mercado = graph.getNode(2);
+    const Node* puente = graph.getNode(5);
+    assert_true(plaza && plaza->getName() == "Plaza" && plaza->getX() == 10.5 && plaza->getY() == -3.25,
+                "CSV: campos del nodo leídos (fin de línea CRLF)");
+    assert_true(mercado && mercado->getX() == 1000.0, "CSV: notación científica con espacios");
+    assert_true(puente && puente->getY() == std::strtod("123456789.123456789", nullptr),
+                "CSV: última línea sin salto y número con más de 15 dígitos");
+    assert_equals(0.75, graph.getEdgeWeight(5, 1), "CSV: peso en notación científica");
+    
+    // Los números se leen igual que strtod (redondeo correcto)
+    const char* samples[] = {"0.1", "-2.5e-3", "3.141592653589793", "1e22", "1e23", "123456.789012",
+                             "0.000001", "9007199254740993", "4.9e-324", "-0", "17976931348623157e292"};
+    bool same_as_strtod = true;
+    {
+        std::ofstream edges_out(edges_path.c_str());
+        edges_out << "source,destination,weight\n";
+    }
+    for (int i = 0; i < 11; i++) {
+        std::ofstream nodes_out(nodes_path.c_str());
+        nodes_out << "id,name,x,y\n0,n," << samples[i] << ",0\n";
+        nodes_out.close();
+        Graph single;
+        MapLoader::loadFromCSV(single, nodes_path, edges_path);
+        same_as_strtod = same_as_strtod && single.getNode(0) &&
+                         single.getNode(0)->getX() == std::strtod(samples[i], nullptr);
+    }
+    assert_true(same_as_strtod, "CSV: números idénticos a strtod");
+    
+    // Ida y vuelta: saveToCSV + loadFromCSV reproduce el grafo, igual que
+    // el cargador anterior
+    Graph city;
+    LargeGraphGenerator::generateCityLikeGraph(city, 2000, 5);
+    assert_true(MapLoader::saveToCSV(city, nodes_path, edges_path), "CSV: grafo guardado");
+    Graph loaded, legacy;
+    CSVLoadReport round_trip;
+    MapLoader::loadFromCSV(loaded, nodes_path, edges_path, &round_trip);
+    MapLoader::loadFromCSVLegacy(legacy, nodes_path, edges_path);
+    bool same_graph = loaded.getNodeCount() == city.getNodeCount() &&
+                      loaded.getEdgeCount() == city.getEdgeCount() &&
+                      legacy.getEdgeCount() == city.getEdgeCount() && round_trip.malformed_rows == 0;
+    const DynamicArray<Node>& city_nodes = city.getAllNodes();
+    for (int i = 0; same_graph && i < city_nodes.getSize(); i++) {
+        const Node* node = loaded.getNode(city_nodes[i].getId());
+        same_graph = node && node->getX() == city_nodes[i].getX() && node->getY() == city_nodes[i].getY();
+        DynamicArray<int> neighbors = city.getNeighbors(city_nodes[i].getId());
+        for (int j = 0; same_graph && j < neighbors.getSize(); j++) {
+            same_graph = loaded.getEdgeWeight(city_nodes[i].getId(), neighbors[j]) ==
+                         city.getEdgeWeight(city_nodes[i].getId(), neighbors[j]);
+        }
+    }
+    assert_true(same_graph, "CSV: ida y vuelta exacta (coincide con el cargador anterior)");
+    
+    // Archivo de aristas de 0 bytes: un mapa sin aristas, no un error
+    {
+        std::ofstream nodes_out(nodes_path.c_str());
+        nodes_out << "id,name,x,y\n1,A,0,0\n2,B,1,0\n";
+        std::ofstream edges_out(edges_path.c_str(), std::ios::trunc);
+    }
+    Graph no_edges, no_edges_parallel, no_edges_legacy;
+    CompactGraph no_edges_compact;
+    assert_true(MapLoader::loadFromCSV(no_edges, nodes_path, edges_path) &&
+                no_edges.getNodeCount() == 2 && no_edges.getEdgeCount() == 0,
+                "CSV: archivo de aristas vacío (0 bytes)");
+    assert_true(MapLoader::loadFromCSVParallel(no_edges_parallel, nodes_path, edges_path, 4) &&
+                no_edges_parallel.getNodeCount() == 2 && no_edges_parallel.getEdgeCount() == 0,
+                "CSV paralelo: archivo de aristas vacío (0 bytes)");
+    assert_true(MapLoader::loadCompactFromCSV(no_edges_compact, nodes_path, edges_path, 4) &&
+                no_edges_compact.getNodeCount() == 2 && no_edges_compact.getEdgeCount() == 0,
+                "CSV a CSR: archivo de aristas vacío (0 bytes)");
+    assert_true(MapLoader::loadFromCSVLegacy(no_edges_legacy, nodes_path, edges_path) &&
+                no_edges_legacy.getNodeCount() == 2, "CSV: el cargador anterior coincide con 0 aristas");
+    {
+        std::ofstream nodes_out(nodes_path.c_str(), std::ios::trunc);
+    }
+    Graph no_nodes;
+    assert_true(MapLoader::loadFromCSV(no_nodes, nodes_path, edges_path) && no_nodes.getNodeCount() == 0,
+                "CSV: ambos archivos vacíos dan un grafo vacío");
+    
+    Graph missing;
+    assert_false(MapLoader::loadFromCSV(missing, "no_existe_nodos.csv", edges_path), "CSV: archivo inexistente");
+    
+    std::remove(nodes_path.c_str());
+    std::remove(edges_path.c_str());
+}
+
+void TestSuite::testParallelCSVLoading() {
+    std::cout << "\n--- Tests de Carga CSV Paralela ---" << std::endl;
+    
+    std::string nodes_path = "test_parallel_nodes.csv";
+    std::string edges_path = "test_parallel_edges.csv";
+    
+    // Grafo válido con algunas filas inválidas intercaladas, para que los
+    // errores caigan en fragmentos distintos según el número de hilos
+    Graph city;
+    LargeGraphGenerator::generateCityLikeGraph(city, 1500, 5);
+    assert_true(MapLoader::saveToCSV(city, nodes_path, edges_path), "CSV paralelo: grafo guardado");
+    {
+        std::ofstream nodes_out(nodes_path.c_str(), std::ios::app);
+        nodes_out << "x1,Malo,0,0\n"
+                  << city.getAllNodes()[7].getId() << ",Repetido,0,0\n"
+                  << "999999,Ultimo,1.5,2.5";
+        std::ofstream edges_out(edges_path.c_str(), std::ios::app);
+        edges_out << "1,424242,1.0\n"
+                  << city.getAllNodes()[0].getId() << ",999999\n"
+                  << "999999," << city.getAllNodes()[0].getId() << ",3.5\n";
+    }
+    
+    Graph sequential;
+    CSVLoadReport sequential_report;
+    MapLoader::loadFromCSV(sequential, nodes_path, edges_path, &sequential_report);
+    CompactGraph reference(sequential);
+    
+    const int thread_counts[] = {1, 2, 3, 8};
+    bool same_graph = true;
+    bool same_report = true;
+    bool same_compact = true;
+    for (int t = 0; t < 4; t++) {
+        Graph parallel;
+        CSVLoadReport report;
+        MapLoader::loadFromCSVParallel(parallel, nodes_path, edges_path, thread_counts[t], &report);
+        
+        same_report = same_report && report.nodes_loaded == sequential_report.nodes_loaded &&
+                      report.edges_loaded == sequential_report.edges_loaded &&
+                      report.malformed_rows == sequential_report.malformed_rows &&
+                      report.errors.getSize() == sequential_report.errors.getSize();
+        for (int e = 0; same_report && e < report.errors.getSize(); e++) {
+            same_report = report.errors[e] == sequential_report.errors[e];
+        }
+        
+        // Mismo orden de nodos y mismas listas de adyacencia
+        const DynamicArray<Node>& expected = sequential.getAllNodes();
+        const DynamicArray<Node>& actual = parallel.getAllNodes();
+        same_graph = same_graph && actual.getSize() == expected.getSize() &&
+                     parallel.getEdgeCount() == sequential.getEdgeCount();
+        for (int i = 0; same_graph && i < expected.getSize(); i++) {
+            same_graph = actual[i].getId() == expected[i].getId() && actual[i].getName() == expected[i].getName() &&
+                         actual[i].getX() == expected[i].getX() && actual[i].getY() == expected[i].getY();
+            DynamicArray<int> a = parallel.getNeighbors(expected[i].getId());
+            DynamicArray<int> b = sequential.getNeighbors(expected[i].getId());
+            same_graph = same_graph && a.getSize() == b.getSize();
+            for (int j = 0; same_graph && j < a.getSize(); j++) {
+                same_graph = a[j] == b[j];
+            }
+        }
+        
+        // CSR construido directamente: idéntico a CompactGraph(grafo secuencial)
+        CompactGraph compact;
+        CSVLoadReport compact_report;
+        MapLoader::loadCompactFromCSV(compact, nodes_path, edges_path, thread_counts[t], &compact_report);
+        same_compact = same_compact && compact.getNodeCount() == reference.getNodeCount() &&
+                       compact.getEdgeCount() == reference.getEdgeCount() &&
+                       compact_report.malformed_rows == sequential_report.malformed_rows &&
+                       compact_report.errors.getSize() == sequential_report.errors.getSize();
+        for (int e = 0; same_compact && e < compact_report.errors.getSize(); e++) {
+            same_compact = compact_report.errors[e] == sequential_report.errors[e];
+        }
+        for (int i = 0; same_compact && i < reference.getNodeCount(); i++) {
+            same_compact = compact.getNodeId(i) == reference.getNodeId(i) &&
+                           compact.getName(i) == reference.getName(i) &&
+                           compact.getX(i) == reference.getX(i) && compact.getY(i) == reference.getY(i) &&
+                           compact.edgesBegin(i) == reference.edgesBegin(i) &&
+                           compact.edgesEnd(i) == reference.edgesEnd(i);
+        }
+        for (int e = 0; same_compact && e < reference.getEdgeCount(); e++) {
+            same_compact = compact.getTarget(e) == reference.getTarget(e) &&
+                           compact.getWeight(e) == reference.getWeight(e);
+        }
+    }
+    assert_equals(4, sequential_report.malformed_rows, "CSV paralelo: filas inválidas de la prueba");
+    assert_true(same_report, "CSV paralelo: conteos y errores iguales con 1, 2, 3 y 8 hilos");
+    assert_true(same_graph, "CSV paralelo: grafo idéntico al de la carga secuencial");
+    assert_true(same_compact, "CSV paralelo: CSR directo idéntico a CompactGraph(grafo)");
+    
+    // Más hilos que líneas: fragmentos vacíos
+    {
+        std::ofstream nodes_out(nodes_path.c_str());
+        nodes_out << "id,name,x,y\n1,A,0,0\n2,B,1,0\n";
+        std::ofstream edges_out(edges_path.c_str());
+        edges_out << "source,destination,weight\n1,2,1.0\n";
+    }
+    Graph tiny;
+    CompactGraph tiny_compact;
+    MapLoader::loadFromCSVParallel(tiny, nodes_path, edges_path, 16);
+    MapLoader::loadCompactFromCSV(tiny_compact, nodes_path, edges_path, 16);
+    assert_true(tiny.getNodeCount() == 2 && tiny.getEdgeCount() == 1 &&
+                tiny_compact.getNodeCount() == 2 && tiny_compact.getEdgeCount() == 1,
+                "CSV paralelo: más hilos que filas");
+    
+    Graph missing;
+    assert_false(MapLoader::loadFromCSVParallel(missing, "no_existe_nodos.csv", edges_path, 4),
+                 "CSV paralelo: archivo inexistente");
+    
+    std::remove(nodes_path.c_str());
+    std::remove(edges_path.c_str());
+}
+
 // Mostrar resumen de resultados
 void TestSuite::printSummary() {
     std::cout << "\n=== RESUMEN DE PRUEBAS ===" << std::endl;
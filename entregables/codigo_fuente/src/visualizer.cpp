@@ -15,6 +15,8 @@ Visualizer::Visualizer(const Graph* graph)
     } else {
         font_loaded = true;
     }
+    
+    updateViewTransform();
 }
 
 // Destructor
@@ -22,27 +24,24 @@ Visualizer::~Visualizer() {
     delete search_algorithms;
 }
 
-// Convertir coordenadas del nodo a coordenadas de pantalla
-sf::Vector2f Visualizer::nodeToScreen(const Node* node) const {
-    if (!node) return sf::Vector2f(0, 0);
+// Transformación mundo -> pantalla: escala uniforme que ajusta el grafo a
+// la ventana dejando un margen
+void Visualizer::updateViewTransform() {
+    const DynamicArray<Node>& nodes = graph->getAllNodes();
+    double min_x = 0.0, min_y = 0.0;
+    double max_x = 0.0, max_y = 0.0;
     
     // Encontrar los límites del grafo
-    double min_x = node->getX(), max_x = node->getX();
-    double min_y = node->getY(), max_y = node->getY();
-    
-    const DynamicArray<Node>& nodes = graph->getAllNodes();
     for (int i = 0; i < nodes.getSize(); i++) {
         double x = nodes[i].getX();
         double y = nodes[i].getY();
         
-        if (x < min_x) min_x = x;
-        if (x > max_x) max_x = x;
-        if (y < min_y) min_y = y;
-        if (y > max_y) max_y = y;
+        if (i == 0 || x < min_x) min_x = x;
+        if (i == 0 || x > max_x) max_x = x;
+        if (i == 0 || y < min_y) min_y = y;
+        if (i == 0 || y > max_y) max_y = y;
     }
     
-    // Agregar margen
-    double margin = 50.0;
     double width = max_x - min_x;
     double height = max_y - min_y;
     
@@ -50,29 +49,42 @@ sf::Vector2f Visualizer::nodeToScreen(const Node* node) const {
     if (height == 0) height = 1;
     
     // Escalar a la ventana
-    double scale_x = (WINDOW_WIDTH - 2 * margin) / width;
-    double scale_y = (WINDOW_HEIGHT - 2 * margin) / height;
-    double scale = std::min(scale_x, scale_y);
+    double scale_x = (WINDOW_WIDTH - 2 * VIEW_MARGIN) / width;
+    double scale_y = (WINDOW_HEIGHT - 2 * VIEW_MARGIN) / height;
+    view_min_x = min_x;
+    view_min_y = min_y;
+    view_scale = std::min(scale_x, scale_y);
+}
+
+// Convertir coordenadas del nodo a coordenadas de pantalla
+sf::Vector2f Visualizer::nodeToScreen(const Node* node) const {
+    if (!node) return sf::Vector2f(0, 0);
     
-    float screen_x = margin + (node->getX() - min_x) * scale;
-    float screen_y = margin + (node->getY() - min_y) * scale;
+    float screen_x = VIEW_MARGIN + (node->getX() - view_min_x) * view_scale;
+    float screen_y = VIEW_MARGIN + (node->getY() - view_min_y) * view_scale;
     
     return sf::Vector2f(screen_x, screen_y);
 }
 
-// Obtener el nodo en una posición específica
+// Obtener el nodo en una posición específica: la posición se lleva a
+// coordenadas del grafo y se consulta el índice espacial en lugar de
+// recorrer todos los nodos
 int Visualizer::getNodeAtPosition(sf::Vector2f position) const {
-    const DynamicArray<Node>& nodes = graph->getAllNodes();
+    if (graph->getNodeCount() == 0) {
+        return -1;
+    }
     
-    for (int i = 0; i < nodes.getSize(); i++) {
-        sf::Vector2f node_pos = nodeToScreen(&nodes[i]);
-        float dx = position.x - node_pos.x;
-        float dy = position.y - node_pos.y;
-        float distance = std::sqrt(dx * dx + dy * dy);
-        
-        if (distance <= NODE_RADIUS + 5) { // Un poco de tolerancia
-            return nodes[i].getId();
-        }
+    double x = view_min_x + (position.x - VIEW_MARGIN) / view_scale;
+    double y = view_min_y + (position.y - VIEW_MARGIN) / view_scale;
+    int node_id = graph->findNearestNode(x, y);
+    
+    sf::Vector2f node_pos = nodeToScreen(graph->getNode(node_id));
+    float dx = position.x - node_pos.x;
+    float dy = position.y - node_pos.y;
+    float distance = std::sqrt(dx * dx + dy * dy);
+    
+    if (distance <= NODE_RADIUS + 5) { // Un poco de tolerancia
+        return node_id;
     }
     
     return -1;
@@ -130,7 +142,7 @@ void Visualizer::drawEdges() {
         const Node& node = nodes[i];
         sf::Vector2f start_pos = nodeToScreen(&node);
         
-        const LinkedList<Edge>& adjacencies = graph->getAdjacencies(node.getId());
+        const EdgeList& adjacencies = graph->getAdjacencies(node.getId());
         for (auto it = adjacencies.begin(); it != adjacencies.end(); ++it) {
             const Edge& edge = *it;
             const Node* dest_node = graph->getNode(edge.getDestination());